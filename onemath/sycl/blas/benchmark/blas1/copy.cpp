@@ -0,0 +1,117 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t size,
+         bool* success) {
+  // The counters are double. We convert size to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double size_d = static_cast<double>(size);
+  const double n_fl_ops = 0;
+  const double bytes_processed = 2 * size_d * sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> v1 = utils::random_data<scalar_t>(size);
+  std::vector<scalar_t> v2 = utils::random_data<scalar_t>(size);
+
+  auto inx = utils::make_device_copy<mem_alloc>(q, v1);
+  auto iny = utils::make_device_copy<mem_alloc>(q, v2);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> y_ref = v2;
+  reference_blas::copy(size, v1.data(), 1, y_ref.data(), 1);
+  std::vector<scalar_t> y_temp = v2;
+  {
+    auto y_temp_gpu = utils::make_device_copy<mem_alloc>(q, y_temp);
+    auto event = blas::_copy(sb_handle, size, inx, 1, y_temp_gpu, 1);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, y_temp_gpu, y_temp.data(), size).wait();
+    blas::helper::deallocate<mem_alloc>(y_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(y_temp, y_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_copy(sb_handle, size, inx, 1, iny, 1);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(inx, q);
+  blas::helper::deallocate<mem_alloc>(iny, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_blas1_params(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          index_t size;
+          std::tie(size) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr, index_t size,
+                               bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, size, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Copy", size, mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, size, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
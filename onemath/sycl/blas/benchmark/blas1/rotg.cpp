@@ -0,0 +1,125 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         bool* success) {
+  // rotg works on scalars: 4 inputs/outputs and a handful of operations
+  const double n_fl_ops = 10;
+  const double bytes_processed = 4 * sizeof(scalar_t);
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> a = {utils::random_scalar<scalar_t>()};
+  std::vector<scalar_t> b = {utils::random_scalar<scalar_t>()};
+  std::vector<scalar_t> c = {scalar_t{0}};
+  std::vector<scalar_t> s = {scalar_t{0}};
+
+  auto buf_a = utils::make_device_copy<mem_alloc>(q, a);
+  auto buf_b = utils::make_device_copy<mem_alloc>(q, b);
+  auto buf_c = utils::make_device_copy<mem_alloc>(q, c);
+  auto buf_s = utils::make_device_copy<mem_alloc>(q, s);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> a_ref = a, b_ref = b, c_ref = c, s_ref = s;
+  reference_blas::rotg(a_ref[0], b_ref[0], c_ref[0], s_ref[0]);
+  std::vector<scalar_t> a_temp = a, b_temp = b, c_temp = c, s_temp = s;
+  {
+    auto a_gpu = utils::make_device_copy<mem_alloc>(q, a_temp);
+    auto b_gpu = utils::make_device_copy<mem_alloc>(q, b_temp);
+    auto c_gpu = utils::make_device_copy<mem_alloc>(q, c_temp);
+    auto s_gpu = utils::make_device_copy<mem_alloc>(q, s_temp);
+    auto event = blas::_rotg(sb_handle, a_gpu, b_gpu, c_gpu, s_gpu);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, a_gpu, a_temp.data(), 1).wait();
+    blas::helper::copy_to_host(q, b_gpu, b_temp.data(), 1).wait();
+    blas::helper::copy_to_host(q, c_gpu, c_temp.data(), 1).wait();
+    blas::helper::copy_to_host(q, s_gpu, s_temp.data(), 1).wait();
+    blas::helper::deallocate<mem_alloc>(a_gpu, q);
+    blas::helper::deallocate<mem_alloc>(b_gpu, q);
+    blas::helper::deallocate<mem_alloc>(c_gpu, q);
+    blas::helper::deallocate<mem_alloc>(s_gpu, q);
+  }
+  if (!utils::compare_vectors(a_temp, a_ref) ||
+      !utils::compare_vectors(b_temp, b_ref) ||
+      !utils::compare_vectors(c_temp, c_ref) ||
+      !utils::compare_vectors(s_temp, s_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_rotg(sb_handle, buf_a, buf_b, buf_c, buf_s);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(buf_a, q);
+  blas::helper::deallocate<mem_alloc>(buf_b, q);
+  blas::helper::deallocate<mem_alloc>(buf_c, q);
+  blas::helper::deallocate<mem_alloc>(buf_s, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr, bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, success);
+        };
+        benchmark::RegisterBenchmark(
+            utils::get_name<scalar_t>("Rotg", mem_type).c_str(), BM_lambda,
+            sb_handle_ptr, success)
+            ->UseManualTime();
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
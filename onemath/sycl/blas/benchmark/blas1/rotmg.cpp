@@ -0,0 +1,132 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         bool* success) {
+  // rotmg works on scalars: 4 inputs/outputs and the 5 parameters
+  const double n_fl_ops = 20;
+  const double bytes_processed = 9 * sizeof(scalar_t);
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> d1 = {utils::random_scalar<scalar_t>(1, 2)};
+  std::vector<scalar_t> d2 = {utils::random_scalar<scalar_t>(1, 2)};
+  std::vector<scalar_t> x1 = {utils::random_scalar<scalar_t>()};
+  std::vector<scalar_t> y1 = {utils::random_scalar<scalar_t>()};
+  std::vector<scalar_t> param(5, scalar_t{0});
+
+  auto buf_d1 = utils::make_device_copy<mem_alloc>(q, d1);
+  auto buf_d2 = utils::make_device_copy<mem_alloc>(q, d2);
+  auto buf_x1 = utils::make_device_copy<mem_alloc>(q, x1);
+  auto buf_y1 = utils::make_device_copy<mem_alloc>(q, y1);
+  auto buf_param = utils::make_device_copy<mem_alloc>(q, param);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> d1_ref = d1, d2_ref = d2, x1_ref = x1;
+  std::vector<scalar_t> param_ref = param;
+  reference_blas::rotmg(d1_ref[0], d2_ref[0], x1_ref[0], y1[0],
+                        param_ref.data());
+  std::vector<scalar_t> d1_temp = d1, d2_temp = d2, x1_temp = x1;
+  std::vector<scalar_t> param_temp = param;
+  {
+    auto d1_gpu = utils::make_device_copy<mem_alloc>(q, d1_temp);
+    auto d2_gpu = utils::make_device_copy<mem_alloc>(q, d2_temp);
+    auto x1_gpu = utils::make_device_copy<mem_alloc>(q, x1_temp);
+    auto param_gpu = utils::make_device_copy<mem_alloc>(q, param_temp);
+    auto event =
+        blas::_rotmg(sb_handle, d1_gpu, d2_gpu, x1_gpu, buf_y1, param_gpu);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, d1_gpu, d1_temp.data(), 1).wait();
+    blas::helper::copy_to_host(q, d2_gpu, d2_temp.data(), 1).wait();
+    blas::helper::copy_to_host(q, x1_gpu, x1_temp.data(), 1).wait();
+    blas::helper::copy_to_host(q, param_gpu, param_temp.data(), 5).wait();
+    blas::helper::deallocate<mem_alloc>(d1_gpu, q);
+    blas::helper::deallocate<mem_alloc>(d2_gpu, q);
+    blas::helper::deallocate<mem_alloc>(x1_gpu, q);
+    blas::helper::deallocate<mem_alloc>(param_gpu, q);
+  }
+  if (!utils::compare_vectors(d1_temp, d1_ref) ||
+      !utils::compare_vectors(d2_temp, d2_ref) ||
+      !utils::compare_vectors(x1_temp, x1_ref) ||
+      !utils::compare_vectors(param_temp, param_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_rotmg(sb_handle, buf_d1, buf_d2, buf_x1, buf_y1, buf_param);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(buf_d1, q);
+  blas::helper::deallocate<mem_alloc>(buf_d2, q);
+  blas::helper::deallocate<mem_alloc>(buf_x1, q);
+  blas::helper::deallocate<mem_alloc>(buf_y1, q);
+  blas::helper::deallocate<mem_alloc>(buf_param, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        auto BM_lambda = [&](benchmark::State& st,
+                             blas::SB_Handle* sb_handle_ptr, bool* success) {
+          run<scalar_t, mem_alloc>(st, sb_handle_ptr, success);
+        };
+        benchmark::RegisterBenchmark(
+            utils::get_name<scalar_t>("Rotmg", mem_type).c_str(), BM_lambda,
+            sb_handle_ptr, success)
+            ->UseManualTime();
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,147 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string t_str, index_t m, index_t n, index_t kl, index_t ku,
+         scalar_t alpha, scalar_t beta, bool* success) {
+  const char t = t_str[0];
+  const bool is_trans = t == 't' || t == 'T';
+  const index_t x_size = is_trans ? m : n;
+  const index_t y_size = is_trans ? n : m;
+
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double y_size_d = static_cast<double>(y_size);
+  const double band_d = static_cast<double>(kl + ku + 1);
+  const double n_fl_ops = 2 * band_d * static_cast<double>(n) + y_size_d +
+                          (beta != scalar_t{0} ? 2 * y_size_d : 0);
+  const double bytes_processed =
+      (band_d * static_cast<double>(n) + x_size +
+       (beta != scalar_t{0} ? 2 : 1) * y_size_d) *
+      sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t lda = kl + ku + 1;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(lda * n);
+  std::vector<scalar_t> v_x = utils::random_data<scalar_t>(x_size);
+  std::vector<scalar_t> v_y = utils::random_data<scalar_t>(y_size);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto v_x_gpu = utils::make_device_copy<mem_alloc>(q, v_x);
+  auto v_y_gpu = utils::make_device_copy<mem_alloc>(q, v_y);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> y_ref = v_y;
+  reference_blas::gbmv(t, m, n, kl, ku, alpha, m_a.data(), lda, v_x.data(),
+                       1, beta, y_ref.data(), 1);
+  std::vector<scalar_t> y_temp = v_y;
+  {
+    auto y_temp_gpu = utils::make_device_copy<mem_alloc>(q, y_temp);
+    auto event = blas::_gbmv(sb_handle, t, m, n, kl, ku, alpha, m_a_gpu, lda,
+                             v_x_gpu, 1, beta, y_temp_gpu, 1);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, y_temp_gpu, y_temp.data(), y_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(y_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(y_temp, y_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_gbmv(sb_handle, t, m, n, kl, ku, alpha, m_a_gpu, lda, v_x_gpu,
+                       1, beta, v_y_gpu, 1);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_gbmv_params<scalar_t>(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string t_str;
+          index_t m;
+          index_t n;
+          index_t kl;
+          index_t ku;
+          scalar_t alpha;
+          scalar_t beta;
+          std::tie(t_str, m, n, kl, ku, alpha, beta) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string t_str, index_t m, index_t n,
+                               index_t kl, index_t ku, scalar_t alpha,
+                               scalar_t beta, bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, t_str, m, n, kl, ku,
+                                     alpha, beta, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Gbmv", t_str, m, n, kl, ku, alpha,
+                                        beta, mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, t_str, m, n, kl, ku, alpha, beta,
+              success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
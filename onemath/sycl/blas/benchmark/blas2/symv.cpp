@@ -0,0 +1,138 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string uplo_str, index_t n, scalar_t alpha, scalar_t beta,
+         bool* success) {
+  const char uplo = uplo_str[0];
+
+  // The counters are double. We convert n to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  const double n_d = static_cast<double>(n);
+  const double n_fl_ops =
+      2 * n_d * n_d + n_d + (beta != scalar_t{0} ? 2 * n_d : 0);
+  // Only one triangle of the matrix is read
+  const double bytes_processed =
+      (n_d * (n_d + 1) / 2 + n_d + (beta != scalar_t{0} ? 2 : 1) * n_d) *
+      sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t lda = n;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(lda * n);
+  std::vector<scalar_t> v_x = utils::random_data<scalar_t>(n);
+  std::vector<scalar_t> v_y = utils::random_data<scalar_t>(n);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto v_x_gpu = utils::make_device_copy<mem_alloc>(q, v_x);
+  auto v_y_gpu = utils::make_device_copy<mem_alloc>(q, v_y);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> y_ref = v_y;
+  reference_blas::symv(uplo, n, alpha, m_a.data(), lda, v_x.data(), 1, beta,
+                       y_ref.data(), 1);
+  std::vector<scalar_t> y_temp = v_y;
+  {
+    auto y_temp_gpu = utils::make_device_copy<mem_alloc>(q, y_temp);
+    auto event = blas::_symv(sb_handle, uplo, n, alpha, m_a_gpu, lda, v_x_gpu,
+                             1, beta, y_temp_gpu, 1);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, y_temp_gpu, y_temp.data(), y_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(y_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(y_temp, y_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_symv(sb_handle, uplo, n, alpha, m_a_gpu, lda, v_x_gpu, 1,
+                       beta, v_y_gpu, 1);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_symv_params<scalar_t>(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string uplo_str;
+          index_t n;
+          scalar_t alpha;
+          scalar_t beta;
+          std::tie(uplo_str, n, alpha, beta) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string uplo_str, index_t n, scalar_t alpha,
+                               scalar_t beta, bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, uplo_str, n, alpha,
+                                     beta, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Symv", uplo_str, n, alpha, beta,
+                                        mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, uplo_str, n, alpha, beta, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,141 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string uplo_str, std::string t_str, std::string diag_str,
+         index_t n, index_t k, bool* success) {
+  const char uplo = uplo_str[0];
+  const char t = t_str[0];
+  const char diag = diag_str[0];
+
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double n_d = static_cast<double>(n);
+  const double elems_d = static_cast<double>(k + 1) * n_d;
+  const double n_fl_ops = 2 * elems_d;
+  const double bytes_processed = (elems_d + 2 * n_d) * sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t lda = k + 1;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(lda * n);
+  // Make the diagonal dominant so that the solver stays stable
+  for (index_t j = 0; j < n; j++) {
+    m_a[(uplo == 'u' || uplo == 'U' ? k : 0) + j * lda] =
+        utils::random_scalar<scalar_t>(scalar_t{9}, scalar_t{11});
+  }
+  std::vector<scalar_t> v_x = utils::random_data<scalar_t>(n);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto v_x_gpu = utils::make_device_copy<mem_alloc>(q, v_x);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> x_ref = v_x;
+  reference_blas::tbsv(uplo, t, diag, n, k, m_a.data(), lda, x_ref.data(), 1);
+  std::vector<scalar_t> x_temp = v_x;
+  {
+    auto x_temp_gpu = utils::make_device_copy<mem_alloc>(q, x_temp);
+    auto event = blas::_tbsv(sb_handle, uplo, t, diag, n, k, m_a_gpu, lda,
+                             x_temp_gpu, 1);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, x_temp_gpu, x_temp.data(), x_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(x_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(x_temp, x_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_tbsv(sb_handle, uplo, t, diag, n, k, m_a_gpu, lda, v_x_gpu,
+                       1);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_tbmv_params(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string uplo_str;
+          std::string t_str;
+          std::string diag_str;
+          index_t n;
+          index_t k;
+          std::tie(uplo_str, t_str, diag_str, n, k) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string uplo_str, std::string t_str,
+                               std::string diag_str, index_t n, index_t k,
+                               bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, uplo_str, t_str,
+                                     diag_str, n, k, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Tbsv", uplo_str, t_str, diag_str, n, k,
+                                        mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, uplo_str, t_str, diag_str, n, k,
+              success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
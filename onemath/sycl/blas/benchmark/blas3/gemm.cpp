@@ -0,0 +1,147 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string t_a_str, std::string t_b_str, index_t m, index_t n,
+         index_t k, scalar_t alpha, scalar_t beta, bool* success) {
+  const char t_a = t_a_str[0];
+  const char t_b = t_b_str[0];
+
+  // The counters are double. We convert m, n and k to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double m_d = static_cast<double>(m);
+  const double n_d = static_cast<double>(n);
+  const double k_d = static_cast<double>(k);
+  const double n_fl_ops =
+      2 * m_d * n_d * k_d + (beta != scalar_t{0} ? 3 : 1) * m_d * n_d;
+  const double bytes_processed =
+      (m_d * k_d + k_d * n_d + (beta != scalar_t{0} ? 2 : 1) * m_d * n_d) *
+      sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t lda = (t_a == 'n' || t_a == 'N') ? m : k;
+  const index_t ldb = (t_b == 'n' || t_b == 'N') ? k : n;
+  const index_t ldc = m;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(m * k);
+  std::vector<scalar_t> m_b = utils::random_data<scalar_t>(k * n);
+  std::vector<scalar_t> m_c = utils::random_data<scalar_t>(m * n);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto m_b_gpu = utils::make_device_copy<mem_alloc>(q, m_b);
+  auto m_c_gpu = utils::make_device_copy<mem_alloc>(q, m_c);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref = m_c;
+  reference_blas::gemm(t_a, t_b, m, n, k, alpha, m_a.data(), lda, m_b.data(),
+                       ldb, beta, c_ref.data(), ldc);
+  std::vector<scalar_t> c_temp = m_c;
+  {
+    auto c_temp_gpu = utils::make_device_copy<mem_alloc>(q, c_temp);
+    auto event = blas::_gemm(sb_handle, t_a, t_b, m, n, k, alpha, m_a_gpu, lda,
+                             m_b_gpu, ldb, beta, c_temp_gpu, ldc);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, c_temp_gpu, c_temp.data(), c_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(c_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(c_temp, c_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_gemm(sb_handle, t_a, t_b, m, n, k, alpha, m_a_gpu, lda,
+                       m_b_gpu, ldb, beta, m_c_gpu, ldc);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_b_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_c_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_blas3_params<scalar_t>(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string t_a_str;
+          std::string t_b_str;
+          index_t m;
+          index_t n;
+          index_t k;
+          scalar_t alpha;
+          scalar_t beta;
+          std::tie(t_a_str, t_b_str, m, n, k, alpha, beta) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string t_a_str, std::string t_b_str,
+                               index_t m, index_t n, index_t k, scalar_t alpha,
+                               scalar_t beta, bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, t_a_str, t_b_str, m, n,
+                                     k, alpha, beta, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Gemm", t_a_str, t_b_str, m, n, k,
+                                        alpha, beta, mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, t_a_str, t_b_str, m, n, k, alpha, beta,
+              success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
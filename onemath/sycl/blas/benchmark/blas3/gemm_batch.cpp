@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+#ifdef SB_ENABLE_USM
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string t_a_str, std::string t_b_str, index_t m, index_t n,
+         index_t k, scalar_t alpha, scalar_t beta, index_t group_count,
+         index_t group_size, index_t size_step, bool* success) {
+  const char t_a = t_a_str[0];
+  const char t_b = t_b_str[0];
+  const bool trans_a = t_a != 'n' && t_a != 'N';
+  const bool trans_b = t_b != 'n' && t_b != 'N';
+
+  // Group g multiplies matrices g * size_step larger than the first group
+  std::vector<char> v_t_a(group_count, t_a);
+  std::vector<char> v_t_b(group_count, t_b);
+  std::vector<index_t> v_m(group_count), v_n(group_count), v_k(group_count);
+  std::vector<index_t> v_lda(group_count), v_ldb(group_count),
+      v_ldc(group_count);
+  std::vector<scalar_t> v_alpha(group_count, alpha);
+  std::vector<scalar_t> v_beta(group_count, beta);
+  std::vector<index_t> v_group_size(group_count, group_size);
+  // Offsets of the matrices of every product in the A, B and C allocations
+  std::vector<size_t> offset_a, offset_b, offset_c;
+  size_t size_a = 0, size_b = 0, size_c = 0;
+
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double n_fl_ops = 0;
+  double bytes_processed = 0;
+  for (index_t g = 0; g < group_count; g++) {
+    v_m[g] = m + g * size_step;
+    v_n[g] = n + g * size_step;
+    v_k[g] = k + g * size_step;
+    v_lda[g] = trans_a ? v_k[g] : v_m[g];
+    v_ldb[g] = trans_b ? v_n[g] : v_k[g];
+    v_ldc[g] = v_m[g];
+    const double m_d = static_cast<double>(v_m[g]);
+    const double n_d = static_cast<double>(v_n[g]);
+    const double k_d = static_cast<double>(v_k[g]);
+    const double group_size_d = static_cast<double>(group_size);
+    n_fl_ops +=
+        group_size_d *
+        (2 * m_d * n_d * k_d + (beta != scalar_t{0} ? 3 : 1) * m_d * n_d);
+    bytes_processed +=
+        group_size_d *
+        (m_d * k_d + k_d * n_d + (beta != scalar_t{0} ? 2 : 1) * m_d * n_d) *
+        sizeof(scalar_t);
+    for (index_t p = 0; p < group_size; p++) {
+      offset_a.push_back(size_a);
+      offset_b.push_back(size_b);
+      offset_c.push_back(size_c);
+      size_a += static_cast<size_t>(v_m[g]) * v_k[g];
+      size_b += static_cast<size_t>(v_k[g]) * v_n[g];
+      size_c += static_cast<size_t>(v_m[g]) * v_n[g];
+    }
+  }
+  const size_t num_products = offset_a.size();
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(size_a);
+  std::vector<scalar_t> m_b = utils::random_data<scalar_t>(size_b);
+  std::vector<scalar_t> m_c = utils::random_data<scalar_t>(size_c);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto m_b_gpu = utils::make_device_copy<mem_alloc>(q, m_b);
+  auto m_c_gpu = utils::make_device_copy<mem_alloc>(q, m_c);
+
+  // The kernel reads the pointers to the matrices from device arrays
+  auto make_pointers = [&](scalar_t* base, const std::vector<size_t>& offset) {
+    std::vector<scalar_t*> pointers(num_products);
+    for (size_t p = 0; p < num_products; p++) {
+      pointers[p] = base + offset[p];
+    }
+    return utils::make_device_copy<mem_alloc>(q, pointers);
+  };
+  auto a_ptrs_gpu = make_pointers(m_a_gpu, offset_a);
+  auto b_ptrs_gpu = make_pointers(m_b_gpu, offset_b);
+  auto c_ptrs_gpu = make_pointers(m_c_gpu, offset_c);
+
+  auto gemm_batch = [&](scalar_t** c_ptrs) {
+    return blas::_gemm_batch(sb_handle, v_t_a.data(), v_t_b.data(),
+                             v_m.data(), v_n.data(), v_k.data(),
+                             v_alpha.data(), a_ptrs_gpu, v_lda.data(),
+                             b_ptrs_gpu, v_ldb.data(), v_beta.data(), c_ptrs,
+                             v_ldc.data(), group_count, v_group_size.data());
+  };
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref = m_c;
+  for (index_t g = 0, p = 0; g < group_count; g++) {
+    for (index_t i = 0; i < group_size; i++, p++) {
+      reference_blas::gemm(t_a, t_b, v_m[g], v_n[g], v_k[g], alpha,
+                           m_a.data() + offset_a[p], v_lda[g],
+                           m_b.data() + offset_b[p], v_ldb[g], beta,
+                           c_ref.data() + offset_c[p], v_ldc[g]);
+    }
+  }
+  std::vector<scalar_t> c_temp = m_c;
+  {
+    auto c_temp_gpu = utils::make_device_copy<mem_alloc>(q, c_temp);
+    auto c_temp_ptrs_gpu = make_pointers(c_temp_gpu, offset_c);
+    auto event = gemm_batch(c_temp_ptrs_gpu);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, c_temp_gpu, c_temp.data(), c_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(c_temp_ptrs_gpu, q);
+    blas::helper::deallocate<mem_alloc>(c_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(c_temp, c_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return gemm_batch(c_ptrs_gpu);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(a_ptrs_gpu, q);
+  blas::helper::deallocate<mem_alloc>(b_ptrs_gpu, q);
+  blas::helper::deallocate<mem_alloc>(c_ptrs_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_b_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_c_gpu, q);
+}
+#endif  // SB_ENABLE_USM
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+#ifdef SB_ENABLE_USM
+  // The grouped gemm takes arrays of USM pointers, it has no buffer version
+  constexpr auto mem_alloc = blas::helper::AllocType::usm;
+  auto params = utils::get_gemm_batch_params<scalar_t>(args);
+  for (auto p : params) {
+    std::string t_a_str;
+    std::string t_b_str;
+    index_t m;
+    index_t n;
+    index_t k;
+    scalar_t alpha;
+    scalar_t beta;
+    index_t group_count;
+    index_t group_size;
+    index_t size_step;
+    std::tie(t_a_str, t_b_str, m, n, k, alpha, beta, group_count, group_size,
+             size_step) = p;
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         std::string t_a_str, std::string t_b_str, index_t m,
+                         index_t n, index_t k, scalar_t alpha, scalar_t beta,
+                         index_t group_count, index_t group_size,
+                         index_t size_step, bool* success) {
+      run<scalar_t, mem_alloc>(st, sb_handle_ptr, t_a_str, t_b_str, m, n, k,
+                               alpha, beta, group_count, group_size, size_step,
+                               success);
+    };
+    benchmark::RegisterBenchmark(
+        utils::get_name<scalar_t>("GemmBatch", t_a_str, t_b_str, m, n, k,
+                                  alpha, beta, group_count, group_size,
+                                  size_step, "usm")
+            .c_str(),
+        BM_lambda, sb_handle_ptr, t_a_str, t_b_str, m, n, k, alpha, beta,
+        group_count, group_size, size_step, success)
+        ->UseManualTime();
+  }
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,178 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+#ifdef SB_ENABLE_USM
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string t_a_str, std::string t_b_str, index_t m, index_t n,
+         index_t k, scalar_t alpha, scalar_t beta, index_t batch_size,
+         bool* success) {
+  const char t_a = t_a_str[0];
+  const char t_b = t_b_str[0];
+
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double m_d = static_cast<double>(m);
+  const double n_d = static_cast<double>(n);
+  const double k_d = static_cast<double>(k);
+  const double batch_size_d = static_cast<double>(batch_size);
+  const double n_fl_ops =
+      batch_size_d *
+      (2 * m_d * n_d * k_d + (beta != scalar_t{0} ? 3 : 1) * m_d * n_d);
+  const double bytes_processed =
+      batch_size_d *
+      (m_d * k_d + k_d * n_d + (beta != scalar_t{0} ? 2 : 1) * m_d * n_d) *
+      sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data, every matrix in its own allocation
+  const index_t lda = (t_a == 'n' || t_a == 'N') ? m : k;
+  const index_t ldb = (t_b == 'n' || t_b == 'N') ? k : n;
+  const index_t ldc = m;
+  std::vector<std::vector<scalar_t>> m_a(batch_size), m_b(batch_size),
+      m_c(batch_size);
+  std::vector<scalar_t*> a_ptrs(batch_size), b_ptrs(batch_size),
+      c_ptrs(batch_size);
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    m_a[batch] = utils::random_data<scalar_t>(m * k);
+    m_b[batch] = utils::random_data<scalar_t>(k * n);
+    m_c[batch] = utils::random_data<scalar_t>(m * n);
+    a_ptrs[batch] = utils::make_device_copy<mem_alloc>(q, m_a[batch]);
+    b_ptrs[batch] = utils::make_device_copy<mem_alloc>(q, m_b[batch]);
+    c_ptrs[batch] = utils::make_device_copy<mem_alloc>(q, m_c[batch]);
+  }
+  // The kernel reads the pointers to the matrices from device arrays
+  auto a_ptrs_gpu = utils::make_device_copy<mem_alloc>(q, a_ptrs);
+  auto b_ptrs_gpu = utils::make_device_copy<mem_alloc>(q, b_ptrs);
+  auto c_ptrs_gpu = utils::make_device_copy<mem_alloc>(q, c_ptrs);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t*> c_temp_ptrs(batch_size);
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    c_temp_ptrs[batch] = utils::make_device_copy<mem_alloc>(q, m_c[batch]);
+  }
+  auto c_temp_ptrs_gpu = utils::make_device_copy<mem_alloc>(q, c_temp_ptrs);
+  auto event = blas::_gemm_batch(sb_handle, t_a, t_b, m, n, k, alpha,
+                                 a_ptrs_gpu, lda, b_ptrs_gpu, ldb, beta,
+                                 c_temp_ptrs_gpu, ldc, batch_size);
+  sb_handle.wait(event);
+  bool correct = true;
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    std::vector<scalar_t> c_ref = m_c[batch];
+    reference_blas::gemm(t_a, t_b, m, n, k, alpha, m_a[batch].data(), lda,
+                         m_b[batch].data(), ldb, beta, c_ref.data(), ldc);
+    std::vector<scalar_t> c_temp(c_ref.size());
+    blas::helper::copy_to_host(q, c_temp_ptrs[batch], c_temp.data(),
+                               c_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(c_temp_ptrs[batch], q);
+    correct = utils::compare_vectors(c_temp, c_ref) && correct;
+  }
+  blas::helper::deallocate<mem_alloc>(c_temp_ptrs_gpu, q);
+  if (!correct) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_gemm_batch(sb_handle, t_a, t_b, m, n, k, alpha, a_ptrs_gpu,
+                             lda, b_ptrs_gpu, ldb, beta, c_ptrs_gpu, ldc,
+                             batch_size);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(a_ptrs_gpu, q);
+  blas::helper::deallocate<mem_alloc>(b_ptrs_gpu, q);
+  blas::helper::deallocate<mem_alloc>(c_ptrs_gpu, q);
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    blas::helper::deallocate<mem_alloc>(a_ptrs[batch], q);
+    blas::helper::deallocate<mem_alloc>(b_ptrs[batch], q);
+    blas::helper::deallocate<mem_alloc>(c_ptrs[batch], q);
+  }
+}
+#endif  // SB_ENABLE_USM
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+#ifdef SB_ENABLE_USM
+  // The matrices are given by arrays of USM pointers, there is no buffer
+  // version
+  constexpr auto mem_alloc = blas::helper::AllocType::usm;
+  auto params = utils::get_gemm_batch_pointer_array_params<scalar_t>(args);
+  for (auto p : params) {
+    std::string t_a_str;
+    std::string t_b_str;
+    index_t m;
+    index_t n;
+    index_t k;
+    scalar_t alpha;
+    scalar_t beta;
+    index_t batch_size;
+    std::tie(t_a_str, t_b_str, m, n, k, alpha, beta, batch_size) = p;
+    auto BM_lambda = [&](benchmark::State& st, blas::SB_Handle* sb_handle_ptr,
+                         std::string t_a_str, std::string t_b_str, index_t m,
+                         index_t n, index_t k, scalar_t alpha, scalar_t beta,
+                         index_t batch_size, bool* success) {
+      run<scalar_t, mem_alloc>(st, sb_handle_ptr, t_a_str, t_b_str, m, n, k,
+                               alpha, beta, batch_size, success);
+    };
+    benchmark::RegisterBenchmark(
+        utils::get_name<scalar_t>("GemmBatchPointerArray", t_a_str, t_b_str, m,
+                                  n, k, alpha, beta, batch_size, "usm")
+            .c_str(),
+        BM_lambda, sb_handle_ptr, t_a_str, t_b_str, m, n, k, alpha, beta,
+        batch_size, success)
+        ->UseManualTime();
+  }
+#endif
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
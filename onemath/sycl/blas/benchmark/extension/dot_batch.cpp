@@ -0,0 +1,144 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t n,
+         index_t inc_x, index_t inc_y, index_t stride_x_mul,
+         index_t stride_y_mul, index_t batch_size, bool* success) {
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double n_d = static_cast<double>(n);
+  const double batch_size_d = static_cast<double>(batch_size);
+  const double n_fl_ops = batch_size_d * 2 * n_d;
+  const double bytes_processed =
+      batch_size_d * (2 * n_d + 1) * sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t stride_x = n * std::abs(inc_x) * stride_x_mul;
+  const index_t stride_y = n * std::abs(inc_y) * stride_y_mul;
+  std::vector<scalar_t> v_x =
+      utils::random_data<scalar_t>(stride_x * batch_size);
+  std::vector<scalar_t> v_y =
+      utils::random_data<scalar_t>(stride_y * batch_size);
+  std::vector<scalar_t> v_r(batch_size, scalar_t{0});
+
+  auto v_x_gpu = utils::make_device_copy<mem_alloc>(q, v_x);
+  auto v_y_gpu = utils::make_device_copy<mem_alloc>(q, v_y);
+  auto v_r_gpu = utils::make_device_copy<mem_alloc>(q, v_r);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> r_ref(batch_size);
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    r_ref[batch] =
+        reference_blas::dot(n, v_x.data() + batch * stride_x, inc_x,
+                            v_y.data() + batch * stride_y, inc_y);
+  }
+  {
+    auto event =
+        blas::_dot_batch(sb_handle, n, v_x_gpu, inc_x, stride_x, v_y_gpu,
+                         inc_y, stride_y, v_r_gpu, batch_size);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, v_r_gpu, v_r.data(), v_r.size()).wait();
+  }
+  if (!utils::compare_vectors(v_r, r_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_dot_batch(sb_handle, n, v_x_gpu, inc_x, stride_x, v_y_gpu,
+                            inc_y, stride_y, v_r_gpu, batch_size);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(v_x_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_y_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_r_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_dot_batch_params(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          index_t n;
+          index_t inc_x;
+          index_t inc_y;
+          index_t stride_x_mul;
+          index_t stride_y_mul;
+          index_t batch_size;
+          std::tie(n, inc_x, inc_y, stride_x_mul, stride_y_mul, batch_size) =
+              p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr, index_t n,
+                               index_t inc_x, index_t inc_y,
+                               index_t stride_x_mul, index_t stride_y_mul,
+                               index_t batch_size, bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, n, inc_x, inc_y,
+                                     stride_x_mul, stride_y_mul, batch_size,
+                                     success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("DotBatch", n, inc_x, inc_y,
+                                        stride_x_mul, stride_y_mul, batch_size,
+                                        mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, n, inc_x, inc_y, stride_x_mul,
+              stride_y_mul, batch_size, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,307 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+inline blas::gemm_bias_t get_bias(const std::string& bias_str) {
+  if (bias_str == "row") {
+    return blas::gemm_bias_t::row;
+  } else if (bias_str == "column") {
+    return blas::gemm_bias_t::column;
+  }
+  return blas::gemm_bias_t::none;
+}
+
+inline blas::gemm_activation_t get_activation(
+    const std::string& activation_str) {
+  if (activation_str == "relu") {
+    return blas::gemm_activation_t::relu;
+  } else if (activation_str == "gelu") {
+    return blas::gemm_activation_t::gelu;
+  } else if (activation_str == "clamp") {
+    return blas::gemm_activation_t::clamp;
+  }
+  return blas::gemm_activation_t::none;
+}
+
+/**
+ * @brief Calls _gemm_epilogue with the bias, activation and residual given at
+ * run time, which the operator takes as template parameters.
+ */
+template <blas::gemm_bias_t bias, blas::gemm_activation_t activation,
+          typename scalar_t, typename container_t>
+std::vector<sycl::event> launch_gemm_epilogue(
+    blas::SB_Handle& sb_handle, bool residual, char t_a, char t_b, index_t m,
+    index_t n, index_t k, scalar_t alpha, container_t a, index_t lda,
+    container_t b, index_t ldb, scalar_t beta, container_t c, index_t ldc,
+    container_t bias_v, container_t r, index_t ldr, scalar_t scale,
+    scalar_t clamp_min, scalar_t clamp_max) {
+  if (residual) {
+    return blas::_gemm_epilogue<bias, activation, true>(
+        sb_handle, t_a, t_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+        bias_v, r, ldr, scale, clamp_min, clamp_max);
+  }
+  return blas::_gemm_epilogue<bias, activation, false>(
+      sb_handle, t_a, t_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+      bias_v, r, ldr, scale, clamp_min, clamp_max);
+}
+
+template <blas::gemm_bias_t bias, typename... args_t>
+std::vector<sycl::event> launch_with_activation(
+    blas::gemm_activation_t activation, args_t&&... args) {
+  switch (activation) {
+    case blas::gemm_activation_t::relu:
+      return launch_gemm_epilogue<bias, blas::gemm_activation_t::relu>(
+          std::forward<args_t>(args)...);
+    case blas::gemm_activation_t::gelu:
+      return launch_gemm_epilogue<bias, blas::gemm_activation_t::gelu>(
+          std::forward<args_t>(args)...);
+    case blas::gemm_activation_t::clamp:
+      return launch_gemm_epilogue<bias, blas::gemm_activation_t::clamp>(
+          std::forward<args_t>(args)...);
+    default:
+      return launch_gemm_epilogue<bias, blas::gemm_activation_t::none>(
+          std::forward<args_t>(args)...);
+  }
+}
+
+template <typename... args_t>
+std::vector<sycl::event> launch_with_bias(blas::gemm_bias_t bias,
+                                          blas::gemm_activation_t activation,
+                                          args_t&&... args) {
+  switch (bias) {
+    case blas::gemm_bias_t::row:
+      return launch_with_activation<blas::gemm_bias_t::row>(
+          activation, std::forward<args_t>(args)...);
+    case blas::gemm_bias_t::column:
+      return launch_with_activation<blas::gemm_bias_t::column>(
+          activation, std::forward<args_t>(args)...);
+    default:
+      return launch_with_activation<blas::gemm_bias_t::none>(
+          activation, std::forward<args_t>(args)...);
+  }
+}
+
+#ifdef BLAS_VERIFY_BENCHMARK
+/**
+ * @brief Applies the epilogue to the result c of the reference gemm.
+ */
+template <typename scalar_t>
+void reference_epilogue(blas::gemm_bias_t bias,
+                        blas::gemm_activation_t activation, bool residual,
+                        index_t m, index_t n, const scalar_t* bias_v,
+                        const scalar_t* r, index_t ldr, scalar_t scale,
+                        scalar_t clamp_min, scalar_t clamp_max, scalar_t* c,
+                        index_t ldc) {
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < m; i++) {
+      scalar_t value = c[i + j * ldc];
+      if (bias == blas::gemm_bias_t::row) {
+        value += bias_v[i];
+      } else if (bias == blas::gemm_bias_t::column) {
+        value += bias_v[j];
+      }
+      if (activation == blas::gemm_activation_t::relu) {
+        value = std::max(value, scalar_t{0});
+      } else if (activation == blas::gemm_activation_t::gelu) {
+        const scalar_t inner = scalar_t{0.7978845608028654} *
+                               (value + scalar_t{0.044715} * value * value *
+                                            value);
+        value = scalar_t{0.5} * value * (scalar_t{1} + std::tanh(inner));
+      } else if (activation == blas::gemm_activation_t::clamp) {
+        value = std::min(std::max(value, clamp_min), clamp_max);
+      }
+      value *= scale;
+      if (residual) {
+        value += r[i + j * ldr];
+      }
+      c[i + j * ldc] = value;
+    }
+  }
+}
+#endif
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string t_a_str, std::string t_b_str, index_t m, index_t n,
+         index_t k, scalar_t alpha, scalar_t beta, std::string bias_str,
+         std::string activation_str, index_t residual_int, bool* success) {
+  const char t_a = t_a_str[0];
+  const char t_b = t_b_str[0];
+  const blas::gemm_bias_t bias = get_bias(bias_str);
+  const blas::gemm_activation_t activation = get_activation(activation_str);
+  const bool residual = residual_int != 0;
+  const scalar_t scale{0.5};
+  const scalar_t clamp_min{-0.5};
+  const scalar_t clamp_max{0.5};
+
+  // The counters are double. We convert m, n and k to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double m_d = static_cast<double>(m);
+  const double n_d = static_cast<double>(n);
+  const double k_d = static_cast<double>(k);
+  const double bias_size_d =
+      bias == blas::gemm_bias_t::row
+          ? m_d
+          : (bias == blas::gemm_bias_t::column ? n_d : 0);
+  // The bias, the activation, the scale and the residual count as one
+  // operation per element of C each
+  const double epilogue_ops =
+      (bias != blas::gemm_bias_t::none ? 1 : 0) +
+      (activation != blas::gemm_activation_t::none ? 1 : 0) + 1 +
+      (residual ? 1 : 0);
+  const double n_fl_ops = 2 * m_d * n_d * k_d +
+                          (beta != scalar_t{0} ? 3 : 1) * m_d * n_d +
+                          epilogue_ops * m_d * n_d;
+  const double bytes_processed =
+      (m_d * k_d + k_d * n_d + (beta != scalar_t{0} ? 2 : 1) * m_d * n_d +
+       bias_size_d + (residual ? m_d * n_d : 0)) *
+      sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t lda = (t_a == 'n' || t_a == 'N') ? m : k;
+  const index_t ldb = (t_b == 'n' || t_b == 'N') ? k : n;
+  const index_t ldc = m;
+  const index_t ldr = m;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(m * k);
+  std::vector<scalar_t> m_b = utils::random_data<scalar_t>(k * n);
+  std::vector<scalar_t> m_c = utils::random_data<scalar_t>(m * n);
+  // The bias is sized for both kinds, only the first m or n are read
+  std::vector<scalar_t> v_bias = utils::random_data<scalar_t>(std::max(m, n));
+  std::vector<scalar_t> m_r = utils::random_data<scalar_t>(m * n);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto m_b_gpu = utils::make_device_copy<mem_alloc>(q, m_b);
+  auto m_c_gpu = utils::make_device_copy<mem_alloc>(q, m_c);
+  auto v_bias_gpu = utils::make_device_copy<mem_alloc>(q, v_bias);
+  auto m_r_gpu = utils::make_device_copy<mem_alloc>(q, m_r);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> c_ref = m_c;
+  reference_blas::gemm(t_a, t_b, m, n, k, alpha, m_a.data(), lda, m_b.data(),
+                       ldb, beta, c_ref.data(), ldc);
+  reference_epilogue(bias, activation, residual, m, n, v_bias.data(),
+                     m_r.data(), ldr, scale, clamp_min, clamp_max,
+                     c_ref.data(), ldc);
+  std::vector<scalar_t> c_temp = m_c;
+  {
+    auto c_temp_gpu = utils::make_device_copy<mem_alloc>(q, c_temp);
+    auto event = launch_with_bias(
+        bias, activation, sb_handle, residual, t_a, t_b, m, n, k, alpha,
+        m_a_gpu, lda, m_b_gpu, ldb, beta, c_temp_gpu, ldc, v_bias_gpu,
+        m_r_gpu, ldr, scale, clamp_min, clamp_max);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, c_temp_gpu, c_temp.data(), c_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(c_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(c_temp, c_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return launch_with_bias(
+        bias, activation, sb_handle, residual, t_a, t_b, m, n, k, alpha,
+        m_a_gpu, lda, m_b_gpu, ldb, beta, m_c_gpu, ldc, v_bias_gpu, m_r_gpu,
+        ldr, scale, clamp_min, clamp_max);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_b_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_c_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_bias_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_r_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_gemm_epilogue_params<scalar_t>(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string t_a_str;
+          std::string t_b_str;
+          index_t m;
+          index_t n;
+          index_t k;
+          scalar_t alpha;
+          scalar_t beta;
+          std::string bias_str;
+          std::string activation_str;
+          index_t residual;
+          std::tie(t_a_str, t_b_str, m, n, k, alpha, beta, bias_str,
+                   activation_str, residual) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string t_a_str, std::string t_b_str,
+                               index_t m, index_t n, index_t k, scalar_t alpha,
+                               scalar_t beta, std::string bias_str,
+                               std::string activation_str, index_t residual,
+                               bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, t_a_str, t_b_str, m, n,
+                                     k, alpha, beta, bias_str, activation_str,
+                                     residual, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("GemmEpilogue", t_a_str, t_b_str, m,
+                                        n, k, alpha, beta, bias_str,
+                                        activation_str, residual, mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, t_a_str, t_b_str, m, n, k, alpha, beta,
+              bias_str, activation_str, residual, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,168 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string trans_str, index_t m, index_t n, scalar_t alpha,
+         index_t ld_in_mul, index_t ld_out_mul, index_t stride_in_mul,
+         index_t stride_out_mul, index_t batch_size, bool* success) {
+  const char trans = trans_str[0];
+
+  // The counters are double. We convert the sizes to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  const double m_d = static_cast<double>(m);
+  const double n_d = static_cast<double>(n);
+  const double batch_size_d = static_cast<double>(batch_size);
+  const double n_fl_ops = batch_size_d * m_d * n_d;
+  const double bytes_processed =
+      batch_size_d * 2 * m_d * n_d * sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const bool is_trans = trans == 't' || trans == 'T';
+  const index_t out_rows = is_trans ? n : m;
+  const index_t out_cols = is_trans ? m : n;
+  const index_t ld_in = m * ld_in_mul;
+  const index_t ld_out = out_rows * ld_out_mul;
+  // The same stride is used for the input and the output matrices, it has to
+  // fit the largest of the two
+  const index_t stride =
+      std::max(ld_in * n * stride_in_mul, ld_out * out_cols * stride_out_mul);
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(stride * batch_size);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  // Only the elements of the output matrices are compared since the
+  // padding is left unspecified by the in-place copy
+  std::vector<scalar_t> out_ref(out_rows * out_cols * batch_size);
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    reference_blas::omatcopy(trans, m, n, alpha, m_a.data() + batch * stride,
+                             ld_in, 1,
+                             out_ref.data() + batch * out_rows * out_cols,
+                             out_rows, 1);
+  }
+  std::vector<scalar_t> a_temp = m_a;
+  {
+    auto a_temp_gpu = utils::make_device_copy<mem_alloc>(q, a_temp);
+    auto event =
+        blas::_imatcopy_batch(sb_handle, trans, m, n, alpha, a_temp_gpu,
+                              ld_in, ld_out, stride, batch_size);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, a_temp_gpu, a_temp.data(), a_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(a_temp_gpu, q);
+  }
+  std::vector<scalar_t> out_temp(out_ref.size());
+  for (index_t batch = 0; batch < batch_size; batch++) {
+    for (index_t j = 0; j < out_cols; j++) {
+      for (index_t i = 0; i < out_rows; i++) {
+        out_temp[i + j * out_rows + batch * out_rows * out_cols] =
+            a_temp[i + j * ld_out + batch * stride];
+      }
+    }
+  }
+  if (!utils::compare_vectors(out_temp, out_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_imatcopy_batch(sb_handle, trans, m, n, alpha, m_a_gpu, ld_in,
+                                 ld_out, stride, batch_size);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_matcopy_batch_params<scalar_t>(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string trans_str;
+          index_t m;
+          index_t n;
+          scalar_t alpha;
+          index_t ld_in_mul;
+          index_t ld_out_mul;
+          index_t stride_in_mul;
+          index_t stride_out_mul;
+          index_t batch_size;
+          std::tie(trans_str, m, n, alpha, ld_in_mul, ld_out_mul, stride_in_mul,
+                   stride_out_mul, batch_size) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string trans_str, index_t m, index_t n,
+                               scalar_t alpha, index_t ld_in_mul,
+                               index_t ld_out_mul, index_t stride_in_mul,
+                               index_t stride_out_mul, index_t batch_size,
+                               bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, trans_str, m, n, alpha,
+                                     ld_in_mul, ld_out_mul, stride_in_mul,
+                                     stride_out_mul, batch_size, success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("ImatcopyBatch", trans_str, m, n, alpha,
+                                        ld_in_mul, ld_out_mul, stride_in_mul,
+                                        stride_out_mul, batch_size, mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, trans_str, m, n, alpha, ld_in_mul,
+              ld_out_mul, stride_in_mul, stride_out_mul, batch_size, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,147 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr,
+         std::string trans_str, index_t m, index_t n, scalar_t alpha,
+         index_t ld_in_mul, index_t ld_out_mul, index_t inc_in, index_t inc_out,
+         bool* success) {
+  const char trans = trans_str[0];
+
+  // The counters are double. We convert m and n to double to avoid integer
+  // overflows for n_fl_ops and bytes_processed
+  const double m_d = static_cast<double>(m);
+  const double n_d = static_cast<double>(n);
+  const double n_fl_ops = m_d * n_d;
+  const double bytes_processed = 2 * m_d * n_d * sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const bool is_trans = trans == 't' || trans == 'T';
+  const index_t out_rows = is_trans ? n : m;
+  const index_t out_cols = is_trans ? m : n;
+  const index_t ld_in = m * inc_in * ld_in_mul;
+  const index_t ld_out = out_rows * inc_out * ld_out_mul;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(ld_in * n);
+  std::vector<scalar_t> m_b = utils::random_data<scalar_t>(ld_out * out_cols);
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto m_b_gpu = utils::make_device_copy<mem_alloc>(q, m_b);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> b_ref = m_b;
+  reference_blas::omatcopy(trans, m, n, alpha, m_a.data(), ld_in, inc_in,
+                           b_ref.data(), ld_out, inc_out);
+  std::vector<scalar_t> b_temp = m_b;
+  {
+    auto b_temp_gpu = utils::make_device_copy<mem_alloc>(q, b_temp);
+    auto event = blas::_omatcopy2(sb_handle, trans, m, n, alpha, m_a_gpu, ld_in,
+                                  inc_in, b_temp_gpu, ld_out, inc_out);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, b_temp_gpu, b_temp.data(), b_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(b_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(b_temp, b_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::_omatcopy2(sb_handle, trans, m, n, alpha, m_a_gpu, ld_in,
+                            inc_in, m_b_gpu, ld_out, inc_out);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(m_b_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_matcopy2_params<scalar_t>(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          std::string trans_str;
+          index_t m;
+          index_t n;
+          scalar_t alpha;
+          index_t ld_in_mul;
+          index_t ld_out_mul;
+          index_t inc_in;
+          index_t inc_out;
+          std::tie(trans_str, m, n, alpha, ld_in_mul, ld_out_mul, inc_in,
+                   inc_out) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr,
+                               std::string trans_str, index_t m, index_t n,
+                               scalar_t alpha, index_t ld_in_mul,
+                               index_t ld_out_mul, index_t inc_in,
+                               index_t inc_out, bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, trans_str, m, n, alpha,
+                                     ld_in_mul, ld_out_mul, inc_in, inc_out,
+                                     success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Omatcopy2", trans_str, m, n, alpha,
+                                        ld_in_mul, ld_out_mul, inc_in, inc_out,
+                                        mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, trans_str, m, n, alpha, ld_in_mul,
+              ld_out_mul, inc_in, inc_out, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,140 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "reference_blas.hpp"
+#include "utils.hpp"
+
+namespace utils = blas_benchmark::utils;
+using index_t = utils::index_t;
+
+template <typename scalar_t, blas::helper::AllocType mem_alloc>
+void run(benchmark::State& state, blas::SB_Handle* sb_handle_ptr, index_t rows,
+         index_t cols, std::string dim_str, bool* success) {
+  const blas::reduction_dim_t dim = dim_str == "outer"
+                                        ? blas::reduction_dim_t::outer
+                                        : blas::reduction_dim_t::inner;
+  // Outer reductions sum the rows, inner reductions sum the columns
+  const index_t out_size = dim == blas::reduction_dim_t::outer ? rows : cols;
+
+  // The counters are double. We convert the sizes to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  const double rows_d = static_cast<double>(rows);
+  const double cols_d = static_cast<double>(cols);
+  const double n_fl_ops = rows_d * cols_d;
+  const double bytes_processed =
+      (rows_d * cols_d + static_cast<double>(out_size)) * sizeof(scalar_t);
+
+  utils::init_counters(state);
+
+  blas::SB_Handle& sb_handle = *sb_handle_ptr;
+  auto q = sb_handle.get_queue();
+
+  // Create data
+  const index_t ld = rows;
+  std::vector<scalar_t> m_a = utils::random_data<scalar_t>(ld * cols);
+  std::vector<scalar_t> v_out(out_size, scalar_t{0});
+
+  auto m_a_gpu = utils::make_device_copy<mem_alloc>(q, m_a);
+  auto v_out_gpu = utils::make_device_copy<mem_alloc>(q, v_out);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<scalar_t> out_ref(out_size, scalar_t{0});
+  for (index_t j = 0; j < cols; j++) {
+    for (index_t i = 0; i < rows; i++) {
+      out_ref[dim == blas::reduction_dim_t::outer ? i : j] += m_a[i + j * ld];
+    }
+  }
+  std::vector<scalar_t> out_temp = v_out;
+  {
+    auto out_temp_gpu = utils::make_device_copy<mem_alloc>(q, out_temp);
+    auto event =
+        blas::extension::_reduction<blas::AddOperator, scalar_t>(
+            sb_handle, m_a_gpu, ld, out_temp_gpu, rows, cols, dim);
+    sb_handle.wait(event);
+    blas::helper::copy_to_host(q, out_temp_gpu, out_temp.data(),
+                               out_temp.size())
+        .wait();
+    blas::helper::deallocate<mem_alloc>(out_temp_gpu, q);
+  }
+  if (!utils::compare_vectors(out_temp, out_ref)) {
+    *success = false;
+    state.SkipWithError("Incorrect result");
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<sycl::event> {
+    return blas::extension::_reduction<blas::AddOperator, scalar_t>(
+        sb_handle, m_a_gpu, ld, v_out_gpu, rows, cols, dim);
+  };
+
+  // Warmup
+  utils::warmup(q, blas_method_def);
+
+  // Measure
+  for (auto _ : state) {
+    std::tuple<double, double> times = utils::timef(q, blas_method_def);
+    utils::update_counters(state, times);
+  }
+
+  utils::calc_avg_counters(state, n_fl_ops, bytes_processed);
+
+  blas::helper::deallocate<mem_alloc>(m_a_gpu, q);
+  blas::helper::deallocate<mem_alloc>(v_out_gpu, q);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args,
+                        blas::SB_Handle* sb_handle_ptr, bool* success) {
+  auto params = utils::get_reduction_params(args);
+  utils::register_all_mem_types(
+      [&](auto mem_alloc_t, const std::string& mem_type) {
+        constexpr auto mem_alloc = decltype(mem_alloc_t)::value;
+        for (auto p : params) {
+          index_t rows;
+          index_t cols;
+          std::string dim_str;
+          std::tie(rows, cols, dim_str) = p;
+          auto BM_lambda = [&](benchmark::State& st,
+                               blas::SB_Handle* sb_handle_ptr, index_t rows,
+                               index_t cols, std::string dim_str,
+                               bool* success) {
+            run<scalar_t, mem_alloc>(st, sb_handle_ptr, rows, cols, dim_str,
+                                     success);
+          };
+          benchmark::RegisterBenchmark(
+              utils::get_name<scalar_t>("Reduction", rows, cols, dim_str,
+                                        mem_type)
+                  .c_str(),
+              BM_lambda, sb_handle_ptr, rows, cols, dim_str, success)
+              ->UseManualTime();
+        }
+      });
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args,
+                      blas::SB_Handle* sb_handle_ptr, bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,680 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BENCHMARK_REFERENCE_BLAS_HPP
+#define ONEMATH_SYCL_BLAS_BENCHMARK_REFERENCE_BLAS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * Naive host implementations of the BLAS operators, used to verify the
+ * results of the benchmarks when BLAS_VERIFY_BENCHMARK is enabled. All the
+ * matrices are column-major. They favour readability over performance.
+ */
+namespace reference_blas {
+
+using index_t = int;
+
+inline bool is_trans(char t) {
+  return t == 't' || t == 'T' || t == 'c' || t == 'C';
+}
+inline bool is_upper(char u) { return u == 'u' || u == 'U'; }
+inline bool is_unit(char d) { return d == 'u' || d == 'U'; }
+inline bool is_left(char s) { return s == 'l' || s == 'L'; }
+
+/* Level 1 */
+
+template <typename scalar_t>
+void axpy(index_t n, scalar_t alpha, const scalar_t* x, index_t incx,
+          scalar_t* y, index_t incy) {
+  for (index_t i = 0; i < n; i++) y[i * incy] += alpha * x[i * incx];
+}
+
+template <typename scalar_t>
+void scal(index_t n, scalar_t alpha, scalar_t* x, index_t incx) {
+  for (index_t i = 0; i < n; i++) x[i * incx] *= alpha;
+}
+
+template <typename scalar_t>
+void copy(index_t n, const scalar_t* x, index_t incx, scalar_t* y,
+          index_t incy) {
+  for (index_t i = 0; i < n; i++) y[i * incy] = x[i * incx];
+}
+
+template <typename scalar_t>
+void swap(index_t n, scalar_t* x, index_t incx, scalar_t* y, index_t incy) {
+  for (index_t i = 0; i < n; i++) std::swap(x[i * incx], y[i * incy]);
+}
+
+template <typename scalar_t>
+scalar_t dot(index_t n, const scalar_t* x, index_t incx, const scalar_t* y,
+             index_t incy) {
+  double acc = 0;
+  for (index_t i = 0; i < n; i++)
+    acc += static_cast<double>(x[i * incx]) * static_cast<double>(y[i * incy]);
+  return static_cast<scalar_t>(acc);
+}
+
+template <typename scalar_t>
+scalar_t sdsdot(index_t n, float sb, const scalar_t* x, index_t incx,
+                const scalar_t* y, index_t incy) {
+  return static_cast<scalar_t>(sb +
+                               static_cast<double>(dot(n, x, incx, y, incy)));
+}
+
+template <typename scalar_t>
+scalar_t asum(index_t n, const scalar_t* x, index_t incx) {
+  double acc = 0;
+  for (index_t i = 0; i < n; i++) acc += std::abs(x[i * incx]);
+  return static_cast<scalar_t>(acc);
+}
+
+template <typename scalar_t>
+scalar_t nrm2(index_t n, const scalar_t* x, index_t incx) {
+  double acc = 0;
+  for (index_t i = 0; i < n; i++)
+    acc += static_cast<double>(x[i * incx]) * static_cast<double>(x[i * incx]);
+  return static_cast<scalar_t>(std::sqrt(acc));
+}
+
+template <bool is_max, typename scalar_t>
+index_t iamax_iamin(index_t n, const scalar_t* x, index_t incx) {
+  index_t idx = 0;
+  for (index_t i = 1; i < n; i++) {
+    const auto v = std::abs(x[i * incx]);
+    const auto best = std::abs(x[idx * incx]);
+    if (is_max ? (v > best) : (v < best)) idx = i;
+  }
+  return idx;
+}
+
+template <typename scalar_t>
+index_t iamax(index_t n, const scalar_t* x, index_t incx) {
+  return iamax_iamin<true>(n, x, incx);
+}
+
+template <typename scalar_t>
+index_t iamin(index_t n, const scalar_t* x, index_t incx) {
+  return iamax_iamin<false>(n, x, incx);
+}
+
+template <typename scalar_t>
+void rot(index_t n, scalar_t* x, index_t incx, scalar_t* y, index_t incy,
+         scalar_t c, scalar_t s) {
+  for (index_t i = 0; i < n; i++) {
+    const scalar_t xi = x[i * incx];
+    const scalar_t yi = y[i * incy];
+    x[i * incx] = c * xi + s * yi;
+    y[i * incy] = c * yi - s * xi;
+  }
+}
+
+template <typename scalar_t>
+void rotm(index_t n, scalar_t* x, index_t incx, scalar_t* y, index_t incy,
+          const scalar_t* param) {
+  const scalar_t flag = param[0];
+  scalar_t h11, h21, h12, h22;
+  if (flag == scalar_t{-2}) {
+    return;
+  } else if (flag == scalar_t{-1}) {
+    h11 = param[1], h21 = param[2], h12 = param[3], h22 = param[4];
+  } else if (flag == scalar_t{0}) {
+    h11 = 1, h21 = param[2], h12 = param[3], h22 = 1;
+  } else {
+    h11 = param[1], h21 = -1, h12 = 1, h22 = param[4];
+  }
+  for (index_t i = 0; i < n; i++) {
+    const scalar_t xi = x[i * incx];
+    const scalar_t yi = y[i * incy];
+    x[i * incx] = h11 * xi + h12 * yi;
+    y[i * incy] = h21 * xi + h22 * yi;
+  }
+}
+
+template <typename scalar_t>
+void rotg(scalar_t& a, scalar_t& b, scalar_t& c, scalar_t& s) {
+  const scalar_t abs_a = std::abs(a);
+  const scalar_t abs_b = std::abs(b);
+  const scalar_t roe = abs_a > abs_b ? a : b;
+  const scalar_t scale = abs_a + abs_b;
+  if (scale == scalar_t{0}) {
+    c = 1, s = 0, a = 0, b = 0;
+    return;
+  }
+  scalar_t r = scale * std::sqrt((a / scale) * (a / scale) +
+                                 (b / scale) * (b / scale));
+  r = std::copysign(r, roe);
+  c = a / r;
+  s = b / r;
+  scalar_t z = 1;
+  if (abs_a > abs_b) {
+    z = s;
+  } else if (c != scalar_t{0}) {
+    z = scalar_t{1} / c;
+  }
+  a = r;
+  b = z;
+}
+
+/*!
+ * @brief Modified Givens rotation setup, following the reference netlib
+ * implementation.
+ */
+template <typename scalar_t>
+void rotmg(scalar_t& d1, scalar_t& d2, scalar_t& x1, scalar_t y1,
+           scalar_t* param) {
+  const scalar_t gam = 4096, gamsq = gam * gam, rgamsq = 1 / gamsq;
+  scalar_t flag, h11 = 0, h12 = 0, h21 = 0, h22 = 0;
+  if (d1 < 0) {
+    flag = -1;
+    d1 = d2 = x1 = 0;
+  } else {
+    const scalar_t p2 = d2 * y1;
+    if (p2 == 0) {
+      param[0] = -2;
+      return;
+    }
+    const scalar_t p1 = d1 * x1;
+    const scalar_t q2 = p2 * y1;
+    const scalar_t q1 = p1 * x1;
+    if (std::abs(q1) > std::abs(q2)) {
+      h21 = -y1 / x1;
+      h12 = p2 / p1;
+      const scalar_t u = 1 - h12 * h21;
+      if (u > 0) {
+        flag = 0;
+        d1 /= u;
+        d2 /= u;
+        x1 *= u;
+      } else {
+        flag = -1;
+        h11 = h12 = h21 = h22 = 0;
+        d1 = d2 = x1 = 0;
+      }
+    } else {
+      if (q2 < 0) {
+        flag = -1;
+        h11 = h12 = h21 = h22 = 0;
+        d1 = d2 = x1 = 0;
+      } else {
+        flag = 1;
+        h11 = p1 / p2;
+        h22 = x1 / y1;
+        const scalar_t u = 1 + h11 * h22;
+        const scalar_t temp = d2 / u;
+        d2 = d1 / u;
+        d1 = temp;
+        x1 = y1 * u;
+      }
+    }
+    if (d1 != 0) {
+      while (d1 <= rgamsq || d1 >= gamsq) {
+        if (flag == 0) {
+          h11 = 1, h22 = 1, flag = -1;
+        } else {
+          h21 = -1, h12 = 1, flag = -1;
+        }
+        if (d1 <= rgamsq) {
+          d1 *= gam * gam, x1 /= gam, h11 /= gam, h12 /= gam;
+        } else {
+          d1 /= gam * gam, x1 *= gam, h11 *= gam, h12 *= gam;
+        }
+      }
+    }
+    if (d2 != 0) {
+      while (std::abs(d2) <= rgamsq || std::abs(d2) >= gamsq) {
+        if (flag == 0) {
+          h11 = 1, h22 = 1, flag = -1;
+        } else {
+          h21 = -1, h12 = 1, flag = -1;
+        }
+        if (std::abs(d2) <= rgamsq) {
+          d2 *= gam * gam, h21 /= gam, h22 /= gam;
+        } else {
+          d2 /= gam * gam, h21 *= gam, h22 *= gam;
+        }
+      }
+    }
+  }
+  param[0] = flag;
+  if (flag < 0) {
+    param[1] = h11, param[2] = h21, param[3] = h12, param[4] = h22;
+  } else if (flag == 0) {
+    param[2] = h21, param[3] = h12;
+  } else {
+    param[1] = h11, param[4] = h22;
+  }
+}
+
+/* Storage conversion helpers, producing dense n x n column-major matrices */
+
+template <typename scalar_t>
+std::vector<scalar_t> triangular_to_dense(char uplo, char diag, index_t n,
+                                          const scalar_t* a, index_t lda) {
+  std::vector<scalar_t> t(static_cast<size_t>(n) * n, scalar_t{0});
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < n; i++) {
+      if (i == j) {
+        t[i + j * n] = is_unit(diag) ? scalar_t{1} : a[i + j * lda];
+      } else if (is_upper(uplo) ? (i < j) : (i > j)) {
+        t[i + j * n] = a[i + j * lda];
+      }
+    }
+  }
+  return t;
+}
+
+template <typename scalar_t>
+std::vector<scalar_t> symmetric_to_dense(char uplo, index_t n,
+                                         const scalar_t* a, index_t lda) {
+  std::vector<scalar_t> s(static_cast<size_t>(n) * n);
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < n; i++) {
+      const bool stored = is_upper(uplo) ? (i <= j) : (i >= j);
+      s[i + j * n] = stored ? a[i + j * lda] : a[j + i * lda];
+    }
+  }
+  return s;
+}
+
+/*!
+ * @brief Unpacks a triangle stored in band format (k super/sub diagonals)
+ * into the corresponding triangle of a dense matrix.
+ */
+template <typename scalar_t>
+std::vector<scalar_t> band_to_dense(char uplo, index_t n, index_t k,
+                                    const scalar_t* a, index_t lda) {
+  std::vector<scalar_t> d(static_cast<size_t>(n) * n, scalar_t{0});
+  for (index_t j = 0; j < n; j++) {
+    if (is_upper(uplo)) {
+      for (index_t i = std::max(0, j - k); i <= j; i++)
+        d[i + j * n] = a[k + i - j + j * lda];
+    } else {
+      for (index_t i = j; i <= std::min(n - 1, j + k); i++)
+        d[i + j * n] = a[i - j + j * lda];
+    }
+  }
+  return d;
+}
+
+template <typename scalar_t>
+std::vector<scalar_t> packed_to_dense(char uplo, index_t n,
+                                      const scalar_t* ap) {
+  std::vector<scalar_t> d(static_cast<size_t>(n) * n, scalar_t{0});
+  for (index_t j = 0; j < n; j++) {
+    if (is_upper(uplo)) {
+      for (index_t i = 0; i <= j; i++) d[i + j * n] = ap[i + (j * (j + 1)) / 2];
+    } else {
+      for (index_t i = j; i < n; i++)
+        d[i + j * n] = ap[i + ((2 * n - j - 1) * j) / 2];
+    }
+  }
+  return d;
+}
+
+template <typename scalar_t>
+void dense_to_packed(char uplo, index_t n, const scalar_t* d, scalar_t* ap) {
+  for (index_t j = 0; j < n; j++) {
+    if (is_upper(uplo)) {
+      for (index_t i = 0; i <= j; i++) ap[i + (j * (j + 1)) / 2] = d[i + j * n];
+    } else {
+      for (index_t i = j; i < n; i++)
+        ap[i + ((2 * n - j - 1) * j) / 2] = d[i + j * n];
+    }
+  }
+}
+
+/* Level 2 */
+
+template <typename scalar_t>
+void gemv(char trans, index_t m, index_t n, scalar_t alpha, const scalar_t* a,
+          index_t lda, const scalar_t* x, index_t incx, scalar_t beta,
+          scalar_t* y, index_t incy) {
+  const bool t = is_trans(trans);
+  const index_t len_y = t ? n : m;
+  const index_t len_x = t ? m : n;
+  for (index_t i = 0; i < len_y; i++) {
+    scalar_t acc = 0;
+    for (index_t j = 0; j < len_x; j++) {
+      acc += (t ? a[j + i * lda] : a[i + j * lda]) * x[j * incx];
+    }
+    y[i * incy] = alpha * acc + (beta == scalar_t{0} ? 0 : beta * y[i * incy]);
+  }
+}
+
+template <typename scalar_t>
+void gbmv(char trans, index_t m, index_t n, index_t kl, index_t ku,
+          scalar_t alpha, const scalar_t* a, index_t lda, const scalar_t* x,
+          index_t incx, scalar_t beta, scalar_t* y, index_t incy) {
+  std::vector<scalar_t> d(static_cast<size_t>(m) * n, scalar_t{0});
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = std::max(0, j - ku); i <= std::min(m - 1, j + kl); i++)
+      d[i + j * m] = a[ku + i - j + j * lda];
+  }
+  gemv(trans, m, n, alpha, d.data(), m, x, incx, beta, y, incy);
+}
+
+template <typename scalar_t>
+void symv(char uplo, index_t n, scalar_t alpha, const scalar_t* a,
+          index_t lda, const scalar_t* x, index_t incx, scalar_t beta,
+          scalar_t* y, index_t incy) {
+  const auto s = symmetric_to_dense(uplo, n, a, lda);
+  gemv('n', n, n, alpha, s.data(), n, x, incx, beta, y, incy);
+}
+
+template <typename scalar_t>
+void sbmv(char uplo, index_t n, index_t k, scalar_t alpha, const scalar_t* a,
+          index_t lda, const scalar_t* x, index_t incx, scalar_t beta,
+          scalar_t* y, index_t incy) {
+  const auto d = band_to_dense(uplo, n, k, a, lda);
+  symv(uplo, n, alpha, d.data(), n, x, incx, beta, y, incy);
+}
+
+template <typename scalar_t>
+void spmv(char uplo, index_t n, scalar_t alpha, const scalar_t* ap,
+          const scalar_t* x, index_t incx, scalar_t beta, scalar_t* y,
+          index_t incy) {
+  const auto d = packed_to_dense(uplo, n, ap);
+  symv(uplo, n, alpha, d.data(), n, x, incx, beta, y, incy);
+}
+
+template <typename scalar_t>
+void ger(index_t m, index_t n, scalar_t alpha, const scalar_t* x,
+         index_t incx, const scalar_t* y, index_t incy, scalar_t* a,
+         index_t lda) {
+  for (index_t j = 0; j < n; j++)
+    for (index_t i = 0; i < m; i++)
+      a[i + j * lda] += alpha * x[i * incx] * y[j * incy];
+}
+
+template <typename scalar_t>
+void syr2(char uplo, index_t n, scalar_t alpha, const scalar_t* x,
+          index_t incx, const scalar_t* y, index_t incy, scalar_t* a,
+          index_t lda) {
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < n; i++) {
+      if (is_upper(uplo) ? (i <= j) : (i >= j)) {
+        a[i + j * lda] += alpha * (x[i * incx] * y[j * incy] +
+                                   y[i * incy] * x[j * incx]);
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void syr(char uplo, index_t n, scalar_t alpha, const scalar_t* x,
+         index_t incx, scalar_t* a, index_t lda) {
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < n; i++) {
+      if (is_upper(uplo) ? (i <= j) : (i >= j)) {
+        a[i + j * lda] += alpha * x[i * incx] * x[j * incx];
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void spr(char uplo, index_t n, scalar_t alpha, const scalar_t* x,
+         index_t incx, scalar_t* ap) {
+  auto d = packed_to_dense(uplo, n, ap);
+  syr(uplo, n, alpha, x, incx, d.data(), n);
+  dense_to_packed(uplo, n, d.data(), ap);
+}
+
+template <typename scalar_t>
+void spr2(char uplo, index_t n, scalar_t alpha, const scalar_t* x,
+          index_t incx, const scalar_t* y, index_t incy, scalar_t* ap) {
+  auto d = packed_to_dense(uplo, n, ap);
+  syr2(uplo, n, alpha, x, incx, y, incy, d.data(), n);
+  dense_to_packed(uplo, n, d.data(), ap);
+}
+
+template <typename scalar_t>
+void trmv(char uplo, char trans, char diag, index_t n, const scalar_t* a,
+          index_t lda, scalar_t* x, index_t incx) {
+  const auto t = triangular_to_dense(uplo, diag, n, a, lda);
+  std::vector<scalar_t> x_in(n);
+  for (index_t i = 0; i < n; i++) x_in[i] = x[i * incx];
+  for (index_t i = 0; i < n; i++) {
+    scalar_t acc = 0;
+    for (index_t j = 0; j < n; j++)
+      acc += (is_trans(trans) ? t[j + i * n] : t[i + j * n]) * x_in[j];
+    x[i * incx] = acc;
+  }
+}
+
+template <typename scalar_t>
+void trsv(char uplo, char trans, char diag, index_t n, const scalar_t* a,
+          index_t lda, scalar_t* x, index_t incx) {
+  const auto t = triangular_to_dense(uplo, diag, n, a, lda);
+  // op(T)(i, j)
+  auto op_t = [&](index_t i, index_t j) {
+    return is_trans(trans) ? t[j + i * n] : t[i + j * n];
+  };
+  const bool lower = is_upper(uplo) == is_trans(trans);
+  if (lower) {
+    for (index_t i = 0; i < n; i++) {
+      scalar_t acc = x[i * incx];
+      for (index_t j = 0; j < i; j++) acc -= op_t(i, j) * x[j * incx];
+      x[i * incx] = acc / op_t(i, i);
+    }
+  } else {
+    for (index_t i = n - 1; i >= 0; i--) {
+      scalar_t acc = x[i * incx];
+      for (index_t j = i + 1; j < n; j++) acc -= op_t(i, j) * x[j * incx];
+      x[i * incx] = acc / op_t(i, i);
+    }
+  }
+}
+
+template <typename scalar_t>
+void tbmv(char uplo, char trans, char diag, index_t n, index_t k,
+          const scalar_t* a, index_t lda, scalar_t* x, index_t incx) {
+  const auto d = band_to_dense(uplo, n, k, a, lda);
+  trmv(uplo, trans, diag, n, d.data(), n, x, incx);
+}
+
+template <typename scalar_t>
+void tbsv(char uplo, char trans, char diag, index_t n, index_t k,
+          const scalar_t* a, index_t lda, scalar_t* x, index_t incx) {
+  const auto d = band_to_dense(uplo, n, k, a, lda);
+  trsv(uplo, trans, diag, n, d.data(), n, x, incx);
+}
+
+template <typename scalar_t>
+void tpmv(char uplo, char trans, char diag, index_t n, const scalar_t* ap,
+          scalar_t* x, index_t incx) {
+  const auto d = packed_to_dense(uplo, n, ap);
+  trmv(uplo, trans, diag, n, d.data(), n, x, incx);
+}
+
+template <typename scalar_t>
+void tpsv(char uplo, char trans, char diag, index_t n, const scalar_t* ap,
+          scalar_t* x, index_t incx) {
+  const auto d = packed_to_dense(uplo, n, ap);
+  trsv(uplo, trans, diag, n, d.data(), n, x, incx);
+}
+
+/* Level 3 */
+
+template <typename scalar_t>
+void gemm(char trans_a, char trans_b, index_t m, index_t n, index_t k,
+          scalar_t alpha, const scalar_t* a, index_t lda, const scalar_t* b,
+          index_t ldb, scalar_t beta, scalar_t* c, index_t ldc) {
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < m; i++) {
+      scalar_t acc = 0;
+      for (index_t p = 0; p < k; p++) {
+        const scalar_t a_ip =
+            is_trans(trans_a) ? a[p + i * lda] : a[i + p * lda];
+        const scalar_t b_pj =
+            is_trans(trans_b) ? b[j + p * ldb] : b[p + j * ldb];
+        acc += a_ip * b_pj;
+      }
+      c[i + j * ldc] =
+          alpha * acc + (beta == scalar_t{0} ? 0 : beta * c[i + j * ldc]);
+    }
+  }
+}
+
+template <typename scalar_t>
+void symm(char side, char uplo, index_t m, index_t n, scalar_t alpha,
+          const scalar_t* a, index_t lda, const scalar_t* b, index_t ldb,
+          scalar_t beta, scalar_t* c, index_t ldc) {
+  const index_t ka = is_left(side) ? m : n;
+  const auto s = symmetric_to_dense(uplo, ka, a, lda);
+  if (is_left(side)) {
+    gemm('n', 'n', m, n, m, alpha, s.data(), ka, b, ldb, beta, c, ldc);
+  } else {
+    gemm('n', 'n', m, n, n, alpha, b, ldb, s.data(), ka, beta, c, ldc);
+  }
+}
+
+/*!
+ * @brief C = alpha * op(A) * op(B) + beta * C on the uplo triangle of the
+ * n x n matrix C. The other triangle is left untouched.
+ */
+template <typename scalar_t>
+void gemmt(char uplo, char trans_a, char trans_b, index_t n, index_t k,
+           scalar_t alpha, const scalar_t* a, index_t lda, const scalar_t* b,
+           index_t ldb, scalar_t beta, scalar_t* c, index_t ldc) {
+  for (index_t j = 0; j < n; j++) {
+    const index_t i_begin = is_upper(uplo) ? 0 : j;
+    const index_t i_end = is_upper(uplo) ? j + 1 : n;
+    for (index_t i = i_begin; i < i_end; i++) {
+      scalar_t acc = 0;
+      for (index_t p = 0; p < k; p++) {
+        const scalar_t a_ip =
+            is_trans(trans_a) ? a[p + i * lda] : a[i + p * lda];
+        const scalar_t b_pj =
+            is_trans(trans_b) ? b[j + p * ldb] : b[p + j * ldb];
+        acc += a_ip * b_pj;
+      }
+      c[i + j * ldc] =
+          alpha * acc + (beta == scalar_t{0} ? 0 : beta * c[i + j * ldc]);
+    }
+  }
+}
+
+/*!
+ * @brief C = alpha * op(A) * op(A)^T + beta * C on the uplo triangle of C,
+ * op(A) being n x k. The other triangle is left untouched.
+ */
+template <typename scalar_t>
+void syrk(char uplo, char trans, index_t n, index_t k, scalar_t alpha,
+          const scalar_t* a, index_t lda, scalar_t beta, scalar_t* c,
+          index_t ldc) {
+  for (index_t j = 0; j < n; j++) {
+    const index_t i_begin = is_upper(uplo) ? 0 : j;
+    const index_t i_end = is_upper(uplo) ? j + 1 : n;
+    for (index_t i = i_begin; i < i_end; i++) {
+      scalar_t acc = 0;
+      for (index_t p = 0; p < k; p++) {
+        acc += is_trans(trans) ? a[p + i * lda] * a[p + j * lda]
+                               : a[i + p * lda] * a[j + p * lda];
+      }
+      c[i + j * ldc] =
+          alpha * acc + (beta == scalar_t{0} ? 0 : beta * c[i + j * ldc]);
+    }
+  }
+}
+
+/*!
+ * @brief B = alpha * op(A) * B (left) or B = alpha * B * op(A) (right), A
+ * being triangular.
+ */
+template <typename scalar_t>
+void trmm(char side, char uplo, char trans, char diag, index_t m, index_t n,
+          scalar_t alpha, const scalar_t* a, index_t lda, scalar_t* b,
+          index_t ldb) {
+  const index_t ka = is_left(side) ? m : n;
+  const auto t = triangular_to_dense(uplo, diag, ka, a, lda);
+  std::vector<scalar_t> r(static_cast<size_t>(m) * n);
+  if (is_left(side)) {
+    gemm(trans, 'n', m, n, m, alpha, t.data(), ka, b, ldb, scalar_t{0},
+         r.data(), m);
+  } else {
+    gemm('n', trans, m, n, n, alpha, b, ldb, t.data(), ka, scalar_t{0},
+         r.data(), m);
+  }
+  for (index_t j = 0; j < n; j++)
+    for (index_t i = 0; i < m; i++) b[i + j * ldb] = r[i + j * m];
+}
+
+/*!
+ * @brief Solves op(A) X = alpha B (left) or X op(A) = alpha B (right) by
+ * applying trsv to each column (left) or row (right) of B.
+ */
+template <typename scalar_t>
+void trsm(char side, char uplo, char trans, char diag, index_t m, index_t n,
+          scalar_t alpha, const scalar_t* a, index_t lda, scalar_t* b,
+          index_t ldb) {
+  for (index_t j = 0; j < n; j++)
+    for (index_t i = 0; i < m; i++) b[i + j * ldb] *= alpha;
+  if (is_left(side)) {
+    for (index_t j = 0; j < n; j++)
+      trsv(uplo, trans, diag, m, a, lda, b + j * ldb, 1);
+  } else {
+    // X op(A) = B  <=>  op(A)^T X^T = B^T
+    const char trans_t = is_trans(trans) ? 'n' : 't';
+    for (index_t i = 0; i < m; i++)
+      trsv(uplo, trans_t, diag, n, a, lda, b + i, ldb);
+  }
+}
+
+/* Extensions */
+
+template <typename scalar_t>
+void omatcopy(char trans, index_t m, index_t n, scalar_t alpha,
+              const scalar_t* a, index_t lda, index_t inc_a, scalar_t* b,
+              index_t ldb, index_t inc_b) {
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < m; i++) {
+      const scalar_t v = alpha * a[i * inc_a + j * lda];
+      if (is_trans(trans)) {
+        b[j * inc_b + i * ldb] = v;
+      } else {
+        b[i * inc_b + j * ldb] = v;
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void omatadd(char trans_a, char trans_b, index_t m, index_t n, scalar_t alpha,
+             const scalar_t* a, index_t lda, scalar_t beta, const scalar_t* b,
+             index_t ldb, scalar_t* c, index_t ldc) {
+  for (index_t j = 0; j < n; j++) {
+    for (index_t i = 0; i < m; i++) {
+      const scalar_t a_ij = is_trans(trans_a) ? a[j + i * lda] : a[i + j * lda];
+      const scalar_t b_ij = is_trans(trans_b) ? b[j + i * ldb] : b[i + j * ldb];
+      c[i + j * ldc] = alpha * a_ij + beta * b_ij;
+    }
+  }
+}
+
+}  // namespace reference_blas
+
+#endif  // ONEMATH_SYCL_BLAS_BENCHMARK_REFERENCE_BLAS_HPP
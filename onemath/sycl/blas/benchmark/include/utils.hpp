@@ -0,0 +1,997 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BENCHMARK_UTILS_HPP
+#define ONEMATH_SYCL_BLAS_BENCHMARK_UTILS_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "onemath_sycl_blas.hpp"
+
+namespace blas_benchmark {
+
+/**
+ * @brief Options understood by the benchmark executables on top of the ones
+ * handled by Google Benchmark.
+ */
+struct Args {
+  std::string program_name;
+  // One of "default", "cpu" or "gpu"
+  std::string device = "default";
+  // Optional CSV file containing the problem sizes to benchmark
+  std::string csv_param;
+};
+
+/**
+ * @brief Registers the benchmarks of a given operator. Each benchmark
+ * executable provides its own definition.
+ */
+void create_benchmark(Args& args, blas::SB_Handle* sb_handle_ptr,
+                      bool* success);
+
+namespace utils {
+
+using index_t = int;
+
+/**
+ * Parameter sets of the different operators. Every field maps to one column
+ * of the CSV file given through --csv-param, in the same order.
+ */
+using blas1_param_t = std::tuple<index_t>;
+
+// trans, m, n, alpha, beta
+template <typename scalar_t>
+using blas2_param_t =
+    std::tuple<std::string, index_t, index_t, scalar_t, scalar_t>;
+
+// trans, m, n, kl, ku, alpha, beta
+template <typename scalar_t>
+using gbmv_param_t = std::tuple<std::string, index_t, index_t, index_t,
+                                index_t, scalar_t, scalar_t>;
+
+// m, n, alpha
+template <typename scalar_t>
+using ger_param_t = std::tuple<index_t, index_t, scalar_t>;
+
+// uplo, n, alpha, beta
+template <typename scalar_t>
+using symv_param_t = std::tuple<std::string, index_t, scalar_t, scalar_t>;
+
+// uplo, n, k, alpha, beta
+template <typename scalar_t>
+using sbmv_param_t =
+    std::tuple<std::string, index_t, index_t, scalar_t, scalar_t>;
+
+// uplo, n, alpha
+template <typename scalar_t>
+using syr_param_t = std::tuple<std::string, index_t, scalar_t>;
+
+// uplo, trans, diag, n
+using trsv_param_t =
+    std::tuple<std::string, std::string, std::string, index_t>;
+
+// uplo, trans, diag, n, k
+using tbmv_param_t =
+    std::tuple<std::string, std::string, std::string, index_t, index_t>;
+
+// trans_a, trans_b, m, n, k, alpha, beta
+template <typename scalar_t>
+using blas3_param_t = std::tuple<std::string, std::string, index_t, index_t,
+                                 index_t, scalar_t, scalar_t>;
+
+// trans_a, trans_b, m, n, k, alpha, beta, batch_size, batch_type
+template <typename scalar_t>
+using gemm_batched_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
+               scalar_t, index_t, std::string>;
+
+// trans_a, trans_b, m, n, k, alpha, beta, batch_size, stride_a_mul,
+// stride_b_mul, stride_c_mul
+template <typename scalar_t>
+using gemm_batched_strided_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
+               scalar_t, index_t, index_t, index_t, index_t>;
+
+// trans_a, trans_b, m, n, k, alpha, beta, group_count, group_size,
+// size_step
+template <typename scalar_t>
+using gemm_batch_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
+               scalar_t, index_t, index_t, index_t>;
+
+// trans_a, trans_b, m, n, k, alpha, beta, batch_size
+template <typename scalar_t>
+using gemm_batch_pointer_array_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
+               scalar_t, index_t>;
+
+// uplo, trans_a, trans_b, n, k, alpha, beta
+template <typename scalar_t>
+using gemmt_param_t = std::tuple<std::string, std::string, std::string,
+                                 index_t, index_t, scalar_t, scalar_t>;
+
+// trans_a, trans_b, m, n, k, alpha, beta, packed ("a", "b" or "both")
+template <typename scalar_t>
+using gemm_packed_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
+               scalar_t, std::string>;
+
+// side, uplo, m, n, alpha, beta
+template <typename scalar_t>
+using symm_param_t = std::tuple<std::string, std::string, index_t, index_t,
+                                scalar_t, scalar_t>;
+
+// uplo, trans, n, k, alpha, beta
+template <typename scalar_t>
+using syrk_param_t = std::tuple<std::string, std::string, index_t, index_t,
+                                scalar_t, scalar_t>;
+
+// side, uplo, trans, diag, m, n, alpha
+template <typename scalar_t>
+using trsm_param_t = std::tuple<std::string, std::string, std::string,
+                                std::string, index_t, index_t, scalar_t>;
+
+// side, uplo, trans, diag, m, n, alpha
+template <typename scalar_t>
+using trmm_param_t = trsm_param_t<scalar_t>;
+
+// trans, m, n, alpha, ld_in_mul, ld_out_mul
+template <typename scalar_t>
+using matcopy_param_t =
+    std::tuple<std::string, index_t, index_t, scalar_t, index_t, index_t>;
+
+// trans, m, n, alpha, ld_in_mul, ld_out_mul, inc_in, inc_out
+template <typename scalar_t>
+using matcopy2_param_t = std::tuple<std::string, index_t, index_t, scalar_t,
+                                    index_t, index_t, index_t, index_t>;
+
+// trans, m, n, alpha, ld_in_mul, ld_out_mul, stride_in_mul, stride_out_mul,
+// batch_size
+template <typename scalar_t>
+using matcopy_batch_param_t =
+    std::tuple<std::string, index_t, index_t, scalar_t, index_t, index_t,
+               index_t, index_t, index_t>;
+
+// trans_a, trans_b, m, n, alpha, beta, lda_mul, ldb_mul, ldc_mul
+template <typename scalar_t>
+using omatadd_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, scalar_t, scalar_t,
+               index_t, index_t, index_t>;
+
+// trans_a, trans_b, m, n, alpha, beta, lda_mul, ldb_mul, ldc_mul,
+// stride_a_mul, stride_b_mul, stride_c_mul, batch_size
+template <typename scalar_t>
+using omatadd_batch_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, scalar_t, scalar_t,
+               index_t, index_t, index_t, index_t, index_t, index_t, index_t>;
+
+// n, alpha, inc_x, inc_y, stride_x_mul, stride_y_mul, batch_size
+template <typename scalar_t>
+using axpy_batch_param_t = std::tuple<index_t, scalar_t, index_t, index_t,
+                                      index_t, index_t, index_t>;
+
+// n, inc_x, inc_y, stride_x_mul, stride_y_mul, batch_size
+using dot_batch_param_t =
+    std::tuple<index_t, index_t, index_t, index_t, index_t, index_t>;
+
+// m, n, ld_in_mul, ld_out_mul
+using transpose_param_t = std::tuple<index_t, index_t, index_t, index_t>;
+
+// rows, cols, reduction dimension ("inner" or "outer")
+using reduction_param_t = std::tuple<index_t, index_t, std::string>;
+
+// trans_a, trans_b, m, n, k, alpha, beta, bias, activation, residual
+template <typename scalar_t>
+using gemm_epilogue_param_t =
+    std::tuple<std::string, std::string, index_t, index_t, index_t, scalar_t,
+               scalar_t, std::string, std::string, index_t>;
+
+/**
+ * @brief Parses the command line, removing the options consumed by the
+ * benchmark suite so that the rest can be forwarded to Google Benchmark.
+ */
+inline Args parse_args(int& argc, char** argv) {
+  Args args;
+  args.program_name = argv[0];
+  int new_argc = 1;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg(argv[i]);
+    if (arg.rfind("--device=", 0) == 0) {
+      args.device = arg.substr(9);
+    } else if (arg.rfind("--csv-param=", 0) == 0) {
+      args.csv_param = arg.substr(12);
+    } else if (arg == "--help" || arg == "-h") {
+      std::cout << "Usage: " << args.program_name
+                << " [--device=default|cpu|gpu] [--csv-param=<file>]"
+                << " [Google Benchmark options]" << std::endl;
+      argv[new_argc++] = argv[i];
+    } else {
+      argv[new_argc++] = argv[i];
+    }
+  }
+  argc = new_argc;
+  return args;
+}
+
+/**
+ * @brief Builds a profiling-enabled queue on the device requested with the
+ * --device option.
+ */
+inline sycl::queue make_queue(const Args& args) {
+  auto async_handler = [](sycl::exception_list exceptions) {
+    for (auto const& e : exceptions) {
+      try {
+        std::rethrow_exception(e);
+      } catch (sycl::exception const& e) {
+        std::cerr << "Caught asynchronous SYCL exception:\n"
+                  << e.what() << std::endl;
+      }
+    }
+  };
+  const sycl::property_list props{sycl::property::queue::enable_profiling()};
+  if (args.device == "cpu") {
+    return sycl::queue(sycl::cpu_selector_v, async_handler, props);
+  } else if (args.device == "gpu") {
+    return sycl::queue(sycl::gpu_selector_v, async_handler, props);
+  } else if (args.device == "default") {
+    return sycl::queue(sycl::default_selector_v, async_handler, props);
+  }
+  throw std::invalid_argument("Unknown device: " + args.device +
+                              " (expected default, cpu or gpu)");
+}
+
+inline void print_device_information(const sycl::device& device) {
+  std::cout << "Device vendor: "
+            << device.get_info<sycl::info::device::vendor>() << std::endl;
+  std::cout << "Device name: " << device.get_info<sycl::info::device::name>()
+            << std::endl;
+  std::cout << "Device type: "
+            << (device.is_cpu() ? "cpu" : (device.is_gpu() ? "gpu" : "other"))
+            << std::endl;
+  std::cout << "Driver version: "
+            << device.get_info<sycl::info::device::driver_version>()
+            << std::endl;
+}
+
+/**
+ * @brief Conversion from a CSV field to the type of a parameter.
+ */
+template <typename T>
+inline T str_to(const std::string& str) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return str;
+  } else if constexpr (std::is_integral_v<T>) {
+    return static_cast<T>(std::stoll(str));
+  } else {
+    return static_cast<T>(std::stod(str));
+  }
+}
+
+inline std::string trim(const std::string& str) {
+  const auto first = str.find_first_not_of(" \t\r");
+  if (first == std::string::npos) return "";
+  const auto last = str.find_last_not_of(" \t\r");
+  return str.substr(first, last - first + 1);
+}
+
+template <typename param_t, size_t... I>
+inline param_t parse_row(const std::vector<std::string>& row,
+                         std::index_sequence<I...>) {
+  return param_t{str_to<std::tuple_element_t<I, param_t>>(row[I])...};
+}
+
+/**
+ * @brief Reads a CSV file in which every line holds one parameter set. Empty
+ * lines and lines starting with '#' are ignored.
+ */
+template <typename param_t>
+inline std::vector<param_t> parse_csv_file(const std::string& file_name) {
+  constexpr size_t num_fields = std::tuple_size<param_t>::value;
+  std::ifstream data(file_name);
+  if (!data.is_open()) {
+    throw std::runtime_error("Unable to open CSV file: " + file_name);
+  }
+  std::vector<param_t> params;
+  std::string line;
+  while (std::getline(data, line)) {
+    line = trim(line);
+    if (line.empty() || line[0] == '#') continue;
+    std::vector<std::string> row;
+    std::stringstream line_stream(line);
+    std::string cell;
+    while (std::getline(line_stream, cell, ',')) {
+      row.push_back(trim(cell));
+    }
+    if (row.size() != num_fields) {
+      throw std::runtime_error("Invalid line in " + file_name + ": '" + line +
+                               "' (expected " + std::to_string(num_fields) +
+                               " fields)");
+    }
+    params.push_back(
+        parse_row<param_t>(row, std::make_index_sequence<num_fields>{}));
+  }
+  return params;
+}
+
+/**
+ * @brief Returns the parameters from the CSV file if one was given, or the
+ * default size sweep of the operator otherwise.
+ */
+template <typename param_t>
+inline std::vector<param_t> get_params(const Args& args,
+                                       std::vector<param_t>&& defaults) {
+  if (args.csv_param.empty()) {
+    return std::move(defaults);
+  }
+  return parse_csv_file<param_t>(args.csv_param);
+}
+
+/**
+ * Default size sweeps.
+ */
+inline std::vector<blas1_param_t> get_blas1_params(const Args& args) {
+  std::vector<blas1_param_t> defaults;
+  for (index_t size = 1 << 10; size <= 1 << 24; size *= 4) {
+    defaults.emplace_back(size);
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<blas2_param_t<scalar_t>> get_blas2_params(
+    const Args& args) {
+  std::vector<blas2_param_t<scalar_t>> defaults;
+  for (std::string trans : {"n", "t"}) {
+    for (index_t size = 64; size <= 4096; size *= 2) {
+      defaults.emplace_back(trans, size, size, scalar_t{1}, scalar_t{0});
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gbmv_param_t<scalar_t>> get_gbmv_params(const Args& args) {
+  std::vector<gbmv_param_t<scalar_t>> defaults;
+  for (std::string trans : {"n", "t"}) {
+    for (index_t size = 256; size <= 8192; size *= 2) {
+      defaults.emplace_back(trans, size, size, 3, 4, scalar_t{1}, scalar_t{0});
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<ger_param_t<scalar_t>> get_ger_params(const Args& args) {
+  std::vector<ger_param_t<scalar_t>> defaults;
+  for (index_t size = 64; size <= 4096; size *= 2) {
+    defaults.emplace_back(size, size, scalar_t{1});
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<symv_param_t<scalar_t>> get_symv_params(const Args& args) {
+  std::vector<symv_param_t<scalar_t>> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (index_t size = 64; size <= 4096; size *= 2) {
+      defaults.emplace_back(uplo, size, scalar_t{1}, scalar_t{0});
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<sbmv_param_t<scalar_t>> get_sbmv_params(const Args& args) {
+  std::vector<sbmv_param_t<scalar_t>> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (index_t size = 256; size <= 8192; size *= 2) {
+      defaults.emplace_back(uplo, size, 4, scalar_t{1}, scalar_t{0});
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<syr_param_t<scalar_t>> get_syr_params(const Args& args) {
+  std::vector<syr_param_t<scalar_t>> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (index_t size = 64; size <= 4096; size *= 2) {
+      defaults.emplace_back(uplo, size, scalar_t{1});
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+inline std::vector<trsv_param_t> get_trsv_params(const Args& args) {
+  std::vector<trsv_param_t> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (std::string trans : {"n", "t"}) {
+      for (index_t size = 64; size <= 4096; size *= 4) {
+        defaults.emplace_back(uplo, trans, "n", size);
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+inline std::vector<tbmv_param_t> get_tbmv_params(const Args& args) {
+  std::vector<tbmv_param_t> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (std::string trans : {"n", "t"}) {
+      for (index_t size = 256; size <= 8192; size *= 4) {
+        defaults.emplace_back(uplo, trans, "n", size, 4);
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<blas3_param_t<scalar_t>> get_blas3_params(
+    const Args& args) {
+  std::vector<blas3_param_t<scalar_t>> defaults;
+  for (std::string t_a : {"n", "t"}) {
+    for (std::string t_b : {"n", "t"}) {
+      for (index_t size = 64; size <= 1024; size *= 2) {
+        defaults.emplace_back(t_a, t_b, size, size, size, scalar_t{1},
+                              scalar_t{0});
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemm_batched_param_t<scalar_t>> get_gemm_batched_params(
+    const Args& args) {
+  std::vector<gemm_batched_param_t<scalar_t>> defaults;
+  for (std::string batch_type : {"strided", "interleaved"}) {
+    for (index_t size = 16; size <= 256; size *= 4) {
+      defaults.emplace_back("n", "n", size, size, size, scalar_t{1},
+                            scalar_t{0}, 64, batch_type);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemm_batched_strided_param_t<scalar_t>>
+get_gemm_batched_strided_params(const Args& args) {
+  std::vector<gemm_batched_strided_param_t<scalar_t>> defaults;
+  for (std::string t_a : {"n", "t"}) {
+    for (std::string t_b : {"n", "t"}) {
+      for (index_t size = 16; size <= 256; size *= 4) {
+        defaults.emplace_back(t_a, t_b, size, size, size, scalar_t{1},
+                              scalar_t{0}, 64, 1, 1, 1);
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemm_batch_param_t<scalar_t>> get_gemm_batch_params(
+    const Args& args) {
+  std::vector<gemm_batch_param_t<scalar_t>> defaults;
+  for (index_t size = 32; size <= 128; size *= 2) {
+    // A few groups of products of the same size
+    defaults.emplace_back("n", "n", size, size, size, scalar_t{1},
+                          scalar_t{0}, 4, 16, size);
+    // A variable-size batch, one product per group
+    defaults.emplace_back("n", "n", size, size, size, scalar_t{1},
+                          scalar_t{0}, 64, 1, size / 16);
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemm_batch_pointer_array_param_t<scalar_t>>
+get_gemm_batch_pointer_array_params(const Args& args) {
+  std::vector<gemm_batch_pointer_array_param_t<scalar_t>> defaults;
+  for (std::string t_a : {"n", "t"}) {
+    for (std::string t_b : {"n", "t"}) {
+      for (index_t size = 16; size <= 256; size *= 4) {
+        defaults.emplace_back(t_a, t_b, size, size, size, scalar_t{1},
+                              scalar_t{0}, 64);
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemmt_param_t<scalar_t>> get_gemmt_params(const Args& args) {
+  std::vector<gemmt_param_t<scalar_t>> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (std::string t_a : {"n", "t"}) {
+      for (index_t size = 64; size <= 1024; size *= 4) {
+        defaults.emplace_back(uplo, t_a, "n", size, size, scalar_t{1},
+                              scalar_t{0});
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemm_packed_param_t<scalar_t>> get_gemm_packed_params(
+    const Args& args) {
+  std::vector<gemm_packed_param_t<scalar_t>> defaults;
+  for (std::string packed : {"a", "b", "both"}) {
+    for (index_t size = 64; size <= 1024; size *= 2) {
+      defaults.emplace_back("n", "t", size, size, size, scalar_t{1},
+                            scalar_t{0}, packed);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<symm_param_t<scalar_t>> get_symm_params(const Args& args) {
+  std::vector<symm_param_t<scalar_t>> defaults;
+  for (std::string side : {"l", "r"}) {
+    for (std::string uplo : {"u", "l"}) {
+      for (index_t size = 64; size <= 1024; size *= 4) {
+        defaults.emplace_back(side, uplo, size, size, scalar_t{1},
+                              scalar_t{0});
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<syrk_param_t<scalar_t>> get_syrk_params(const Args& args) {
+  std::vector<syrk_param_t<scalar_t>> defaults;
+  for (std::string uplo : {"u", "l"}) {
+    for (std::string trans : {"n", "t"}) {
+      for (index_t size = 64; size <= 1024; size *= 4) {
+        defaults.emplace_back(uplo, trans, size, size, scalar_t{1},
+                              scalar_t{0});
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<trsm_param_t<scalar_t>> get_trsm_params(const Args& args) {
+  std::vector<trsm_param_t<scalar_t>> defaults;
+  for (std::string side : {"l", "r"}) {
+    for (std::string uplo : {"u", "l"}) {
+      for (std::string trans : {"n", "t"}) {
+        for (index_t size = 64; size <= 1024; size *= 4) {
+          defaults.emplace_back(side, uplo, trans, "n", size, size,
+                                scalar_t{1});
+        }
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<trmm_param_t<scalar_t>> get_trmm_params(const Args& args) {
+  return get_trsm_params<scalar_t>(args);
+}
+
+template <typename scalar_t>
+inline std::vector<matcopy_param_t<scalar_t>> get_matcopy_params(
+    const Args& args) {
+  std::vector<matcopy_param_t<scalar_t>> defaults;
+  for (std::string trans : {"n", "t"}) {
+    for (index_t size = 64; size <= 4096; size *= 4) {
+      defaults.emplace_back(trans, size, size, scalar_t{2}, 1, 1);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<matcopy2_param_t<scalar_t>> get_matcopy2_params(
+    const Args& args) {
+  std::vector<matcopy2_param_t<scalar_t>> defaults;
+  for (std::string trans : {"n", "t"}) {
+    for (index_t size = 64; size <= 4096; size *= 4) {
+      defaults.emplace_back(trans, size, size, scalar_t{2}, 2, 2, 2, 2);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<matcopy_batch_param_t<scalar_t>> get_matcopy_batch_params(
+    const Args& args) {
+  std::vector<matcopy_batch_param_t<scalar_t>> defaults;
+  for (std::string trans : {"n", "t"}) {
+    for (index_t size = 64; size <= 1024; size *= 4) {
+      defaults.emplace_back(trans, size, size, scalar_t{2}, 1, 1, 1, 1, 8);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<omatadd_param_t<scalar_t>> get_omatadd_params(
+    const Args& args) {
+  std::vector<omatadd_param_t<scalar_t>> defaults;
+  for (std::string t_a : {"n", "t"}) {
+    for (std::string t_b : {"n", "t"}) {
+      for (index_t size = 64; size <= 4096; size *= 4) {
+        defaults.emplace_back(t_a, t_b, size, size, scalar_t{1}, scalar_t{2},
+                              1, 1, 1);
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<omatadd_batch_param_t<scalar_t>> get_omatadd_batch_params(
+    const Args& args) {
+  std::vector<omatadd_batch_param_t<scalar_t>> defaults;
+  for (std::string t_a : {"n", "t"}) {
+    for (std::string t_b : {"n", "t"}) {
+      for (index_t size = 64; size <= 1024; size *= 4) {
+        defaults.emplace_back(t_a, t_b, size, size, scalar_t{1}, scalar_t{2},
+                              1, 1, 1, 1, 1, 1, 8);
+      }
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<axpy_batch_param_t<scalar_t>> get_axpy_batch_params(
+    const Args& args) {
+  std::vector<axpy_batch_param_t<scalar_t>> defaults;
+  for (index_t size = 1 << 10; size <= 1 << 18; size *= 4) {
+    defaults.emplace_back(size, scalar_t{2}, 1, 1, 1, 1, 16);
+  }
+  return get_params(args, std::move(defaults));
+}
+
+inline std::vector<dot_batch_param_t> get_dot_batch_params(const Args& args) {
+  std::vector<dot_batch_param_t> defaults;
+  for (index_t size = 1 << 8; size <= 1 << 12; size *= 4) {
+    for (index_t batch_size = 1 << 6; batch_size <= 1 << 12; batch_size *= 8) {
+      defaults.emplace_back(size, 1, 1, 1, 1, batch_size);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+inline std::vector<transpose_param_t> get_transpose_params(const Args& args) {
+  std::vector<transpose_param_t> defaults;
+  for (index_t size = 64; size <= 4096; size *= 2) {
+    defaults.emplace_back(size, size, 1, 1);
+  }
+  return get_params(args, std::move(defaults));
+}
+
+inline std::vector<reduction_param_t> get_reduction_params(const Args& args) {
+  std::vector<reduction_param_t> defaults;
+  for (std::string dim : {"inner", "outer"}) {
+    for (index_t size = 64; size <= 4096; size *= 4) {
+      defaults.emplace_back(size, size, dim);
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+template <typename scalar_t>
+inline std::vector<gemm_epilogue_param_t<scalar_t>> get_gemm_epilogue_params(
+    const Args& args) {
+  using epilogue_t = std::tuple<std::string, std::string, index_t>;
+  std::vector<gemm_epilogue_param_t<scalar_t>> defaults;
+  for (auto epilogue : {epilogue_t{"none", "none", 0},
+                        epilogue_t{"row", "relu", 0},
+                        epilogue_t{"row", "gelu", 1},
+                        epilogue_t{"column", "clamp", 0}}) {
+    for (index_t size = 256; size <= 2048; size *= 2) {
+      defaults.emplace_back("n", "n", size, size, size, scalar_t{1},
+                            scalar_t{0}, std::get<0>(epilogue),
+                            std::get<1>(epilogue), std::get<2>(epilogue));
+    }
+  }
+  return get_params(args, std::move(defaults));
+}
+
+/**
+ * @brief Name of the benchmark, built from the operator name, the data type
+ * and the parameters: op<type>/param_1/.../param_n/mem_type.
+ */
+template <typename T>
+inline std::string get_type_name() {
+  if constexpr (std::is_same_v<T, float>) {
+    return "float";
+  } else if constexpr (std::is_same_v<T, double>) {
+    return "double";
+  } else if constexpr (std::is_same_v<T, sycl::half>) {
+    return "half";
+  } else {
+    return "unknown";
+  }
+}
+
+template <typename T>
+inline std::string to_name_field(const T& value) {
+  std::ostringstream str;
+  str << value;
+  return str.str();
+}
+
+template <typename scalar_t, typename... args_t>
+inline std::string get_name(const std::string& op_name,
+                            const args_t&... args) {
+  std::string name = "BM_" + op_name + "<" + get_type_name<scalar_t>() + ">";
+  ((name += "/" + to_name_field(args)), ...);
+  return name;
+}
+
+/**
+ * @brief Allocates device memory of the requested kind and copies the host
+ * data into it.
+ */
+template <blas::helper::AllocType mem_alloc, typename scalar_t>
+inline typename blas::helper::AllocHelper<scalar_t, mem_alloc>::type
+make_device_copy(sycl::queue& q, const std::vector<scalar_t>& host) {
+  auto device = blas::helper::allocate<mem_alloc, scalar_t>(
+      static_cast<int>(host.size()), q);
+  blas::helper::copy_to_device(q, host.data(), device, host.size()).wait();
+  return device;
+}
+
+/**
+ * @brief Random data generation, seeded so that runs are reproducible.
+ */
+inline std::mt19937& get_random_engine() {
+  static std::mt19937 engine(42);
+  return engine;
+}
+
+template <typename scalar_t>
+inline scalar_t random_scalar(scalar_t min = scalar_t{-1},
+                              scalar_t max = scalar_t{1}) {
+  std::uniform_real_distribution<double> dist(static_cast<double>(min),
+                                              static_cast<double>(max));
+  return static_cast<scalar_t>(dist(get_random_engine()));
+}
+
+template <typename scalar_t>
+inline std::vector<scalar_t> random_data(size_t size,
+                                         scalar_t min = scalar_t{-1},
+                                         scalar_t max = scalar_t{1}) {
+  std::vector<scalar_t> data(size);
+  for (auto& v : data) {
+    v = random_scalar<scalar_t>(min, max);
+  }
+  return data;
+}
+
+/**
+ * @brief Column-major n x n matrix whose diagonal dominates, so that the
+ * triangular solvers stay numerically stable.
+ */
+template <typename scalar_t>
+inline std::vector<scalar_t> random_triangular_matrix(index_t n,
+                                                      index_t lda) {
+  auto a = random_data<scalar_t>(static_cast<size_t>(lda) * n);
+  for (index_t i = 0; i < n; i++) {
+    a[i + i * lda] = random_scalar<scalar_t>(scalar_t{9}, scalar_t{11});
+  }
+  return a;
+}
+
+/**
+ * @brief Tolerance used when verifying the results against the reference.
+ */
+template <typename scalar_t>
+inline scalar_t get_tolerance() {
+  return std::is_same_v<scalar_t, double> ? scalar_t(1e-8) : scalar_t(1e-3);
+}
+
+template <typename scalar_t>
+inline bool almost_equal(scalar_t result, scalar_t reference,
+                         scalar_t tolerance = get_tolerance<scalar_t>()) {
+  if (std::isnan(result) || std::isnan(reference)) {
+    return std::isnan(result) && std::isnan(reference);
+  }
+  const scalar_t diff = std::abs(result - reference);
+  const scalar_t scale =
+      std::max(scalar_t{1}, std::max(std::abs(result), std::abs(reference)));
+  return diff <= tolerance * scale;
+}
+
+template <typename scalar_t>
+inline bool compare_vectors(const std::vector<scalar_t>& result,
+                            const std::vector<scalar_t>& reference,
+                            scalar_t tolerance = get_tolerance<scalar_t>()) {
+  if (result.size() != reference.size()) {
+    std::cerr << "Size mismatch: " << result.size() << " vs "
+              << reference.size() << std::endl;
+    return false;
+  }
+  for (size_t i = 0; i < result.size(); i++) {
+    if (!almost_equal(result[i], reference[i], tolerance)) {
+      std::cerr << "Value mismatch at index " << i << ": " << result[i]
+                << " vs " << reference[i] << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the sum of the execution times in nanoseconds of the given
+ * events, as reported by the SYCL profiling info.
+ */
+inline double time_events(const std::vector<sycl::event>& events) {
+  double total = 0;
+  for (const auto& e : events) {
+    const auto start =
+        e.get_profiling_info<sycl::info::event_profiling::command_start>();
+    const auto end =
+        e.get_profiling_info<sycl::info::event_profiling::command_end>();
+    total += static_cast<double>(end - start);
+  }
+  return total;
+}
+
+/**
+ * @brief Runs the given function once without timing it, so that the kernels
+ * are compiled and the memory is resident before the measurements.
+ */
+template <typename function_t>
+inline void warmup(sycl::queue& q, function_t func) {
+  std::vector<sycl::event> events = func();
+  sycl::event::wait(events);
+  q.wait_and_throw();
+}
+
+/**
+ * @brief Runs the given function, waits for the returned events and returns
+ * the overall (host) time and the event (device) time in nanoseconds.
+ */
+template <typename function_t>
+inline std::tuple<double, double> timef(sycl::queue& q, function_t func) {
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<sycl::event> events = func();
+  sycl::event::wait(events);
+  q.wait_and_throw();
+  const auto end = std::chrono::steady_clock::now();
+  const double overall_time =
+      std::chrono::duration<double, std::nano>(end - start).count();
+  const double event_time =
+      q.has_property<sycl::property::queue::enable_profiling>()
+          ? time_events(events)
+          : overall_time;
+  return std::make_tuple(overall_time, event_time);
+}
+
+/**
+ * Counters.
+ * The iteration time given to Google Benchmark is the overall time, while the
+ * device time of the kernels is reported in the *_event_time counters.
+ */
+inline void init_counters(benchmark::State& state) {
+  state.counters["best_event_time"] = std::numeric_limits<double>::max();
+  state.counters["best_overall_time"] = std::numeric_limits<double>::max();
+  state.counters["total_event_time"] = 0;
+  state.counters["total_overall_time"] = 0;
+}
+
+inline void update_counters(benchmark::State& state,
+                            const std::tuple<double, double>& times) {
+  const double overall_time = std::get<0>(times);
+  const double event_time = std::get<1>(times);
+  state.SetIterationTime(overall_time * 1e-9);
+  state.counters["total_overall_time"] =
+      state.counters["total_overall_time"] + overall_time;
+  state.counters["total_event_time"] =
+      state.counters["total_event_time"] + event_time;
+  state.counters["best_overall_time"] =
+      std::min<double>(state.counters["best_overall_time"], overall_time);
+  state.counters["best_event_time"] =
+      std::min<double>(state.counters["best_event_time"], event_time);
+}
+
+/**
+ * @brief Sets the averaged timers and the throughput counters. Must be called
+ * after the benchmark loop.
+ * @param n_fl_ops Number of floating point operations of one iteration
+ * @param bytes_processed Number of bytes read and written by one iteration
+ */
+inline void calc_avg_counters(benchmark::State& state, double n_fl_ops,
+                              double bytes_processed) {
+  const double iterations =
+      std::max<double>(1, static_cast<double>(state.iterations()));
+  const double avg_event_time = state.counters["total_event_time"] / iterations;
+  state.counters["avg_event_time"] = avg_event_time;
+  state.counters["avg_overall_time"] =
+      state.counters["total_overall_time"] / iterations;
+  state.counters["n_fl_ops"] = n_fl_ops;
+  state.counters["bytes_processed"] = bytes_processed;
+  // Throughput of the kernels alone, based on the device time
+  state.counters["kernel_GFLOP/s"] =
+      avg_event_time > 0 ? n_fl_ops / avg_event_time : 0;
+  state.counters["kernel_GB/s"] =
+      avg_event_time > 0 ? bytes_processed / avg_event_time : 0;
+  // Throughput based on the overall time
+  state.counters["GFLOP/s"] = benchmark::Counter(
+      n_fl_ops * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["GB/s"] = benchmark::Counter(
+      bytes_processed * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Registers the benchmark for each supported memory allocation type.
+ * @tparam register_t Callable templated on the allocation type, receiving its
+ * name ("buffer" or "usm").
+ */
+template <typename register_t>
+inline void register_all_mem_types(register_t&& register_fn) {
+  register_fn(std::integral_constant<blas::helper::AllocType,
+                                     blas::helper::AllocType::buffer>{},
+              "buffer");
+#ifdef SB_ENABLE_USM
+  register_fn(std::integral_constant<blas::helper::AllocType,
+                                     blas::helper::AllocType::usm>{},
+              "usm");
+#endif
+}
+
+}  // namespace utils
+}  // namespace blas_benchmark
+
+/**
+ * @brief Registers the benchmarks of the operator for every enabled data type.
+ * Each benchmark file defines a register_benchmark<scalar_t>(args, sb_handle,
+ * success) function template.
+ */
+#ifdef BLAS_DATA_TYPE_DOUBLE
+#define BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success)        \
+  do {                                                               \
+    register_benchmark<float>(args, sb_handle_ptr, success);         \
+    register_benchmark<double>(args, sb_handle_ptr, success);        \
+  } while (0)
+#else
+#define BLAS_REGISTER_BENCHMARK(args, sb_handle_ptr, success) \
+  register_benchmark<float>(args, sb_handle_ptr, success)
+#endif
+
+#endif  // ONEMATH_SYCL_BLAS_BENCHMARK_UTILS_HPP
@@ -0,0 +1,50 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "utils.hpp"
+
+int main(int argc, char** argv) {
+  // Read the benchmark suite options and forward the rest to Google Benchmark
+  blas_benchmark::Args args = blas_benchmark::utils::parse_args(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  sycl::queue q = blas_benchmark::utils::make_queue(args);
+  blas_benchmark::utils::print_device_information(q.get_device());
+
+#if defined(BLAS_MEMPOOL_BENCHMARK) && !defined(__ADAPTIVECPP__)
+  // Scratchpad memory pool shared by all the benchmarks of the executable
+  blas::Temp_Mem_Pool mem_pool(q);
+  blas::SB_Handle sb_handle(&mem_pool);
+#else
+  blas::SB_Handle sb_handle(q);
+#endif
+
+  bool success = true;
+  blas_benchmark::create_benchmark(args, &sb_handle, &success);
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return success ? 0 : 1;
+}
@@ -24,6 +24,8 @@
 #ifndef ONEMATH_SYCL_BLAS_META_H
 #define ONEMATH_SYCL_BLAS_META_H
 
+#include <cctype>
+#include <stdexcept>
 #include <sycl/sycl.hpp>
 #include <type_traits>
 #include <utility>
@@ -201,6 +203,27 @@ template <class type>
 struct is_half
     : std::integral_constant<bool, std::is_same_v<type, sycl::half>> {};
 
+#ifdef BLAS_ENABLE_BFLOAT16
+using bfloat16 = sycl::ext::oneapi::bfloat16;
+
+template <class type>
+struct is_bfloat16
+    : std::integral_constant<bool, std::is_same_v<type, bfloat16>> {};
+#else
+template <class type>
+struct is_bfloat16 : std::false_type {};
+#endif
+
+/**
+ * @brief Defines if a type is a 16-bit floating point type, whose reductions
+ * accumulate in float.
+ * @tparam type The type to be tested.
+ */
+template <class type>
+struct is_reduced_precision
+    : std::integral_constant<bool, is_half<type>::value ||
+                                       is_bfloat16<type>::value> {};
+
 #ifdef BLAS_ENABLE_COMPLEX
 // SYCL Complex type alias
 template <typename T>
@@ -220,6 +243,42 @@ struct is_complex_std
 
 #endif
 
+/**
+ * @brief Options of the col-major problem equivalent to a row-major one. A
+ * row-major matrix has the memory of its col-major transpose, so a row-major
+ * operation maps onto the col-major kernels by swapping the transposition, the
+ * triangle or the side of the matrices, without moving any data.
+ */
+template <typename element_t>
+inline char swap_transpose(char trans) {
+  trans = static_cast<char>(tolower(trans));
+#ifdef BLAS_ENABLE_COMPLEX
+  // The conjugate transpose of the col-major transpose is the conjugate of
+  // the matrix, which the col-major operations can't express
+  if (is_complex_sycl<element_t>::value && trans == 'c') {
+    throw std::invalid_argument(
+        "conjugate transpose of a row-major complex matrix is not supported");
+  }
+#endif
+  return trans == 'n' ? 't' : ((trans == 't' || trans == 'c') ? 'n' : trans);
+}
+
+// Hermitian operations only take 'n' and 'c'
+inline char swap_conj_transpose(char trans) {
+  trans = static_cast<char>(tolower(trans));
+  return trans == 'n' ? 'c' : (trans == 'c' ? 'n' : trans);
+}
+
+inline char swap_uplo(char uplo) {
+  uplo = static_cast<char>(tolower(uplo));
+  return uplo == 'u' ? 'l' : (uplo == 'l' ? 'u' : uplo);
+}
+
+inline char swap_side(char side) {
+  side = static_cast<char>(tolower(side));
+  return side == 'l' ? 'r' : (side == 'r' ? 'l' : side);
+}
+
 class unsupported_exception : public std::runtime_error {
  public:
   unsupported_exception(const std::string &operator_name)
@@ -107,6 +107,10 @@ inline size_t get_num_compute_units(sycl::queue &q) {
       .template get_info<sycl::info::device::max_compute_units>();
 }
 
+inline size_t get_local_mem_size(sycl::queue &q) {
+  return q.get_device().template get_info<sycl::info::device::local_mem_size>();
+}
+
 /* @brief Copying the data back to device
   @tparam element_t is the type of the data
   @param src is the host pointer we want to copy from.
@@ -143,11 +147,13 @@ inline sycl::event copy_to_device(
   @param size is the number of elements to be copied
 */
 template <typename element_t>
-inline sycl::event copy_to_host(sycl::queue q, BufferIterator<element_t> src,
-                                element_t *dst, size_t size) {
+inline sycl::event copy_to_host(
+    sycl::queue q, BufferIterator<element_t> src, element_t *dst, size_t size,
+    const std::vector<sycl::event> &_dependencies = {}) {
   auto event = q.submit([&](sycl::handler &cgh) {
     auto acc =
         src.template get_range_accessor<sycl::access_mode::read>(cgh, size);
+    cgh.depends_on(_dependencies);
     cgh.copy(acc, dst);
   });
   return event;
@@ -155,15 +161,17 @@ inline sycl::event copy_to_host(sycl::queue q, BufferIterator<element_t> src,
 
 #ifdef SB_ENABLE_USM
 template <typename element_t>
-inline sycl::event copy_to_host(sycl::queue q, element_t *src, element_t *dst,
-                                size_t size) {
-  auto event = q.memcpy(dst, src, size * sizeof(element_t));
+inline sycl::event copy_to_host(
+    sycl::queue q, element_t *src, element_t *dst, size_t size,
+    const std::vector<sycl::event> &_dependencies = {}) {
+  auto event = q.memcpy(dst, src, size * sizeof(element_t), _dependencies);
   return event;
 }
 template <typename element_t>
-inline sycl::event copy_to_host(sycl::queue q, const element_t *src,
-                                element_t *dst, size_t size) {
-  auto event = q.memcpy(dst, src, size * sizeof(element_t));
+inline sycl::event copy_to_host(
+    sycl::queue q, const element_t *src, element_t *dst, size_t size,
+    const std::vector<sycl::event> &_dependencies = {}) {
+  auto event = q.memcpy(dst, src, size * sizeof(element_t), _dependencies);
   return event;
 }
 
@@ -142,6 +142,17 @@ typename sb_handle_t::event_t _asum_impl(
     container_1_t _rs, const index_t number_WG,
     const typename sb_handle_t::event_t &_dependencies);
 
+/*!
+ * \brief Prototype for the vectorized execution of the element-wise
+ * operators (axpy, copy, scal, swap and rot) on unit-stride vectors. See
+ * documentation in the blas1_interface.hpp file for details.
+ */
+template <int localSize, int vectorSize, int unroll, typename sb_handle_t,
+          typename expression_tree_t, typename index_t>
+typename sb_handle_t::event_t _elementwise_impl(
+    sb_handle_t &sb_handle, expression_tree_t t, const index_t number_WG,
+    const typename sb_handle_t::event_t &_dependencies);
+
 template <int localSize, int localMemSize, bool is_max, bool single,
           typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename index_t, typename increment_t>
@@ -527,6 +538,81 @@ typename ValueType<container_t>::type _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies);
 
+/**
+ * \brief Computes the inner product of two vectors with double precision
+ * accumulation (asynchronous version that returns a Scalar_Result)
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ * @return Result of the inner product, copied to the host asynchronously.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Result<typename ValueType<container_0_t>::type> _dot_async(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum
+ * (asynchronous version that returns a Scalar_Result)
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<index_t> _iamax_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum
+ * (asynchronous version that returns a Scalar_Result)
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<index_t> _iamin_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief ASUM Takes the sum of the absolute values (asynchronous version that
+ * returns a Scalar_Result)
+ *
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<typename ValueType<container_t>::type> _asum_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector (asynchronous version
+ * that returns a Scalar_Result)
+ *
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<typename ValueType<container_t>::type> _nrm2_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies);
+
 }  // namespace internal
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
@@ -998,5 +1084,91 @@ typename ValueType<container_t>::type _nrm2(
   return internal::_nrm2(sb_handle, _N, _vx, _incx, _dependencies);
 }
 
+/**
+ * \brief Computes the inner product of two vectors with double precision
+ * accumulation. The result is copied to the host asynchronously and read with
+ * Scalar_Result::get, so several reductions can be submitted before waiting.
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+Scalar_Result<typename ValueType<container_0_t>::type> _dot_async(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  return internal::_dot_async(sb_handle, _N, _vx, _incx, _vy, _incy,
+                              _dependencies);
+}
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum. The
+ * result is copied to the host asynchronously.
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<index_t> _iamax_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  return internal::_iamax_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum. The
+ * result is copied to the host asynchronously.
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<index_t> _iamin_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  return internal::_iamin_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values. The result is copied to
+ * the host asynchronously.
+ *
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<typename ValueType<container_t>::type> _asum_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  return internal::_asum_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector. The result is copied to
+ * the host asynchronously.
+ *
+ * @param sb_handle SB_Handle
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vector X
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<typename ValueType<container_t>::type> _nrm2_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies = {}) {
+  return internal::_nrm2_async(sb_handle, _N, _vx, _incx, _dependencies);
+}
+
 }  // end namespace blas
 #endif  // ONEMATH_SYCL_BLAS_BLAS1_INTERFACE
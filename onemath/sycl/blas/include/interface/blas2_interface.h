@@ -651,6 +651,32 @@ typename sb_handle_t::event_t inline _gemv(
                          _incx, _beta, _vy, _incy, _dependencies);
 }
 
+/*!
+ @brief Generalised matrix vector product with a matrix stored in the given
+ layout.
+
+ A row-major _M x _N matrix is the col-major _N x _M transpose with the same
+ memory, so the row-major gemv runs the col-major kernel of the opposite
+ transposition.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _gemv(
+    sb_handle_t& sb_handle, access_layout _layout, char _trans, index_t _M,
+    index_t _N, element_t _alpha, container_0_t _mA, index_t _lda,
+    container_1_t _vx, increment_t _incx, element_t _beta, container_2_t _vy,
+    increment_t _incy,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemv(sb_handle, swap_transpose<element_t>(_trans), _N,
+                           _M, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                           _incy, _dependencies);
+  }
+  return internal::_gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx,
+                         _incx, _beta, _vy, _incy, _dependencies);
+}
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -712,6 +738,30 @@ typename sb_handle_t::event_t inline _trsv(
                          _incx, _dependencies);
 }
 
+/**
+ * @brief Linear system solver for triangular matrices stored in the given
+ * layout.
+ *
+ * A row-major matrix is the col-major transpose with the same memory, so the
+ * row-major trsv solves with the opposite triangle and transposition.
+ */
+template <typename sb_handle_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename sb_handle_t::event_t inline _trsv(
+    sb_handle_t& sb_handle, access_layout _layout, char _Uplo, char _trans,
+    char _Diag, index_t _N, container_0_t _mA, index_t _lda, container_1_t _vx,
+    increment_t _incx,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    using element_t = typename ValueType<container_0_t>::type;
+    return internal::_trsv(sb_handle, swap_uplo(_Uplo),
+                           swap_transpose<element_t>(_trans), _Diag, _N, _mA,
+                           _lda, _vx, _incx, _dependencies);
+  }
+  return internal::_trsv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                         _incx, _dependencies);
+}
+
 /*!
  @brief Generalised matrix vector product with a rectangular symmetric
  matrix, followed by a vector sum.
@@ -785,6 +835,29 @@ typename sb_handle_t::event_t inline _ger(
                         _lda, _dependencies);
 }
 
+/**
+ * @brief Generalised vector product followed by a sum with a rectangular
+ * matrix stored in the given layout.
+ *
+ * The row-major A += alpha * x * y^T is computed as the col-major
+ * A^T += alpha * y * x^T on the same memory.
+ */
+template <typename sb_handle_t, typename index_t, typename element_t,
+          typename container_0_t, typename increment_t, typename container_1_t,
+          typename container_2_t>
+typename sb_handle_t::event_t inline _ger(
+    sb_handle_t& sb_handle, access_layout _layout, index_t _M, index_t _N,
+    element_t _alpha, container_0_t _vx, increment_t _incx, container_1_t _vy,
+    increment_t _incy, container_2_t _mA, index_t _lda,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_ger(sb_handle, _N, _M, _alpha, _vy, _incy, _vx, _incx,
+                          _mA, _lda, _dependencies);
+  }
+  return internal::_ger(sb_handle, _M, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
+                        _lda, _dependencies);
+}
+
 /*!
  @brief Generalised vector product sum.
 
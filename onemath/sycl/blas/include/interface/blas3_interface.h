@@ -63,6 +63,63 @@ typename sb_handle_t::event_t _gemm_strided_batched(
     element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
     index_t batch_size, const typename sb_handle_t::event_t& _dependencies);
 
+#ifdef SB_ENABLE_USM
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+    const index_t* _M, const index_t* _N, const index_t* _K,
+    const element_t* _alpha, const container_0_t* a_, const index_t* _lda,
+    const container_1_t* b_, const index_t* _ldb, const element_t* _beta,
+    const container_2_t* _C, const index_t* _ldc, index_t group_count,
+    const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, const container_0_t* a_, index_t _lda,
+    const container_1_t* b_, index_t _ldb, element_t _beta,
+    const container_2_t* _C, index_t _ldc, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+#endif  // SB_ENABLE_USM
+
+template <typename value_t, typename index_t>
+index_t _gemm_pack_get_size(gemm_pack_matrix_t matrix, index_t _M, index_t _N,
+                            index_t _K);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_pack(
+    sb_handle_t& sb_handle, gemm_pack_matrix_t matrix, char _Trans, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t src_, index_t _ld,
+    container_1_t packed_, const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_compute(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemmt(
+    sb_handle_t& sb_handle, char _uplo, char _TransA, char _TransB, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_0_t b_, index_t _ldb, element_t _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _trmm(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    container_1_t B, index_t ldb,
+    const typename sb_handle_t::event_t& _dependencies);
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
 typename sb_handle_t::event_t _trsm(
@@ -79,6 +136,40 @@ typename sb_handle_t::event_t _symm(
     index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc,
     const typename sb_handle_t::event_t& _dependencies);
 
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syr2k(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies);
+
+#ifdef BLAS_ENABLE_COMPLEX
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _herk(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _her2k(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, typename element_t::value_type _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies);
+#endif  // BLAS_ENABLE_COMPLEX
+
 }  // namespace internal
 
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
@@ -92,6 +183,27 @@ typename sb_handle_t::event_t _gemm(
                          _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
 }
 
+/*!
+ * @brief gemm with matrices stored in the given layout. A row-major gemm is
+ * computed as the col-major C^T = alpha * op(B)^T * op(A)^T + beta * C^T on the
+ * same memory, so no transposition of the matrices is needed.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm(
+    sb_handle_t& sb_handle, access_layout _layout, char _TransA, char _TransB,
+    index_t _M, index_t _N, index_t _K, element_t _alpha, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb, element_t _beta,
+    container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm(sb_handle, _TransB, _TransA, _N, _M, _K, _alpha, b_,
+                           _ldb, a_, _lda, _beta, _C, _ldc, _dependencies);
+  }
+  return internal::_gemm(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_,
+                         _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _gemm_batched(
@@ -106,6 +218,29 @@ typename sb_handle_t::event_t _gemm_batched(
                                  batch_size, batch_type, _dependencies);
 }
 
+/*!
+ * @brief gemm_batched with matrices stored in the given layout, see the
+ * row-major _gemm.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batched(
+    sb_handle_t& sb_handle, access_layout _layout, char _TransA, char _TransB,
+    index_t _M, index_t _N, index_t _K, element_t _alpha, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb, element_t _beta,
+    container_2_t _C, index_t _ldc, index_t batch_size,
+    gemm_batch_type_t batch_type = gemm_batch_type_t::strided,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_batched(sb_handle, _TransB, _TransA, _N, _M, _K,
+                                   _alpha, b_, _ldb, a_, _lda, _beta, _C, _ldc,
+                                   batch_size, batch_type, _dependencies);
+  }
+  return internal::_gemm_batched(sb_handle, _TransA, _TransB, _M, _N, _K,
+                                 _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                                 batch_size, batch_type, _dependencies);
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _gemm_strided_batched(
@@ -120,6 +255,290 @@ typename sb_handle_t::event_t _gemm_strided_batched(
       _ldb, _strideb, _beta, _C, _ldc, _stridec, batch_size, _dependencies);
 }
 
+/*!
+ * @brief gemm_strided_batched with matrices stored in the given layout, see
+ * the row-major _gemm.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_strided_batched(
+    sb_handle_t& sb_handle, access_layout _layout, char _TransA, char _TransB,
+    index_t _M, index_t _N, index_t _K, element_t _alpha, container_0_t a_,
+    index_t _lda, index_t _stridea, container_1_t b_, index_t _ldb,
+    index_t _strideb, element_t _beta, container_2_t _C, index_t _ldc,
+    index_t _stridec, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_strided_batched(
+        sb_handle, _TransB, _TransA, _N, _M, _K, _alpha, b_, _ldb, _strideb,
+        a_, _lda, _stridea, _beta, _C, _ldc, _stridec, batch_size,
+        _dependencies);
+  }
+  return internal::_gemm_strided_batched(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, _stridea, b_,
+      _ldb, _strideb, _beta, _C, _ldc, _stridec, batch_size, _dependencies);
+}
+
+#ifdef SB_ENABLE_USM
+/*!
+ * @brief Grouped gemm, following the oneMKL group API. Each of the group_count
+ * groups has its own transpositions, sizes, leading dimensions and scalars,
+ * shared by its group_size[g] products. a_, b_ and _C are arrays of USM
+ * pointers to the matrices of all the groups, one after the other. All the
+ * products are computed in a single launch.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+    const index_t* _M, const index_t* _N, const index_t* _K,
+    const element_t* _alpha, const container_0_t* a_, const index_t* _lda,
+    const container_1_t* b_, const index_t* _ldb, const element_t* _beta,
+    const container_2_t* _C, const index_t* _ldc, index_t group_count,
+    const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_gemm_batch(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+                               a_, _lda, b_, _ldb, _beta, _C, _ldc, group_count,
+                               group_size, _dependencies);
+}
+
+/*!
+ * @brief gemm_batch with matrices stored in the given layout, see the
+ * row-major _gemm.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, access_layout _layout, const char* _TransA,
+    const char* _TransB, const index_t* _M, const index_t* _N,
+    const index_t* _K, const element_t* _alpha, const container_0_t* a_,
+    const index_t* _lda, const container_1_t* b_, const index_t* _ldb,
+    const element_t* _beta, const container_2_t* _C, const index_t* _ldc,
+    index_t group_count, const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_batch(sb_handle, _TransB, _TransA, _N, _M, _K,
+                                 _alpha, b_, _ldb, a_, _lda, _beta, _C, _ldc,
+                                 group_count, group_size, _dependencies);
+  }
+  return internal::_gemm_batch(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+                               a_, _lda, b_, _ldb, _beta, _C, _ldc, group_count,
+                               group_size, _dependencies);
+}
+
+/*!
+ * @brief Batched gemm of batch_size matrices that share their sizes, given by
+ * arrays of USM pointers, so the matrices can be in separate allocations.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, const container_0_t* a_, index_t _lda,
+    const container_1_t* b_, index_t _ldb, element_t _beta,
+    const container_2_t* _C, index_t _ldc, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_gemm_batch(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+                               a_, _lda, b_, _ldb, _beta, _C, _ldc, batch_size,
+                               _dependencies);
+}
+
+/*!
+ * @brief Pointer array gemm_batch with matrices stored in the given layout,
+ * see the row-major _gemm.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, access_layout _layout, char _TransA, char _TransB,
+    index_t _M, index_t _N, index_t _K, element_t _alpha,
+    const container_0_t* a_, index_t _lda, const container_1_t* b_,
+    index_t _ldb, element_t _beta, const container_2_t* _C, index_t _ldc,
+    index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_batch(sb_handle, _TransB, _TransA, _N, _M, _K,
+                                 _alpha, b_, _ldb, a_, _lda, _beta, _C, _ldc,
+                                 batch_size, _dependencies);
+  }
+  return internal::_gemm_batch(sb_handle, _TransA, _TransB, _M, _N, _K, _alpha,
+                               a_, _lda, b_, _ldb, _beta, _C, _ldc, batch_size,
+                               _dependencies);
+}
+#endif  // SB_ENABLE_USM
+
+/*!
+ * @brief Number of elements of value_t of the buffer holding op(A) (m x k) or
+ * op(B) (k x n) packed by _gemm_pack.
+ */
+template <typename value_t, typename index_t>
+index_t _gemm_pack_get_size(gemm_pack_matrix_t matrix, index_t _M, index_t _N,
+                            index_t _K) {
+  return internal::_gemm_pack_get_size<value_t>(matrix, _M, _N, _K);
+}
+
+/*!
+ * @brief _gemm_pack_get_size of a gemm with matrices stored in the given
+ * layout.
+ */
+template <typename value_t, typename index_t>
+index_t _gemm_pack_get_size(access_layout _layout, gemm_pack_matrix_t matrix,
+                            index_t _M, index_t _N, index_t _K) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_pack_get_size<value_t>(
+        matrix == gemm_pack_matrix_t::a ? gemm_pack_matrix_t::b
+                                        : gemm_pack_matrix_t::a,
+        _N, _M, _K);
+  }
+  return internal::_gemm_pack_get_size<value_t>(matrix, _M, _N, _K);
+}
+
+/*!
+ * @brief Packs alpha * op(A) or alpha * op(B) of a gemm in the layout read by
+ * _gemm_compute, following the oneMKL packed gemm API. A matrix reused by
+ * several gemms, such as fixed weights, can be packed once, the gemms then
+ * loading its tiles contiguously without transposition. packed_ holds
+ * _gemm_pack_get_size elements, and is only valid for gemms of the same
+ * sizes on the same backend.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_pack(
+    sb_handle_t& sb_handle, gemm_pack_matrix_t matrix, char _Trans, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t src_, index_t _ld,
+    container_1_t packed_,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_gemm_pack(sb_handle, matrix, _Trans, _M, _N, _K, _alpha,
+                              src_, _ld, packed_, _dependencies);
+}
+
+/*!
+ * @brief _gemm_pack with matrices stored in the given layout. Packing op(A)
+ * of a row-major gemm packs op(B) of the col-major gemm it is computed as.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_pack(
+    sb_handle_t& sb_handle, access_layout _layout, gemm_pack_matrix_t matrix,
+    char _Trans, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t src_, index_t _ld, container_1_t packed_,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_pack(sb_handle,
+                                matrix == gemm_pack_matrix_t::a
+                                    ? gemm_pack_matrix_t::b
+                                    : gemm_pack_matrix_t::a,
+                                _Trans, _N, _M, _K, _alpha, src_, _ld,
+                                packed_, _dependencies);
+  }
+  return internal::_gemm_pack(sb_handle, matrix, _Trans, _M, _N, _K, _alpha,
+                              src_, _ld, packed_, _dependencies);
+}
+
+/*!
+ * @brief Computes C = op(A) * op(B) + beta * C where _TransA and/or _TransB
+ * may be 'p' for an operand packed by _gemm_pack, whose alpha applies. The
+ * leading dimension of a packed operand is ignored. Without packed operand,
+ * this is a gemm with alpha one.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_compute(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_gemm_compute(sb_handle, _TransA, _TransB, _M, _N, _K, a_,
+                                 _lda, b_, _ldb, _beta, _C, _ldc,
+                                 _dependencies);
+}
+
+/*!
+ * @brief _gemm_compute with matrices stored in the given layout, see the
+ * row-major _gemm. The packed operands must have been packed with the same
+ * layout.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_compute(
+    sb_handle_t& sb_handle, access_layout _layout, char _TransA, char _TransB,
+    index_t _M, index_t _N, index_t _K, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemm_compute(sb_handle, _TransB, _TransA, _N, _M, _K, b_,
+                                   _ldb, a_, _lda, _beta, _C, _ldc,
+                                   _dependencies);
+  }
+  return internal::_gemm_compute(sb_handle, _TransA, _TransB, _M, _N, _K, a_,
+                                 _lda, b_, _ldb, _beta, _C, _ldc,
+                                 _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemmt(
+    sb_handle_t& sb_handle, char _uplo, char _TransA, char _TransB, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_0_t b_, index_t _ldb, element_t _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_gemmt(sb_handle, _uplo, _TransA, _TransB, _N, _K, _alpha,
+                          a_, _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief gemmt with matrices stored in the given layout. A row-major gemmt is
+ * the col-major gemmt of C^T = op(B)^T * op(A)^T, see the row-major _gemm,
+ * updating the opposite triangle.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemmt(
+    sb_handle_t& sb_handle, access_layout _layout, char _uplo, char _TransA,
+    char _TransB, index_t _N, index_t _K, element_t _alpha, container_0_t a_,
+    index_t _lda, container_0_t b_, index_t _ldb, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_gemmt(sb_handle, swap_uplo(_uplo), _TransB, _TransA, _N,
+                            _K, _alpha, b_, _ldb, a_, _lda, _beta, _C, _ldc,
+                            _dependencies);
+  }
+  return internal::_gemmt(sb_handle, _uplo, _TransA, _TransB, _N, _K, _alpha,
+                          a_, _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trmm(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    container_1_t B, index_t ldb,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_trmm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
+                         lda, B, ldb, _dependencies);
+}
+
+/*!
+ * @brief trmm with matrices stored in the given layout. A row-major trmm
+ * computes the col-major B^T = alpha * B^T * op(A)^T on the same memory, see
+ * the row-major _trsm.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trmm(
+    sb_handle_t& sb_handle, access_layout layout, char side, char uplo,
+    char trans, char diag, index_t M, index_t N, element_t alpha,
+    container_0_t A, index_t lda, container_1_t B, index_t ldb,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (layout == access_layout::row_major) {
+    return internal::_trmm(sb_handle, swap_side(side), swap_uplo(uplo), trans,
+                           diag, N, M, alpha, A, lda, B, ldb, _dependencies);
+  }
+  return internal::_trmm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
+                         lda, B, ldb, _dependencies);
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
 typename sb_handle_t::event_t inline _trsm(
@@ -131,6 +550,26 @@ typename sb_handle_t::event_t inline _trsm(
                          lda, B, ldb, _dependencies);
 }
 
+/*!
+ * @brief trsm with matrices stored in the given layout. A row-major trsm
+ * solves the col-major X^T * op(A)^T = alpha * B^T on the same memory, where
+ * the transpose of A has the opposite triangle.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t inline _trsm(
+    sb_handle_t& sb_handle, access_layout layout, char side, char uplo,
+    char trans, char diag, index_t M, index_t N, element_t alpha,
+    container_0_t A, index_t lda, container_1_t B, index_t ldb,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (layout == access_layout::row_major) {
+    return internal::_trsm(sb_handle, swap_side(side), swap_uplo(uplo), trans,
+                           diag, N, M, alpha, A, lda, B, ldb, _dependencies);
+  }
+  return internal::_trsm(sb_handle, side, uplo, trans, diag, M, N, alpha, A,
+                         lda, B, ldb, _dependencies);
+}
+
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename sb_handle_t::event_t _symm(
@@ -142,5 +581,156 @@ typename sb_handle_t::event_t _symm(
                          _ldb, _beta, _C, _ldc, _dependencies);
 }
 
+/*!
+ * @brief symm with matrices stored in the given layout. A row-major symm is
+ * computed as the col-major symm of the transposed problem on the same memory,
+ * with the opposite side and triangle.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _symm(
+    sb_handle_t& sb_handle, access_layout _layout, char _side, char _uplo,
+    index_t _M, index_t _N, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_symm(sb_handle, swap_side(_side), swap_uplo(_uplo), _N,
+                           _M, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                           _dependencies);
+  }
+  return internal::_symm(sb_handle, _side, _uplo, _M, _N, _alpha, a_, _lda, b_,
+                         _ldb, _beta, _C, _ldc, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_syrk(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                         _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief syrk with matrices stored in the given layout. A row-major syrk is
+ * the col-major syrk of the transposed A on the same memory, updating the
+ * opposite triangle of C.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk(
+    sb_handle_t& sb_handle, access_layout _layout, char _uplo, char _trans,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_syrk(sb_handle, swap_uplo(_uplo),
+                           swap_transpose<element_t>(_trans), _N, _K, _alpha,
+                           a_, _lda, _beta, _C, _ldc, _dependencies);
+  }
+  return internal::_syrk(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                         _beta, _C, _ldc, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syr2k(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_syr2k(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                          b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief syr2k with matrices stored in the given layout, see the row-major
+ * _syrk.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syr2k(
+    sb_handle_t& sb_handle, access_layout _layout, char _uplo, char _trans,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_0_t b_, index_t _ldb, element_t _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_syr2k(sb_handle, swap_uplo(_uplo),
+                            swap_transpose<element_t>(_trans), _N, _K,
+                            _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                            _dependencies);
+  }
+  return internal::_syr2k(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                          b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+
+#ifdef BLAS_ENABLE_COMPLEX
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _herk(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_herk(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                         _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief herk with matrices stored in the given layout. The row-major C is
+ * the col-major conj(C), which is the col-major herk of the conjugate
+ * transposed A, updating the opposite triangle.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _herk(
+    sb_handle_t& sb_handle, access_layout _layout, char _uplo, char _trans,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_herk(sb_handle, swap_uplo(_uplo),
+                           swap_conj_transpose(_trans), _N, _K, _alpha, a_,
+                           _lda, _beta, _C, _ldc, _dependencies);
+  }
+  return internal::_herk(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                         _beta, _C, _ldc, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _her2k(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, typename element_t::value_type _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_her2k(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                          b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief her2k with matrices stored in the given layout, see the row-major
+ * _herk. A and B are swapped so that alpha still scales the same product.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _her2k(
+    sb_handle_t& sb_handle, access_layout _layout, char _uplo, char _trans,
+    index_t _N, index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_0_t b_, index_t _ldb, typename element_t::value_type _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  if (_layout == access_layout::row_major) {
+    return internal::_her2k(sb_handle, swap_uplo(_uplo),
+                            swap_conj_transpose(_trans), _N, _K, _alpha, b_,
+                            _ldb, a_, _lda, _beta, _C, _ldc, _dependencies);
+  }
+  return internal::_her2k(sb_handle, _uplo, _trans, _N, _K, _alpha, a_, _lda,
+                          b_, _ldb, _beta, _C, _ldc, _dependencies);
+}
+#endif  // BLAS_ENABLE_COMPLEX
+
 }  // namespace blas
 #endif  // ONEMATH_SYCL_BLAS_BLAS3_INTERFACE
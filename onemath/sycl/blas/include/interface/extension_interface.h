@@ -25,6 +25,7 @@
 #define ONEMATH_SYCL_BLAS_EXTENSION_INTERFACE_H
 
 #include "operations/extension/reduction.h"
+#include "operations/extension/reduction_batch.h"
 #include "operations/extension/transpose.h"
 #include "sb_handle/handle.h"
 
@@ -161,6 +162,62 @@ typename sb_handle_t::event_t _axpy_batch_impl(
     index_t _stride_y, index_t _batch_size,
     const typename sb_handle_t::event_t& _dependencies, index_t global_size);
 
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _dot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _asum_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _nrm2_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <batch_reduction_t op, int localSize, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch_impl(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies, index_t num_wg);
+
+template <gemm_bias_t bias, gemm_activation_t activation, bool residual,
+          typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_epilogue(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    container_3_t _bias, index_t _stride_bias, container_4_t _residual,
+    index_t _ldr, index_t _stride_residual, element_t _scale,
+    element_t _clamp_min, element_t _clamp_max, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename scale_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_requantize(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    scale_t _scale, element_t _zero_point, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies);
+
 }  // namespace internal
 
 /**
@@ -392,6 +449,79 @@ typename sb_handle_t::event_t _axpy_batch(
                                _dependencies);
 }
 
+/**
+ * \brief Computes the inner products of a batch of pairs of vectors
+ *
+ * Implements \f$rs_i = x_i \cdot y_i\f$ for each vector of the batch, all in
+ * a single kernel.
+ *
+ * @param sb_handle SB_Handle
+ * @param _N Size of the vectors
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _vy BufferIterator or USM pointer
+ * @param _incy Increment for the vectors Y
+ * @param _stride_y Stride distance of two consecutive vectors in Y
+ * @param _rs BufferIterator or USM pointer of _batch_size contiguous results
+ * @param _batch_size number of dot operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _dot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_dot_batch(sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy,
+                              _stride_y, _rs, _batch_size, _dependencies);
+}
+
+/**
+ * \brief Computes the sums of the absolute values of a batch of vectors
+ *
+ * @param sb_handle SB_Handle
+ * @param _N Size of the vectors
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _rs BufferIterator or USM pointer of _batch_size contiguous results
+ * @param _batch_size number of asum operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _asum_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_asum_batch(sb_handle, _N, _vx, _incx, _stride_x, _rs,
+                               _batch_size, _dependencies);
+}
+
+/**
+ * \brief Computes the euclidean norms of a batch of vectors
+ *
+ * @param sb_handle SB_Handle
+ * @param _N Size of the vectors
+ * @param _vx BufferIterator or USM pointer
+ * @param _incx Increment for the vectors X
+ * @param _stride_x Stride distance of two consecutive vectors in X
+ * @param _rs BufferIterator or USM pointer of _batch_size contiguous results
+ * @param _batch_size number of nrm2 operations to compute
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _nrm2_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return internal::_nrm2_batch(sb_handle, _N, _vx, _incx, _stride_x, _rs,
+                               _batch_size, _dependencies);
+}
+
 namespace extension {
 /**
  * \brief Transpose a Matrix in-place
@@ -459,6 +589,141 @@ typename sb_handle_t::event_t _reduction(
       _dependencies);
 }
 
+/**
+ * \brief Computes a gemm followed by an epilogue, in a single kernel
+ *
+ * Implements
+ * \f$C = act(\alpha op(A) op(B) + \beta C + bias) \cdot scale +
+ * residual\f$, where the bias, the activation and the residual are applied in
+ * registers before C is stored.
+ *
+ * @tparam bias Whether a bias is added per row or per column of C, see
+ * gemm_bias_t
+ * @tparam activation Activation applied after the bias, see
+ * gemm_activation_t
+ * @tparam residual Whether the residual matrix is added
+ * @param sb_handle SB_Handle
+ * @param _TransA, _TransB Whether A and B are transposed ('n', 't' or 'c')
+ * @param _M, _N, _K Dimensions of the gemm
+ * @param _alpha, _beta Scalars of the gemm
+ * @param a_, b_, _C BufferIterator or USM pointer of A, B and C
+ * @param _lda, _ldb, _ldc Leading dimensions of A, B and C
+ * @param _bias BufferIterator or USM pointer of the contiguous bias vector of
+ * size _M (row bias) or _N (column bias), unused if bias is none
+ * @param _residual BufferIterator or USM pointer of the _M x _N residual
+ * matrix, unused if residual is false
+ * @param _ldr Leading dimension of the residual
+ * @param _scale Scaling factor applied after the activation
+ * @param _clamp_min, _clamp_max Bounds of the clamp activation
+ * @param _dependencies Vector of events
+ */
+template <gemm_bias_t bias, gemm_activation_t activation, bool residual,
+          typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_epilogue(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, container_3_t _bias, container_4_t _residual, index_t _ldr,
+    element_t _scale = element_t{1}, element_t _clamp_min = element_t{0},
+    element_t _clamp_max = element_t{0},
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return blas::internal::_gemm_epilogue<bias, activation, residual>(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, index_t(0),
+      b_, _ldb, index_t(0), _beta, _C, _ldc, index_t(0), _bias, index_t(0),
+      _residual, _ldr, index_t(0), _scale, _clamp_min, _clamp_max, index_t(1),
+      _dependencies);
+}
+
+/**
+ * \brief Strided batched version of _gemm_epilogue
+ *
+ * @param _stridea, _strideb, _stridec Strides between the matrices of A, B
+ * and C
+ * @param _stride_bias Stride between the bias vectors, 0 to use the same bias
+ * for the whole batch
+ * @param _stride_residual Stride between the residual matrices
+ * @param batch_size Number of gemm operations to compute
+ */
+template <gemm_bias_t bias, gemm_activation_t activation, bool residual,
+          typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_epilogue_strided_batched(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    container_3_t _bias, index_t _stride_bias, container_4_t _residual,
+    index_t _ldr, index_t _stride_residual, index_t batch_size,
+    element_t _scale = element_t{1}, element_t _clamp_min = element_t{0},
+    element_t _clamp_max = element_t{0},
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return blas::internal::_gemm_epilogue<bias, activation, residual>(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, _stridea, b_,
+      _ldb, _strideb, _beta, _C, _ldc, _stridec, _bias, _stride_bias,
+      _residual, _ldr, _stride_residual, _scale, _clamp_min, _clamp_max,
+      batch_size, _dependencies);
+}
+
+/**
+ * \brief Computes an integer gemm and requantizes its result, in a single
+ * kernel
+ *
+ * Implements
+ * \f$C = clamp(rint((\alpha op(A) op(B) + \beta C) \cdot scale) +
+ * zero\_point)\f$, accumulating in element_t and saturating to the range of
+ * the type of C, e.g. int8_t inputs and output with int32_t accumulators.
+ *
+ * @param sb_handle SB_Handle
+ * @param _TransA, _TransB Whether A and B are transposed ('n', 't' or 'c')
+ * @param _M, _N, _K Dimensions of the gemm
+ * @param _alpha, _beta Scalars of the gemm
+ * @param a_, b_, _C BufferIterator or USM pointer of A, B and C
+ * @param _lda, _ldb, _ldc Leading dimensions of A, B and C
+ * @param _scale Floating point requantization scale
+ * @param _zero_point Zero point of C
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename scale_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_requantize(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, scale_t _scale, element_t _zero_point = element_t{0},
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return blas::internal::_gemm_requantize(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, index_t(0),
+      b_, _ldb, index_t(0), _beta, _C, _ldc, index_t(0), _scale, _zero_point,
+      index_t(1), _dependencies);
+}
+
+/**
+ * \brief Strided batched version of _gemm_requantize
+ *
+ * @param _stridea, _strideb, _stridec Strides between the matrices of A, B
+ * and C
+ * @param batch_size Number of gemm operations to compute
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename scale_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_requantize_strided_batched(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size, scale_t _scale, element_t _zero_point = element_t{0},
+    const typename sb_handle_t::event_t& _dependencies = {}) {
+  return blas::internal::_gemm_requantize(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, _stridea, b_,
+      _ldb, _strideb, _beta, _C, _ldc, _stridec, _scale, _zero_point,
+      batch_size, _dependencies);
+}
+
 }  // namespace extension
 }  // namespace blas
 
@@ -31,6 +31,7 @@ namespace blas {
 
 /*!
  * @brief Wrapper around Gemm. Creates the views, then makes and launches Gemm
+ * with the given epilogue (see Gemm_Epilogue).
  */
 template <typename container_0_t, typename container_1_t,
           typename container_2_t, int WgSize, bool DoubleBuffer, bool ConflictA,
@@ -40,15 +41,112 @@ template <typename container_0_t, typename container_1_t,
           int BatchType = static_cast<int>(gemm_batch_type_t::strided),
           bool UseJointMatrix = false>
 struct Gemm_Launcher {
-  template <typename sb_handle_t, typename element_t, typename index_t>
+  template <typename sb_handle_t, typename element_t, typename index_t,
+            typename epilogue_t = Gemm_Epilogue_Identity>
   static typename sb_handle_t::event_t _select_gemm(
       sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
       element_t _alpha, container_0_t a_, index_t _lda, index_t _stridea,
       container_1_t b_, index_t _ldb, index_t _strideb, element_t _beta,
       container_2_t _C, index_t _ldc, index_t _stridec, index_t batch_size,
-      const typename sb_handle_t::event_t& _dependencies = {});
+      const typename sb_handle_t::event_t& _dependencies = {},
+      epilogue_t _epilogue = epilogue_t());
 };
 
+/*!
+ * @brief Whether the last wave of num_tiles work groups, one per tile, leaves
+ * enough compute units idle for the Stream-K Gemm to be worth its fixups.
+ * With more than a few waves the last one is a small part of the run.
+ */
+template <typename index_t>
+inline bool is_wave_quantized(index_t compute_units, index_t num_tiles) {
+  constexpr index_t max_waves = 4;
+  const index_t waves = (num_tiles - 1) / compute_units + 1;
+  return waves <= max_waves &&
+         10 * num_tiles < 9 * waves * compute_units;
+}
+
+/*!
+ * @brief Whether the default backend runs a Gemm with Stream-K: a single
+ * product deep enough in K, whose 32x32 tiles are too few to keep all the
+ * compute units busy. Takes precedence over the CPU Gemm, which spreads the
+ * blocks of C, not K, over the cores.
+ */
+template <typename index_t>
+inline bool use_stream_k(index_t compute_units, index_t _M, index_t _N,
+                         index_t _K, index_t batch_size) {
+  return batch_size == 1 && _K >= 256 && (_M * _N) < 524288 &&
+         is_wave_quantized(compute_units,
+                           ((_M - 1) / 32 + 1) * ((_N - 1) / 32 + 1));
+}
+
+/*!
+ * @brief Wrapper around GemmPack and GemmPacked, see _gemm_pack and
+ * _gemm_compute. The tile sets the layout of the packed matrices, so a
+ * backend uses a single Gemm_Packed_Launcher.
+ */
+template <int ClSize, typename TileT>
+struct Gemm_Packed_Launcher {
+  template <typename value_t, typename index_t>
+  static index_t get_packed_size(gemm_pack_matrix_t matrix, index_t _M,
+                                 index_t _N, index_t _K);
+
+  template <bool Trans, typename sb_handle_t, typename container_0_t,
+            typename container_1_t, typename element_t, typename index_t>
+  static typename sb_handle_t::event_t _pack(
+      sb_handle_t& sb_handle, gemm_pack_matrix_t matrix, index_t _M,
+      index_t _N, index_t _K, element_t _alpha, container_0_t src_,
+      index_t _ld, container_1_t packed_,
+      const typename sb_handle_t::event_t& _dependencies);
+
+  template <bool TransA, bool TransB, bool PackedA, bool PackedB,
+            bool is_beta_zero, typename sb_handle_t, typename container_0_t,
+            typename container_1_t, typename container_2_t,
+            typename element_t, typename index_t>
+  static typename sb_handle_t::event_t _select_gemm(
+      sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+      container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+      element_t _beta, container_2_t _C, index_t _ldc,
+      const typename sb_handle_t::event_t& _dependencies);
+};
+
+/*!
+ * @brief Wrapper around GemmTriangular, used by the rank-k updates of
+ * symmetric and Hermitian matrices.
+ */
+template <int ClSize, typename TileT>
+struct Gemm_Triangular_Launcher {
+  template <bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+            bool Rank2, bool Hermitian, bool is_beta_zero,
+            typename sb_handle_t, typename container_0_t,
+            typename container_1_t, typename element_t, typename index_t>
+  static typename sb_handle_t::event_t _select_gemm(
+      sb_handle_t& sb_handle, index_t _N, index_t _K, element_t _alpha,
+      element_t _alpha2, container_0_t a_, index_t _lda, container_0_t b_,
+      index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+      const typename sb_handle_t::event_t& _dependencies);
+};
+
+#ifdef SB_ENABLE_USM
+/*!
+ * @brief Wrapper around GemmGrouped. Numbers the tiles of the groups, copies
+ * the Gemm_Group to the device, then makes and launches GemmGrouped.
+ */
+template <int ClSize, typename TileT>
+struct Gemm_Grouped_Launcher {
+  template <typename sb_handle_t, typename container_0_t,
+            typename container_1_t, typename container_2_t,
+            typename element_t, typename index_t>
+  static typename sb_handle_t::event_t _select_gemm(
+      sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+      const index_t* _M, const index_t* _N, const index_t* _K,
+      const element_t* _alpha, const container_0_t* a_, const index_t* _lda,
+      const container_1_t* b_, const index_t* _ldb, const element_t* _beta,
+      const container_2_t* _C, const index_t* _ldc, index_t group_count,
+      const index_t* group_size,
+      const typename sb_handle_t::event_t& _dependencies);
+};
+#endif  // SB_ENABLE_USM
+
 }  // namespace blas
 
 #endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_LAUNCHER_H
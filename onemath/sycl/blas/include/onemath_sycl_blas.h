@@ -29,6 +29,12 @@
 
 #include "sb_handle/handle.h"
 
+#include "sb_handle/gemm_tuning_cache.h"
+
+#include "sb_handle/scalar_result.h"
+
+#include "sb_handle/graph.h"
+
 #include "sb_handle/kernel_constructor.h"
 
 #include "interface/blas1_interface.h"
@@ -55,6 +61,8 @@
 
 #include "operations/extension/axpy_batch.h"
 
+#include "operations/extension/reduction_batch.h"
+
 #include "operations/blas_constants.h"
 
 #include "operations/blas_operators.h"
@@ -62,6 +62,8 @@ struct Assign {
   bool valid_thread(sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  void eval_packet(index_t i);
   void bind(sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -82,6 +84,8 @@ struct DoubleAssign {
   bool valid_thread(sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  void eval_packet(index_t i);
   void bind(sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -101,6 +105,8 @@ struct ScalarOp {
   bool valid_thread(sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  sycl::vec<value_t, packet_size> eval_packet(index_t i);
   void bind(sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -118,6 +124,8 @@ struct UnaryOp {
   bool valid_thread(sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  sycl::vec<value_t, packet_size> eval_packet(index_t i);
   void bind(sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -136,6 +144,8 @@ struct BinaryOp {
   bool valid_thread(sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  sycl::vec<value_t, packet_size> eval_packet(index_t i);
   void bind(sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -175,6 +185,29 @@ struct TupleOp {
   void adjust_access_displacement();
 };
 
+/*! Vectorized.
+ * @brief Evaluates an element-wise assignment tree (Assign or DoubleAssign)
+ * on unit-stride vectors, with each work item processing vector_size
+ * contiguous elements with sycl::vec loads and stores, unroll times per
+ * iteration of a grid-stride loop. The elements which do not fill a packet
+ * are evaluated one by one at the end.
+ * The views of the tree are read and written as contiguous memory, whatever
+ * their stride, so the caller must check the strides are 1.
+ */
+template <int vector_size, int unroll, typename tree_t>
+struct Vectorized {
+  using index_t = typename tree_t::index_t;
+  using value_t = typename tree_t::value_t;
+  tree_t tree_;
+
+  Vectorized(tree_t &_t);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  void eval(sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+};
+
 /*! AssignReduction.
  * @brief Implements the reduction operation for assignments (in the form y
  * = x) with y a scalar and x a subexpression tree.
@@ -198,10 +231,46 @@ struct AssignReduction {
   void adjust_access_displacement();
 };
 
+/*! SinglePassReduction.
+ * @brief Implements the reduction of x into the scalar y (y = x) in a single
+ * kernel. Each work group reduces its part of x and stores its result in
+ * partials_, then the last work group to finish, found with the atomic
+ * counter_, reduces the partial results into y.
+ *
+ * The class is constructed using the make_single_pass_reduction function
+ * below.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+struct SinglePassReduction {
+  using value_t = typename ResolveReturnType<operator_t, rhs_t>::type::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  partials_t partials_;  // One value per work group
+  counter_t counter_;    // Number of work groups done, 0 before the kernel
+  SinglePassReduction(lhs_t &_l, rhs_t &_r, partials_t &_partials,
+                      counter_t &_counter);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  template <typename sharedT>
+  value_t reduce_work_group(sharedT scratch, sycl::nd_item<1> ndItem,
+                            value_t val);
+};
+
 /*! .
  * @brief Generic implementation for operators that require a
  * reduction inside kernel code. (i.e. asum)
  *
+ * The elements of rhs are converted to the value type of lhs before being
+ * accumulated, so that 16-bit inputs can be reduced into a float result.
+ *
  * The class is constructed using the make_wg_atomic_reduction
  * function below.
  *
@@ -303,6 +372,15 @@ inline AssignReduction<operator_t, lhs_t, rhs_t> make_assign_reduction(
       lhs_, rhs_, local_num_thread_, global_num_thread_);
 }
 
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+inline SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t, counter_t>
+make_single_pass_reduction(lhs_t &lhs_, rhs_t &rhs_, partials_t &partials_,
+                           counter_t &counter_) {
+  return SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t, counter_t>(
+      lhs_, rhs_, partials_, counter_);
+}
+
 template <typename operator_t, bool usmManagedMem = false, typename lhs_t,
           typename rhs_t>
 inline WGAtomicReduction<operator_t, usmManagedMem, lhs_t, rhs_t>
@@ -310,6 +388,11 @@ make_wg_atomic_reduction(lhs_t &lhs_, rhs_t &rhs_) {
   return WGAtomicReduction<operator_t, usmManagedMem, lhs_t, rhs_t>(lhs_, rhs_);
 }
 
+template <int vector_size, int unroll, typename tree_t>
+inline Vectorized<vector_size, unroll, tree_t> make_vectorized(tree_t &tree_) {
+  return Vectorized<vector_size, unroll, tree_t>(tree_);
+}
+
 template <bool is_max, bool is_step0, typename lhs_t, typename rhs_t>
 inline IndexMaxMin<is_max, is_step0, lhs_t, rhs_t> make_index_max_min(
     lhs_t &lhs_, rhs_t &rhs_) {
@@ -38,9 +38,18 @@ enum class gemm_memory_t : int { local = 0, no_local = 1, subgroup = 2 };
 /*
  * @brief Indicates which Gemm algorithm to use.
  * It can be either naive to use a naive algorithm, standard for the default
- * algorithms, or tall_skinny for tall and skinny matrices
+ * algorithms, tall_skinny for tall and skinny matrices, stream_k to
+ * balance the tiles of C and their blocks of K over the compute units (see
+ * GemmStreamK), or cpu for the packed and cache-blocked Gemm of CPU devices
+ * (see GemmCpu)
  */
-enum class gemm_algorithm_t : int { naive = 0, standard = 1, tall_skinny = 2 };
+enum class gemm_algorithm_t : int {
+  naive = 0,
+  standard = 1,
+  tall_skinny = 2,
+  stream_k = 3,
+  cpu = 4
+};
 /*!
  * @brief Indicates which vectorization approach to use.
  * none: No vectorization is used.
@@ -56,6 +65,144 @@ enum class gemm_vectorization_t : int { none = 0, partial = 1, full = 2 };
  */
 enum class gemm_batch_type_t : int { strided = 0, interleaved = 1 };
 
+/*!
+ * @brief Indicates how the tall and skinny Gemm splits K (split-K).
+ * none: K is not split, each work group computes a full tile of C.
+ * atomic: the slices of K add their contribution to C with atomics, C being
+ * scaled by beta beforehand. Only for float and double results.
+ * fixup: the slices of K store their contribution in a workspace, the last
+ * slice of each tile to finish sums them in order into C, so the result is
+ * deterministic.
+ */
+enum class gemm_split_k_t : int { none = 0, atomic = 1, fixup = 2 };
+
+/*!
+ * @brief Indicates the bias added by a Gemm_Epilogue.
+ * none: no bias is added.
+ * row: the bias is a vector of size m, bias[i] is added to the row i of C.
+ * column: the bias is a vector of size n, bias[j] is added to the column j
+ * of C.
+ */
+enum class gemm_bias_t : int { none = 0, row = 1, column = 2 };
+
+/*!
+ * @brief Indicates the element-wise activation applied by a Gemm_Epilogue.
+ * none: no activation.
+ * relu: max(x, 0).
+ * gelu: GELU, using its tanh approximation.
+ * clamp: min(max(x, clamp_min), clamp_max).
+ */
+enum class gemm_activation_t : int { none = 0, relu = 1, gelu = 2, clamp = 3 };
+
+/*!
+ * @brief Indicates the operand of a gemm packed by _gemm_pack.
+ * a: op(A), the m x k left operand.
+ * b: op(B), the k x n right operand.
+ */
+enum class gemm_pack_matrix_t : int { a = 0, b = 1 };
+
+/*!
+ * @brief Epilogue of a Gemm storing alpha * A * B + beta * C unchanged.
+ * It is the default epilogue, with which the Gemm kernels keep their
+ * vectorized stores. It is also used as the type of the unused operands of a
+ * Gemm_Epilogue.
+ */
+struct Gemm_Epilogue_Identity {
+  static constexpr bool is_identity = true;
+  template <typename value_t, typename index_t>
+  value_t eval(value_t value, index_t, index_t, index_t) const noexcept {
+    return value;
+  }
+  void bind(sycl::handler&) {}
+  void adjust_access_displacement() {}
+};
+
+/*!
+ * @brief Epilogue fused in the store of a Gemm. Each element of C is computed
+ * in registers as
+ *   C = activation(alpha * A * B + beta * C + bias) * scale + residual
+ * before being written, instead of being written by the Gemm and read back by
+ * separate kernels.
+ * @tparam Bias  whether a bias is added per row or per column of C
+ * @tparam Activation  activation applied after the bias
+ * @tparam element_t  type of the scalars
+ * @tparam bias_t  vector view of the bias, Gemm_Epilogue_Identity if Bias is
+ *                 none
+ * @tparam residual_t  matrix view of the residual, with the dimensions of C,
+ *                     Gemm_Epilogue_Identity if there is no residual
+ * @param stride_bias_ the stride of the bias batches
+ * @param stride_residual_ the stride of the residual batches
+ * @param scale_ specifies the scalar scale
+ * @param clamp_min_, clamp_max_ the bounds of the clamp activation
+ */
+template <gemm_bias_t Bias, gemm_activation_t Activation, typename element_t,
+          typename index_t, typename bias_t, typename residual_t>
+struct Gemm_Epilogue {
+  static constexpr bool is_identity = false;
+  static constexpr bool has_residual =
+      !std::is_same<residual_t, Gemm_Epilogue_Identity>::value;
+  bias_t bias_;
+  residual_t residual_;
+  index_t stride_bias_;
+  index_t stride_residual_;
+  element_t scale_;
+  element_t clamp_min_;
+  element_t clamp_max_;
+
+  Gemm_Epilogue(bias_t bias, index_t stride_bias, residual_t residual,
+                index_t stride_residual, element_t scale, element_t clamp_min,
+                element_t clamp_max);
+  /*!
+   * @brief Applies the epilogue to value = alpha * A * B + beta * C, the
+   * element (row, col) of the batch batch of C.
+   */
+  element_t eval(element_t value, index_t row, index_t col,
+                 index_t batch) const noexcept;
+  void bind(sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+template <gemm_bias_t Bias, gemm_activation_t Activation, typename element_t,
+          typename index_t, typename bias_t, typename residual_t>
+inline Gemm_Epilogue<Bias, Activation, element_t, index_t, bias_t, residual_t>
+make_gemm_epilogue(bias_t bias, index_t stride_bias, residual_t residual,
+                   index_t stride_residual, element_t scale,
+                   element_t clamp_min, element_t clamp_max) {
+  return Gemm_Epilogue<Bias, Activation, element_t, index_t, bias_t,
+                       residual_t>(bias, stride_bias, residual,
+                                   stride_residual, scale, clamp_min,
+                                   clamp_max);
+}
+
+/*!
+ * @brief Epilogue requantizing the integer accumulators of a Gemm, e.g.
+ * int8_t x int8_t -> int8_t accumulated in int32_t. Each element of C is
+ * computed as
+ *   C = clamp(rint((alpha * A * B + beta * C) * scale) + zero_point,
+ *             q_min, q_max)
+ * where [q_min, q_max] is the range of the type of C.
+ * @tparam element_t  type of the accumulators and of the zero point
+ * @tparam scale_t  floating point type of the scale
+ * @param scale_ the requantization scale
+ * @param zero_point_ the zero point of C
+ * @param q_min_, q_max_ the range the result is saturated to
+ */
+template <typename element_t, typename scale_t, typename index_t>
+struct Gemm_Epilogue_Requantize {
+  static constexpr bool is_identity = false;
+  scale_t scale_;
+  element_t zero_point_;
+  element_t q_min_;
+  element_t q_max_;
+
+  Gemm_Epilogue_Requantize(scale_t scale, element_t zero_point,
+                           element_t q_min, element_t q_max);
+  element_t eval(element_t value, index_t row, index_t col,
+                 index_t batch) const noexcept;
+  void bind(sycl::handler&) {}
+  void adjust_access_displacement() {}
+};
+
 /*!
  * @brief The Tile structure determines the tiling configuration of a gemm
  *        implementation.
@@ -135,6 +282,34 @@ struct Tile {
   static std::string get_type_string() noexcept;
 };
 
+/*!
+ * @brief Blocking of the CPU Gemm, see GemmCpu.
+ *
+ * @tparam MR  rows of the micro-tile of C held in registers, a multiple of the
+ *             SIMD width as the rows are vectorized
+ * @tparam NR  columns of the micro-tile of C
+ * @tparam MC  rows of the panel of A packed for the L2 cache, a multiple of MR
+ * @tparam KC  depth of the packed panels of A and B
+ * @tparam NC  columns of the panel of B packed for the L2 cache, a multiple
+ *             of NR. A KC x NR micro-panel of B stays in the L1 cache.
+ */
+template <int MR, int NR, int MC, int KC, int NC>
+struct Cpu_Tile {
+  static_assert(MC % MR == 0 && NC % NR == 0,
+                "The packed panels must be made of whole micro-panels");
+  static constexpr int item_rows = MR;
+  static constexpr int item_cols = NR;
+  static constexpr int wg_rows = 1;
+  static constexpr int wg_cols = 1;
+  static constexpr int mc = MC;
+  static constexpr int kc = KC;
+  static constexpr int nc = NC;
+  /*!
+   * @brief Get tile type as human readable string.
+   */
+  static std::string get_type_string() noexcept;
+};
+
 /*!
  * @brief GemmFactory is a template class whose instantiations provide
  *        different implementations of the GEMM device function. It also support
@@ -170,6 +345,8 @@ struct Tile {
  * @tparam element_t  type of scalar alpha & beta
  * @tparam UseJointMatrix boolean parameter to decide whether to use
  *                        joint_matrix or not
+ * @tparam epilogue_t  epilogue applied to the elements of C before they are
+ *                     stored, see Gemm_Epilogue
  * @param a_ the lhs_t matrix
  * @param b_ the rhs_t matrix
  * @param c_ the output matrix
@@ -185,12 +362,14 @@ struct Tile {
  * @param strideb the stride of the matrix b_ batches
  * @param stridec the stride of the matrix C_ batches (>=size_c)
  * @param batch_size_ the number batches of matrices of a_ b_ _C
+ * @param epilogue_ the epilogue applied to the elements of C
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix = false>
+          int VectorSize, int BatchType, bool UseJointMatrix = false,
+          typename epilogue_t = Gemm_Epilogue_Identity>
 class Gemm {
  public:
   using value_t = typename input_t::value_t;
@@ -214,22 +393,27 @@ class Gemm {
   index_t strideb_;
   index_t stridec_;
   index_t batch_size_;
+  epilogue_t epilogue_;
 
   // Reject GEMM configurations which do not have a partial specialization and
   // thus would default to the naive implementation. If GemmAlgorithm is set to
   // naive then we know that naive was intentionally selected, otherwise it must
   // be an invalid configuration. An exception is when the algorithm is tall
-  // skinny this assert must pass, as the tall skinny code uses this GEMM as a
-  // wrapper and does not actually call it.
+  // skinny, stream-k or cpu this assert must pass, as their code uses this
+  // GEMM as a wrapper and does not actually call it.
   static_assert(static_cast<gemm_algorithm_t>(GemmAlgorithm) ==
                         gemm_algorithm_t::naive ||
                     static_cast<gemm_algorithm_t>(GemmAlgorithm) ==
-                        gemm_algorithm_t::tall_skinny,
+                        gemm_algorithm_t::tall_skinny ||
+                    static_cast<gemm_algorithm_t>(GemmAlgorithm) ==
+                        gemm_algorithm_t::stream_k ||
+                    static_cast<gemm_algorithm_t>(GemmAlgorithm) ==
+                        gemm_algorithm_t::cpu,
                 "Invalid GEMM configuration options, this would cause the "
                 "naive implementation to be selected");
   Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
        index_t batch_size, index_t stride_a, index_t stride_b,
-       index_t stride_c);
+       index_t stride_c, epilogue_t epilogue = epilogue_t());
   static std::string get_type_string() noexcept;
   index_t get_workgroup_cluster() const noexcept;
   index_t get_num_workgroup_cluster(index_t compute_units) const noexcept;
@@ -244,10 +428,14 @@ class Gemm {
 /*
  * @brief Forward-declaration of the class that executes the partial gemm
  * operation.
+ * @tparam SplitK how K is split, see gemm_split_k_t
+ * @tparam workspace_t view of the slices of the fixup split-K
+ * @tparam counter_t view of the counters of the tiles of the fixup split-K
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename TileType, bool TransA, bool TransB,
-          bool IsFinal, bool IsBetaZero, typename element_t, int GemmMemoryType>
+          int SplitK, bool IsBetaZero, typename element_t, int GemmMemoryType,
+          typename workspace_t = output_t, typename counter_t = output_t>
 class GemmPartial {};
 
 /*
@@ -259,22 +447,449 @@ template <bool DoubleBuffer, bool ConflictA, bool ConflictB, int ClSize,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
           bool is_beta_zero, int VectorSize, int BatchType, bool UseJointMatrix,
           typename input_t, typename output_t, typename element_t,
-          typename index_t>
+          typename index_t, typename epilogue_t = Gemm_Epilogue_Identity>
 inline Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
             TileType, TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
             GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-            BatchType, UseJointMatrix>
+            BatchType, UseJointMatrix, epilogue_t>
 make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
           element_t alpha, element_t beta, index_t batch_size, index_t _stridea,
-          index_t _strideb, index_t _stridec) {
+          index_t _strideb, index_t _stridec,
+          epilogue_t epilogue = epilogue_t()) {
   return Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
               TileType, TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
               GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-              BatchType, UseJointMatrix>(buffer_a, buffer_b, buffer_c, alpha,
-                                         beta, batch_size, _stridea, _strideb,
-                                         _stridec);
+              BatchType, UseJointMatrix, epilogue_t>(
+      buffer_a, buffer_b, buffer_c, alpha, beta, batch_size, _stridea,
+      _strideb, _stridec, epilogue);
 }
 
+/*!
+ * @brief Persistent Gemm scheduling the work with Stream-K. The iterations of
+ * the product, a tile of C times a block of K, are linearized tile by tile and
+ * each of the num_wg work groups computes an equal share of them in order, so
+ * no compute unit idles during a last partial wave of tiles.
+ *
+ * A work group computing a whole tile stores it to C. The tiles shared by
+ * several work groups are fixed up: each work group stores its partial tile to
+ * the workspace, and the last one to finish its part, found with the counter
+ * of the tile, sums the partial tiles in order into C.
+ *
+ * @tparam ClSize  size of the cache line, in bytes
+ * @tparam tile_type  item_rows, item_cols, wg_rows and wg_cols of the tiles,
+ * see Tile
+ * @param workspace_ two partial tiles per work group, its first and last ones
+ * @param counters_ number of iterations done for each tile of C
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t = output_t, typename counter_t = output_t>
+class GemmStreamK {
+ public:
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  static constexpr index_t item_rows = tile_type::item_rows;
+  static constexpr index_t item_cols = tile_type::item_cols;
+  static constexpr index_t wg_rows = tile_type::wg_rows;
+  static constexpr index_t wg_cols = tile_type::wg_cols;
+  static constexpr index_t wg_size = wg_rows * wg_cols;
+  static constexpr index_t block_rows = wg_rows * item_rows;
+  static constexpr index_t block_cols = wg_cols * item_cols;
+  static constexpr index_t block_k = ClSize / sizeof(value_t);
+  static constexpr index_t local_memory_size =
+      (block_rows + block_cols) * block_k;
+  static constexpr index_t partial_tile_size = block_rows * block_cols;
+
+  input_t a_;
+  input_t b_;
+  output_t c_;
+  workspace_t workspace_;
+  counter_t counters_;
+  element_t alpha_;
+  element_t beta_;
+  index_t m_;
+  index_t n_;
+  index_t k_;
+  index_t lda_;
+  index_t ldb_;
+  index_t ldc_;
+  index_t tiles_m_;
+  index_t iters_per_tile_;
+  index_t num_iters_;
+  index_t num_wg_;
+  index_t iters_per_wg_;
+
+  GemmStreamK(input_t A, input_t B, output_t C, element_t alpha,
+              element_t beta, index_t num_wg, workspace_t workspace,
+              counter_t counters);
+  static std::string get_type_string() noexcept;
+  static index_t get_num_tiles(index_t m, index_t n) noexcept;
+  static index_t get_num_work_groups(index_t compute_units, index_t m,
+                                     index_t n, index_t k) noexcept;
+  sycl::nd_range<1> get_nd_range() const noexcept;
+  bool valid_thread(const sycl::nd_item<1>& ndItem) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t scratch, sycl::nd_item<1> id) noexcept;
+  void bind(sycl::handler& h);
+  void adjust_access_displacement();
+
+ private:
+  template <typename local_ptr_t>
+  void accumulate(local_ptr_t scratch, sycl::nd_item<1> id, index_t row_start,
+                  index_t col_start, index_t iter_begin, index_t iter_end,
+                  element_t* reg_res) noexcept;
+  void store(index_t row_start, index_t col_start, index_t item_row,
+             index_t item_col, const element_t* reg_res) noexcept;
+  void fixup(sycl::nd_item<1> id, index_t tile, index_t slot,
+             index_t num_iters, index_t row_start, index_t col_start,
+             const element_t* reg_res) noexcept;
+};
+
+/*!
+ * @brief Gemm for CPU devices, following the blocking of the CPU BLAS
+ * libraries. Each work group has a single work item and runs on a core, so
+ * there is one work group per compute unit, each looping over its blocks of C
+ * (and batches). For each block of C and each KC deep slice of K, the panels
+ * of A and B are packed into the workspace of the work group, in micro-panels
+ * read contiguously by the MR x NR register micro-kernel. The panels are
+ * converted to element_t when packed.
+ *
+ * The blocks of C are at most MC x NC, and are shrunk on small problems so
+ * that all the compute units have a block, see get_blocking.
+ *
+ * @tparam tile_type  blocking of the Gemm, see Cpu_Tile
+ * @param workspace_ packed panels of A and B of each work group
+ */
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t = output_t>
+class GemmCpu {
+ public:
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  static constexpr index_t mr = tile_type::item_rows;
+  static constexpr index_t nr = tile_type::item_cols;
+  static constexpr index_t mc = tile_type::mc;
+  static constexpr index_t kc = tile_type::kc;
+  static constexpr index_t nc = tile_type::nc;
+  /* Packed panels of A and B of a work group */
+  static constexpr index_t workspace_size_per_wg = (mc + nc) * kc;
+
+  input_t a_;
+  input_t b_;
+  output_t c_;
+  workspace_t workspace_;
+  element_t alpha_;
+  element_t beta_;
+  index_t m_;
+  index_t n_;
+  index_t k_;
+  index_t lda_;
+  index_t ldb_;
+  index_t ldc_;
+  index_t batch_size_;
+  index_t stridea_;
+  index_t strideb_;
+  index_t stridec_;
+  index_t block_m_;
+  index_t block_n_;
+  index_t num_wg_;
+
+  GemmCpu(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
+          index_t batch_size, index_t stride_a, index_t stride_b,
+          index_t stride_c, index_t block_m, index_t block_n, index_t num_wg,
+          workspace_t workspace);
+  static std::string get_type_string() noexcept;
+  static index_t get_blocking(index_t compute_units, index_t m, index_t n,
+                              index_t batch_size, index_t& block_m,
+                              index_t& block_n) noexcept;
+  sycl::nd_range<1> get_nd_range() const noexcept;
+  bool valid_thread(const sycl::nd_item<1>& ndItem) const;
+  void eval(sycl::nd_item<1> id) noexcept;
+  void bind(sycl::handler& h);
+  void adjust_access_displacement();
+
+ private:
+  template <typename ptr_t>
+  void pack_a(ptr_t packed, index_t offset, index_t row_start,
+              index_t k_start, index_t rows, index_t depth) noexcept;
+  template <typename ptr_t>
+  void pack_b(ptr_t packed, index_t offset, index_t k_start,
+              index_t col_start, index_t depth, index_t cols) noexcept;
+  template <typename ptr_t>
+  void micro_kernel(ptr_t packed_a, ptr_t packed_b, index_t depth,
+                    index_t c_offset, index_t row, index_t col, index_t rows,
+                    index_t cols, bool first_k) noexcept;
+};
+
+/*!
+ * @brief Parameters of one group of a GemmGrouped, the group_size gemm of the
+ * group share their dimensions, transpositions and scalars.
+ * @param first_matrix index of the first matrix of the group in the pointer
+ * arrays
+ * @param first_tile index of the first tile of the group among the tiles of
+ * all the groups
+ * @param tiles_m, tiles_n number of tiles in the rows and columns of each C
+ */
+template <typename element_t, typename index_t>
+struct Gemm_Group {
+  bool trans_a;
+  bool trans_b;
+  index_t m;
+  index_t n;
+  index_t k;
+  index_t lda;
+  index_t ldb;
+  index_t ldc;
+  element_t alpha;
+  element_t beta;
+  index_t first_matrix;
+  index_t first_tile;
+  index_t tiles_m;
+  index_t tiles_n;
+};
+
+/*!
+ * @brief Persistent kernel computing the gemm of several groups of problems
+ * with different shapes, see _gemm_batch. The tiles of all the C matrices are
+ * numbered group by group and each work group loops over them with a stride
+ * of the number of work groups, so a single launch computes every problem
+ * whatever their sizes.
+ *
+ * Each tile of C is accumulated in registers in element_t, the A and B blocks
+ * of depth ClSize / sizeof(value_t) being staged in local memory.
+ *
+ * @tparam value_t  type of the elements of A and B
+ * @tparam out_t  type of the elements of C
+ * @tparam element_t  type of the scalars and of the accumulators
+ * @tparam ClSize  size of the cache line, in bytes
+ * @tparam tile_type  item_rows, item_cols, wg_rows and wg_cols of the tiles,
+ * see Tile
+ * @param groups_ device array of the group_count_ Gemm_Group
+ * @param a_, b_, c_ device arrays of the pointers to the matrices
+ * @param num_tiles_ number of tiles of all the groups
+ */
+template <typename value_t_, typename out_t, typename element_t,
+          typename index_t, int ClSize, typename tile_type>
+class GemmGrouped {
+ public:
+  using value_t = value_t_;
+  using group_t = Gemm_Group<element_t, index_t>;
+  static constexpr index_t item_rows = tile_type::item_rows;
+  static constexpr index_t item_cols = tile_type::item_cols;
+  static constexpr index_t wg_rows = tile_type::wg_rows;
+  static constexpr index_t wg_cols = tile_type::wg_cols;
+  static constexpr index_t wg_size = wg_rows * wg_cols;
+  static constexpr index_t block_rows = wg_rows * item_rows;
+  static constexpr index_t block_cols = wg_cols * item_cols;
+  static constexpr index_t block_k = ClSize / sizeof(value_t);
+  static constexpr index_t local_memory_size =
+      (block_rows + block_cols) * block_k;
+
+  const group_t* groups_;
+  index_t group_count_;
+  const value_t* const* a_;
+  const value_t* const* b_;
+  out_t* const* c_;
+  index_t num_tiles_;
+
+  GemmGrouped(const group_t* groups, index_t group_count,
+              const value_t* const* a, const value_t* const* b,
+              out_t* const* c, index_t num_tiles);
+  static std::string get_type_string() noexcept;
+  sycl::nd_range<1> get_nd_range(index_t compute_units) const noexcept;
+  bool valid_thread(const sycl::nd_item<1>& ndItem) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t scratch, sycl::nd_item<1> id) noexcept;
+  void bind(sycl::handler&) {}
+  void adjust_access_displacement() {}
+};
+
+template <int ClSize, typename tile_type, typename value_t, typename out_t,
+          typename element_t, typename index_t>
+inline GemmGrouped<value_t, out_t, element_t, index_t, ClSize, tile_type>
+make_gemm_grouped(const Gemm_Group<element_t, index_t>* groups,
+                  index_t group_count, const value_t* const* a,
+                  const value_t* const* b, out_t* const* c,
+                  index_t num_tiles) {
+  return GemmGrouped<value_t, out_t, element_t, index_t, ClSize, tile_type>(
+      groups, group_count, a, b, c, num_tiles);
+}
+
+/*!
+ * @brief Packs op(A) or op(B) in the layout read by GemmPacked, see
+ * _gemm_pack. The matrix is split in the blocks loaded by a work group of
+ * GemmPacked, block_rows x block_k for op(A) and block_k x block_cols for
+ * op(B), which are zero-padded at the edges and scaled by alpha. Each block
+ * is stored column major, in the layout of the local memory of GemmPacked,
+ * and the blocks along K of a row (op(A)) or column (op(B)) of tiles of C
+ * are stored one after another.
+ *
+ * @tparam PackB  whether op(B) is packed instead of op(A)
+ * @tparam Trans  whether the source matrix is transposed
+ * @param outer_ m when packing op(A), n when packing op(B)
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+class GemmPack {
+ public:
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  static constexpr index_t block_outer =
+      PackB ? tile_type::wg_cols * tile_type::item_cols
+            : tile_type::wg_rows * tile_type::item_rows;
+  static constexpr index_t block_k = ClSize / sizeof(value_t);
+  static constexpr index_t block_size = block_outer * block_k;
+
+  input_t src_;
+  output_t packed_;
+  element_t alpha_;
+  index_t outer_;
+  index_t k_;
+  index_t ld_;
+  index_t tiles_k_;
+  index_t size_;
+
+  GemmPack(input_t src, output_t packed, element_t alpha, index_t outer,
+           index_t k);
+  static index_t get_packed_size(index_t outer, index_t k) noexcept;
+  index_t get_size() const;
+  bool valid_thread(const sycl::nd_item<1>& ndItem) const;
+  void eval(sycl::nd_item<1> id) noexcept;
+  void bind(sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Gemm computing C = op(A) * op(B) + beta * C where op(A) and/or op(B)
+ * have been packed by GemmPack, see _gemm_compute. The packed operands hold
+ * alpha, and their blocks are loaded to local memory with contiguous loads,
+ * free of bounds checks and transpositions. An operand which isn't packed is
+ * loaded as in the other gemm kernels.
+ *
+ * Each work group computes a tile of C, accumulated in registers in
+ * element_t.
+ *
+ * @tparam PackedA, PackedB  whether op(A) and op(B) are packed. TransA
+ * (TransB) is ignored when op(A) (op(B)) is packed.
+ */
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+class GemmPacked {
+ public:
+  using index_t = typename std::make_signed<typename input_a_t::index_t>::type;
+  using value_t =
+      typename std::remove_const<typename input_a_t::value_t>::type;
+  static_assert(
+      std::is_same<value_t, typename std::remove_const<
+                                typename input_b_t::value_t>::type>::value,
+      "A and B must have the same value type");
+  static constexpr index_t item_rows = tile_type::item_rows;
+  static constexpr index_t item_cols = tile_type::item_cols;
+  static constexpr index_t wg_rows = tile_type::wg_rows;
+  static constexpr index_t wg_cols = tile_type::wg_cols;
+  static constexpr index_t wg_size = wg_rows * wg_cols;
+  static constexpr index_t block_rows = wg_rows * item_rows;
+  static constexpr index_t block_cols = wg_cols * item_cols;
+  static constexpr index_t block_k = ClSize / sizeof(value_t);
+  static constexpr index_t local_memory_size =
+      (block_rows + block_cols) * block_k;
+
+  input_a_t a_;
+  input_b_t b_;
+  output_t c_;
+  element_t beta_;
+  index_t m_;
+  index_t n_;
+  index_t k_;
+  index_t lda_;
+  index_t ldb_;
+  index_t ldc_;
+  index_t tiles_m_;
+  index_t tiles_n_;
+  index_t tiles_k_;
+
+  GemmPacked(input_a_t A, input_b_t B, output_t C, element_t beta, index_t m,
+             index_t n, index_t k);
+  static std::string get_type_string() noexcept;
+  sycl::nd_range<1> get_nd_range() const noexcept;
+  bool valid_thread(const sycl::nd_item<1>& ndItem) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t scratch, sycl::nd_item<1> id) noexcept;
+  void bind(sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Gemm computing a triangle of the n x n matrix
+ * C = alpha * X * Y^T + alpha2 * Y * X^T + beta * C (the second product
+ * only when Rank2), where X and Y are n x k, see _syrk, _syr2k, _herk and
+ * _her2k. X is read from A and Y from B.
+ *
+ * The tiles of C are square and only the tiles intersecting the triangle are
+ * launched, the elements of the diagonal tiles outside of it being masked.
+ * Each work group computes a tile, accumulated in registers in element_t,
+ * with blocks of X and Y staged in local memory. The scalar of each product
+ * is applied when loading the block of X.
+ *
+ * @tparam TransX, TransY  whether X (Y) is stored transposed, its element
+ * (i, l) being at i * ld + l instead of l * ld + i
+ * @tparam ConjX, ConjY  whether X (Y) is the conjugate of the stored matrix
+ * @tparam IsUpper  whether the upper triangle of C is computed
+ * @tparam Hermitian  whether C is Hermitian, its diagonal being real
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+class GemmTriangular {
+ public:
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  static constexpr index_t item_rows = tile_type::item_rows;
+  static constexpr index_t item_cols = tile_type::item_cols;
+  static constexpr index_t wg_rows = tile_type::wg_rows;
+  static constexpr index_t wg_cols = tile_type::wg_cols;
+  static constexpr index_t wg_size = wg_rows * wg_cols;
+  static constexpr index_t block_size = wg_rows * item_rows;
+  static constexpr index_t block_k = ClSize / sizeof(value_t);
+  static constexpr index_t local_memory_size = 2 * block_size * block_k;
+  static_assert(wg_rows * item_rows == wg_cols * item_cols,
+                "The tiles of a triangle must be square");
+
+  input_t a_;
+  input_t b_;
+  output_t c_;
+  element_t alpha_;
+  element_t alpha2_;
+  element_t beta_;
+  index_t n_;
+  index_t k_;
+  index_t lda_;
+  index_t ldb_;
+  index_t ldc_;
+
+  GemmTriangular(input_t A, input_t B, output_t C, element_t alpha,
+                 element_t alpha2, element_t beta, index_t n, index_t k);
+  static std::string get_type_string() noexcept;
+  static index_t get_num_tiles(index_t n) noexcept;
+  sycl::nd_range<1> get_nd_range() const noexcept;
+  bool valid_thread(const sycl::nd_item<1>& ndItem) const;
+  template <typename local_memory_t>
+  void eval(local_memory_t scratch, sycl::nd_item<1> id) noexcept;
+  void bind(sycl::handler& h);
+  void adjust_access_displacement();
+
+ private:
+  template <bool FromB, bool Trans, bool Conj, typename local_ptr_t>
+  void load_block(local_ptr_t s, index_t start, index_t k_start,
+                  element_t scale, index_t item_id) noexcept;
+  template <bool FromB, typename local_ptr_t>
+  void accumulate(local_ptr_t scratch, sycl::nd_item<1> id, index_t row_start,
+                  index_t col_start, element_t scale,
+                  element_t* reg_res) noexcept;
+};
+
 /**
  * @brief Kernel that inverts the square diagonal blocks of a matrix. This
  * is used in the TRSM algorithm.
@@ -302,7 +917,7 @@ make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
  * store multiples of blockSize*blockSize.
  *
  * @Note This kernel assumes the column-major matrices
- * @Note This kernel uses fixed size blocks of 16, but this can be changed
+ * @Note The TRSM picks the block size per device, from 16 to 128
  */
 template <bool UnitDiag, bool Upper, int BlockSize, typename lhs_t,
           typename rhs_t>
@@ -333,6 +948,62 @@ make_diag_blocks_inverter(rhs_t A, lhs_t invA) {
                                                                           invA);
 }
 
+/*!
+ * @brief Kernel computing B = alpha * op(A) * B (Left) or B = alpha * B *
+ * op(A) in place, A being an n x n triangular matrix with n at most BlockSize
+ * and B having m columns (Left) or m rows. It computes the leaves of the
+ * recursive TRMM.
+ *
+ * Each work group loads op(A), zero outside of its triangle, and a BlockSize
+ * wide panel of B to local memory before overwriting that panel, so the work
+ * groups never read the output of each other.
+ *
+ * @Note This kernel assumes the column-major matrices
+ */
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+struct TriangularBlockMultiplier {
+  using index_t = typename std::make_signed<typename lhs_t::index_t>::type;
+  using value_t = typename std::remove_cv<typename lhs_t::value_t>::type;
+  // Each work item computes item_cols columns of the panel, more when the
+  // device work group size is lower than BlockSize * BlockSize / item_cols
+  static constexpr index_t item_cols = 4;
+  static constexpr index_t local_memory_size = 2 * BlockSize * BlockSize;
+  static_assert(BlockSize % item_cols == 0,
+                "The block size must be a multiple of the item columns");
+  rhs_t A_;
+  lhs_t B_;
+  element_t alpha_;
+  index_t n_;
+  index_t m_;
+  index_t lda_;
+  index_t ldb_;
+  // Number of the columns of the panel computed at once by the work group
+  index_t wg_cols_;
+
+  TriangularBlockMultiplier(rhs_t A, lhs_t B, element_t alpha, index_t n,
+                            index_t m, index_t max_wg_size);
+  sycl::nd_range<1> get_nd_range() const noexcept;
+  bool valid_thread(sycl::nd_item<1> id) const;
+  void bind(sycl::handler& cgh);
+  void adjust_access_displacement();
+
+  template <typename local_memory_t>
+  void eval(local_memory_t localMem, sycl::nd_item<1> id) noexcept;
+};
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t,
+          typename index_t>
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize,
+                          lhs_t, rhs_t, element_t>
+make_triangular_block_multiplier(rhs_t A, lhs_t B, element_t alpha, index_t n,
+                                 index_t m, index_t max_wg_size) {
+  return TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag,
+                                   BlockSize, lhs_t, rhs_t, element_t>(
+      A, B, alpha, n, m, max_wg_size);
+}
+
 }  // namespace blas
 
 #endif  // ONEMATH_SYCL_BLAS_BLAS3_TREES_H
@@ -43,6 +43,16 @@ struct ResolveReturnType<CollapseIndexTupleOperator, rhs_t> {
   using type = typename rhs_t::value_t;
 };
 
+// The cast returns the type it converts to
+template <typename value_t>
+struct CastOperator;
+template <typename cast_t, typename rhs_t>
+struct ResolveReturnType<CastOperator<cast_t>, rhs_t> {
+  struct type {
+    using value_t = cast_t;
+  };
+};
+
 struct AddOperator;
 struct ProductOperator;
 struct DivisionOperator;
@@ -0,0 +1,98 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_EXTENSION_REDUCTION_BATCH_H
+#define ONEMATH_SYCL_BLAS_EXTENSION_REDUCTION_BATCH_H
+
+#include "blas_meta.h"
+
+namespace blas {
+
+/*!
+ * @brief Reduction computed by Reduction_batch for each vector of the batch
+ *
+ * - dot: inner product of x and y
+ * - asum: sum of the absolute values of x
+ * - nrm2: euclidean norm of x
+ */
+enum class batch_reduction_t : int { dot = 0, asum = 1, nrm2 = 2 };
+
+/*!
+ * This class holds the kernel implementation of dot_batch, asum_batch and
+ * nrm2_batch.
+ *
+ * Each work-group reduces a whole vector (or pair of vectors for dot) of the
+ * batch and writes the result directly, so no atomics nor initialization of
+ * the results are needed and the whole batch is computed in a single launch.
+ * If there are less work-groups than batch entries, each work-group loops over
+ * the batch.
+ *
+ * localSize local size of group, allow some device tailoring at compile
+ * time.
+ *
+ * rhs_2_ is only read for dot, it is a copy of rhs_1_ otherwise.
+ *
+ * With a negative increment the first element of a vector is the last one in
+ * memory, at (1 - n) * inc from the start of the vector as in BLAS.
+ */
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+struct Reduction_batch {
+  // 16-bit inputs are accumulated in float, which is also the type of the
+  // local memory
+  using value_t = typename std::conditional<
+      is_reduced_precision<typename lhs_t::value_t>::value, float,
+      typename lhs_t::value_t>::type;
+  using index_t = typename rhs_1_t::index_t;
+
+  lhs_t lhs_;
+  rhs_1_t rhs_1_;
+  rhs_2_t rhs_2_;
+  index_t n_, inc_1_, stride_1_, inc_2_, stride_2_, batch_size_;
+
+  Reduction_batch(lhs_t _lhs, rhs_1_t _rhs_1, rhs_2_t _rhs_2, index_t _N,
+                  index_t _inc_1, index_t _stride_1, index_t _inc_2,
+                  index_t _stride_2, index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, sycl::nd_item<1> ndItem);
+  void bind(sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t> make_reduction_batch(
+    lhs_t _lhs, rhs_1_t _rhs_1, rhs_2_t _rhs_2, typename rhs_1_t::index_t _N,
+    typename rhs_1_t::index_t _inc_1, typename rhs_1_t::index_t _stride_1,
+    typename rhs_1_t::index_t _inc_2, typename rhs_1_t::index_t _stride_2,
+    typename rhs_1_t::index_t _batch_size) {
+  return Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>(
+      _lhs, _rhs_1, _rhs_2, _N, _inc_1, _stride_1, _inc_2, _stride_2,
+      _batch_size);
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_EXTENSION_REDUCTION_BATCH_H
@@ -0,0 +1,106 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE_H
+#define ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+/*!
+ * @brief Indicates how the Gemm configuration is selected.
+ * disabled: The configuration is chosen by the size thresholds of the
+ *           backend selected with TUNING_TARGET.
+ * cached: The configuration stored in the tuning cache for the problem is
+ *         used, the backend thresholds are used on a cache miss.
+ * tune: On a cache miss, every candidate configuration is timed on the
+ *       problem and the fastest one is stored in the tuning cache.
+ */
+enum class gemm_tuning_mode_t : int { disabled = 0, cached = 1, tune = 2 };
+
+/*!
+ * @brief On-disk cache of the Gemm configurations selected by the autotuner.
+ *
+ * Each line of the file maps a problem key to the name of a candidate
+ * configuration, separated by a tab. The keys start with the device name and
+ * driver version, so a single file can be shared between several devices and
+ * entries are not reused after a driver update. New entries are appended to
+ * the file, the last entry of a key wins when the file is loaded.
+ */
+class Gemm_Tuning_Cache {
+ public:
+  /*!
+   * @brief Loads the cache from the file at path. A missing file is not an
+   * error, it is created when the first entry is stored.
+   */
+  inline explicit Gemm_Tuning_Cache(const std::string& path);
+  Gemm_Tuning_Cache(const Gemm_Tuning_Cache&) = delete;
+  Gemm_Tuning_Cache operator=(Gemm_Tuning_Cache) = delete;
+
+  /*!
+   * @brief Path given by the ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE environment
+   * variable, or .onemath_sycl_blas_gemm_tuning.txt in the home directory
+   * (onemath_sycl_blas_gemm_tuning.txt in the working directory if HOME is
+   * not set).
+   */
+  inline static std::string default_path();
+
+  /*!
+   * @brief Prefix of the keys of the problems run on the device of q.
+   */
+  inline static std::string device_key(const sycl::queue& q);
+
+  /*!
+   * @brief Looks up the configuration selected for a problem.
+   * @param key Problem key.
+   * @param variant Set to the name of the configuration on a hit.
+   * @return Whether the key was found.
+   */
+  inline bool lookup(const std::string& key, std::string& variant) const;
+
+  /*!
+   * @brief Stores the configuration selected for a problem and appends it to
+   * the file.
+   */
+  inline void store(const std::string& key, const std::string& variant);
+
+  inline const std::string& get_path() const { return path_; }
+
+  inline size_t size() const;
+
+ private:
+  inline void load();
+
+  const std::string path_;
+  mutable std::mutex entries_mutex_;
+  std::map<std::string, std::string> entries_;
+};
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE_H
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_GRAPH_H
+#define ONEMATH_SYCL_BLAS_GRAPH_H
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+/*!
+ * @brief Sequence of kernels, fills and copies recorded by an SB_Handle, see
+ * SB_Handle::begin_recording, which can be replayed any number of times.
+ *
+ * When the device supports the sycl_ext_oneapi_graph extension the commands
+ * are recorded in a command_graph, finalized once and replayed with a single
+ * submission. Otherwise the graph keeps the list of the recorded submissions
+ * and submits them again, in order, on every replay.
+ *
+ * The scratch memory used by the recorded kernels is kept until the graph is
+ * destroyed, and the containers and scalars given to the recorded operators
+ * are captured by value: replaying runs the same operations on the same
+ * memory. The destructor waits for the last replay to complete.
+ */
+class SB_Graph {
+ public:
+  using event_t = std::vector<sycl::event>;
+  using launch_t = std::function<sycl::event(const event_t&)>;
+  using release_t = std::function<void()>;
+
+  SB_Graph(const SB_Graph&) = delete;
+  SB_Graph& operator=(const SB_Graph&) = delete;
+
+  inline ~SB_Graph();
+
+  /*!
+   * @brief Submits the recorded commands.
+   * @param dependencies Events the first command depends on.
+   * @return Event of the last command.
+   */
+  inline event_t replay(const event_t& dependencies = {});
+
+  /*!
+   * @brief Whether the kernels are replayed from a sycl_ext_oneapi_graph
+   * command_graph.
+   */
+  inline bool uses_command_graph() const;
+
+  /*!
+   * @brief Number of commands recorded without the command_graph.
+   */
+  inline size_t get_num_launches() const { return launches_.size(); }
+
+ private:
+  friend class SB_Handle;
+
+  inline explicit SB_Graph(sycl::queue q);
+
+  /*!
+   * @brief Stops the recording, and finalizes the command_graph if used.
+   */
+  inline void end_recording();
+
+  inline void add_launch(launch_t launch) {
+    launches_.push_back(std::move(launch));
+  }
+
+  /*!
+   * @brief Keeps scratch memory until the graph is destroyed, release is
+   * called once the last replay is complete.
+   */
+  inline void retain(release_t release) {
+    releases_.push_back(std::move(release));
+  }
+
+  sycl::queue q_;
+  std::vector<launch_t> launches_;
+  std::vector<release_t> releases_;
+  event_t last_events_;
+  bool use_command_graph_ = false;
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+  using modifiable_graph_t = sycl::ext::oneapi::experimental::command_graph<
+      sycl::ext::oneapi::experimental::graph_state::modifiable>;
+  using executable_graph_t = sycl::ext::oneapi::experimental::command_graph<
+      sycl::ext::oneapi::experimental::graph_state::executable>;
+  std::optional<modifiable_graph_t> graph_;
+  std::optional<executable_graph_t> executable_;
+#endif
+};
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_GRAPH_H
@@ -28,11 +28,42 @@
 #include "operations/blas2_trees.h"
 #include "operations/blas3_trees.h"
 #include "operations/extension/reduction.h"
+#include "gemm_tuning_cache.h"
+#include "graph.h"
 #include "helper.h"
+#include "profiler.h"
+#include "scalar_result.h"
 #include "temp_memory_pool.h"
 
+#include <memory>
+#include <mutex>
+
 namespace blas {
 
+/*!
+ * @brief Host data read by the copies of SB_Handle::copy_to_device, released
+ * once the copies are complete. Shared by the copies of a handle, the
+ * destructor waits for the copies still running.
+ */
+class Pending_Host_Data {
+ public:
+  Pending_Host_Data() = default;
+  Pending_Host_Data(const Pending_Host_Data&) = delete;
+  Pending_Host_Data operator=(Pending_Host_Data) = delete;
+
+  inline ~Pending_Host_Data();
+
+  /*!
+   * @brief Keeps data until ev is complete, and releases the data of the
+   * copies complete so far.
+   */
+  inline void keep(const sycl::event& ev, std::shared_ptr<const void> data);
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::pair<sycl::event, std::shared_ptr<const void>>> pending_;
+};
+
 /** SB_Handle.
  * @brief Primary template for the SB_Handle specializations.
  * The SB_Handle represents the object that executes a tree on
@@ -54,8 +85,10 @@ class SB_Handle {
         q_(q),
         workGroupSize_(helper::get_work_group_size(q)),
         localMemorySupport_(helper::has_local_memory(q)),
-        computeUnits_(helper::get_num_compute_units(q)) {
-  }
+        computeUnits_(helper::get_num_compute_units(q)),
+        inOrderFastPath_(false),
+        scalarResultPool_(std::make_shared<Scalar_Result_Pool>(q)),
+        pendingHostData_(std::make_shared<Pending_Host_Data>()) {}
 
 #ifndef __ADAPTIVECPP__
   inline SB_Handle(Temp_Mem_Pool* tmp)
@@ -63,7 +96,10 @@ class SB_Handle {
         q_(tmp->get_queue()),
         workGroupSize_(helper::get_work_group_size(q_)),
         localMemorySupport_(helper::has_local_memory(q_)),
-        computeUnits_(helper::get_num_compute_units(q_)) {}
+        computeUnits_(helper::get_num_compute_units(q_)),
+        inOrderFastPath_(false),
+        scalarResultPool_(std::make_shared<Scalar_Result_Pool>(q_)),
+        pendingHostData_(std::make_shared<Pending_Host_Data>()) {}
 #endif
 
   template <helper::AllocType alloc, typename value_t>
@@ -123,11 +159,13 @@ class SB_Handle {
             bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
             bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
             int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-            int VectorSize, int BatchType, bool UseJointMatrix>
+            int VectorSize, int BatchType, bool UseJointMatrix,
+            typename epilogue_t>
   event_t execute(Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                        tile_type, TransA, TransB, SymmA, SymmB, element_t,
                        is_beta_zero, GemmMemoryType, GemmAlgorithm,
-                       GemmVectorization, VectorSize, BatchType, UseJointMatrix>
+                       GemmVectorization, VectorSize, BatchType, UseJointMatrix,
+                       epilogue_t>
                       gemm_tree,
                   const event_t& dependencies = {});
 
@@ -145,14 +183,43 @@ class SB_Handle {
           gemm_wrapper,
       const event_t& dependencies = {});
 
+  // Stream-K Gemm specialization
+  template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+            bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+            bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
+            int GemmMemoryType, int GemmVectorization, int VectorSize,
+            int BatchType>
+  event_t execute(
+      Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
+           TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
+           GemmMemoryType, static_cast<int>(gemm_algorithm_t::stream_k),
+           GemmVectorization, VectorSize, BatchType>
+          gemm_wrapper,
+      const event_t& dependencies = {});
+
+  // CPU Gemm specialization
+  template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+            bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+            bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
+            int GemmMemoryType, int GemmVectorization, int VectorSize,
+            int BatchType>
+  event_t execute(
+      Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
+           TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
+           GemmMemoryType, static_cast<int>(gemm_algorithm_t::cpu),
+           GemmVectorization, VectorSize, BatchType>
+          gemm_wrapper,
+      const event_t& dependencies = {});
+
   // GemmPartial specialization
   template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
             bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-            bool IsFinal, bool IsBetaZero, typename element_t,
-            int GemmMemoryType>
+            int SplitK, bool IsBetaZero, typename element_t,
+            int GemmMemoryType, typename workspace_t, typename counter_t>
   event_t execute(GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB,
-                              ClSize, tile_type, TransA, TransB, IsFinal,
-                              IsBetaZero, element_t, GemmMemoryType>
+                              ClSize, tile_type, TransA, TransB, SplitK,
+                              IsBetaZero, element_t, GemmMemoryType,
+                              workspace_t, counter_t>
                       gemm_partial,
                   const event_t& dependencies = {});
 
@@ -163,6 +230,24 @@ class SB_Handle {
       Reduction<operator_t, params_t, input_t, output_t> reduction_wrapper,
       const event_t& dependencies = {});
 
+  /*!
+   * @brief Fills size elements of mem with value. Recorded like the kernels
+   * while recording.
+   */
+  template <typename container_t>
+  event_t fill(container_t mem, typename ValueType<container_t>::type value,
+               size_t size, const event_t& dependencies = {});
+
+  /*!
+   * @brief Copies size elements of host memory to mem. The host data is
+   * copied first, so src can be released right after the call. Recorded like
+   * the kernels while recording.
+   */
+  template <typename container_t>
+  event_t copy_to_device(const typename ValueType<container_t>::type* src,
+                         container_t mem, size_t size,
+                         const event_t& dependencies = {});
+
   inline bool has_local_memory() const { return localMemorySupport_; }
   inline queue_t get_queue() const { return q_; }
 
@@ -170,11 +255,129 @@ class SB_Handle {
 
   inline size_t get_num_compute_units() const { return computeUnits_; }
 
-  inline void wait() { q_.wait(); }
+  /*!
+   * @brief Whether the in-order fast path is enabled, disabled by default.
+   * The in-order queue already runs each kernel after the commands previously
+   * submitted to it, so the dependencies on the kernels submitted by this
+   * handle are dropped and the multi-kernel operators only return their last
+   * event. The other dependencies (other queues, host tasks, interop) are
+   * kept.
+   */
+  inline bool is_in_order_fast_path() const { return inOrderFastPath_; }
+
+  /*!
+   * @brief Enables or disables the in-order fast path. It can only be enabled
+   * on an in-order queue.
+   */
+  inline void set_in_order_fast_path(bool enable);
+
+  /*!
+   * @brief Makes the commands submitted to the queue afterwards wait for the
+   * given events, e.g. events of other queues with the in-order fast path.
+   * @return The barrier event.
+   */
+  inline event_t submit_barrier(const event_t& dependencies);
+
+  /*!
+   * @brief Starts recording every kernel submitted by the handle (name,
+   * nd_range, local memory size and event). The queue must have been created
+   * with the sycl::property::queue::enable_profiling property.
+   */
+  inline void enable_profiling();
+
+  /*!
+   * @brief Stops recording the kernels. The profiler returned by
+   * get_profiler() keeps the kernels recorded so far.
+   */
+  inline void disable_profiling() { profiler_ = nullptr; }
+
+  inline bool is_profiling() const { return profiler_ != nullptr; }
+
+  /*!
+   * @brief Profiler collecting the kernels submitted since profiling was
+   * enabled, or nullptr if profiling is disabled.
+   */
+  inline std::shared_ptr<Kernel_Profiler> get_profiler() const {
+    return profiler_;
+  }
+
+  /*!
+   * @brief Starts recording the kernels, fills and copies submitted by the
+   * handle into an SB_Graph instead of running them. The operators called
+   * while recording return events that must not be waited on: the operators
+   * synchronizing with the host (e.g. rotg, or returning a Scalar_Result)
+   * throw std::runtime_error while recording.
+   */
+  inline void begin_recording();
+
+  /*!
+   * @brief Stops the recording.
+   * @return The recorded graph, see SB_Graph::replay.
+   */
+  inline std::shared_ptr<SB_Graph> end_recording();
+
+  inline bool is_recording() const { return recording_ != nullptr; }
+
+  /*!
+   * @brief Sets how the Gemm configurations are selected, see
+   * gemm_tuning_mode_t. Requires the library to be built with
+   * BLAS_ENABLE_GEMM_AUTOTUNER unless mode is disabled.
+   * @param mode Selection mode.
+   * @param cache_path File of the tuning cache, defaults to
+   * Gemm_Tuning_Cache::default_path(). The cache is shared with the handles
+   * copied from this one.
+   */
+  inline void set_gemm_tuning(gemm_tuning_mode_t mode,
+                              const std::string& cache_path = "");
+
+  inline gemm_tuning_mode_t get_gemm_tuning_mode() const {
+    return gemmTuningMode_;
+  }
+
+  /*!
+   * @brief Makes the split-K of the tall and skinny Gemm deterministic. The
+   * slices of K are then summed in order from a workspace instead of being
+   * added to C with atomics, at the cost of the workspace.
+   */
+  inline void set_gemm_deterministic(bool enable) {
+    gemmDeterministic_ = enable;
+  }
+
+  inline bool is_gemm_deterministic() const { return gemmDeterministic_; }
 
-  inline void wait(std::vector<sycl::event> evs) { sycl::event::wait(evs); }
+  /*!
+   * @brief Tuning cache used by the Gemm autotuner, or nullptr if the tuning
+   * has never been enabled.
+   */
+  inline std::shared_ptr<Gemm_Tuning_Cache> get_gemm_tuning_cache() const {
+    return gemmTuningCache_;
+  }
 
-  inline void wait(sycl::event ev) { sycl::event::wait({ev}); }
+  /*!
+   * @brief Pool of the memory holding the results of the asynchronous
+   * reductions (e.g. _dot_async), shared with the handles copied from this
+   * one. The results are copied to the host, so it can't be used while
+   * recording.
+   */
+  inline std::shared_ptr<Scalar_Result_Pool> get_scalar_result_pool() const {
+    throw_if_recording();
+    return scalarResultPool_;
+  }
+
+  inline void wait() {
+    throw_if_recording();
+    q_.wait();
+  }
+
+  inline void wait(std::vector<sycl::event> evs) {
+    throw_if_recording();
+    sycl::event::wait(evs);
+  }
+
+  inline void wait(sycl::event ev) {
+    throw_if_recording();
+    sycl::event::wait({ev});
+  }
 
   /*  @brief waiting for a list of sycl events
  @param first_event  and next_events are instances of sycl::event
@@ -184,17 +387,95 @@ class SB_Handle {
   template <typename first_event_t, typename... next_event_t>
   void inline wait(first_event_t first_event,
                    next_event_t... next_dependencies) {
+    throw_if_recording();
     sycl::event::wait(concatenate_vectors(first_event, next_dependencies...));
   }
 
  private:
+  /*!
+   * @brief The events returned while recording must not be waited on, the
+   * operators synchronizing with the host can't be recorded.
+   */
+  inline void throw_if_recording() const {
+    if (recording_ != nullptr) {
+      throw std::runtime_error(
+          "The operators synchronizing with the host can't be recorded");
+    }
+  }
+
+  /*!
+   * @brief Submits a command to the queue, or records it while recording
+   * without the command_graph. With the in-order fast path, the dependencies
+   * on the commands of the handle are dropped.
+   * @param submit Callable taking the queue and the dependencies, which
+   * submits the command and returns its event.
+   */
+  template <typename submit_t>
+  inline sycl::event submit_command(submit_t submit,
+                                    const event_t& dependencies);
+
+  /*!
+   * @brief Submits the tree with execute_tree and records the kernel if
+   * profiling is enabled.
+   */
+  template <int using_local_memory, typename expression_tree_t>
+  inline sycl::event launch(expression_tree_t t, size_t localSize,
+                            size_t globalSize, size_t shMem,
+                            const event_t& dependencies);
+
+  /*!
+   * @brief Appends the event of a new submission to events. With the in-order
+   * fast path, an event of a kernel submitted by this handle replaces the
+   * previous ones of its kernels.
+   */
+  inline void append_event(event_t& events, const sycl::event& ev) const;
+  inline void append_events(event_t& events, const event_t& new_events) const;
+
+  /*!
+   * @brief Whether ev is the event of one of the last kernels submitted to
+   * q_ by this handle. Older events are not found, their dependencies are
+   * then kept.
+   */
+  inline bool is_submitted_event(const sycl::event& ev) const;
+
+  /*!
+   * @brief The dependencies that the in-order queue doesn't already satisfy.
+   */
+  inline event_t external_dependencies(const event_t& dependencies) const;
+
+  /*!
+   * @brief Atomic counters of a single kernel (single-pass reduction, fixup
+   * split-K and Stream-K Gemm), taken from the temporary memory so that the
+   * kernels in flight don't share them, and released with release_temp_mem.
+   * @param zeroed Set to the event of the fill setting them to 0.
+   */
+  inline BufferIterator<uint32_t> acquire_counters(size_t count,
+                                                   event_t& zeroed);
+
+  template <typename operator_t, typename lhs_t, typename rhs_t,
+            typename partials_t, typename index_t>
+  inline sycl::event launch_single_pass_reduction(
+      lhs_t lhs, rhs_t rhs, partials_t partials, index_t localSize,
+      index_t nWG, const event_t& dependencies);
+
   queue_t q_;
   const size_t workGroupSize_;
   const bool localMemorySupport_;
   const size_t computeUnits_;
+  bool inOrderFastPath_;
+  static constexpr size_t maxSubmittedEvents_ = 64;
+  event_t submittedEvents_;
+  size_t nextSubmittedEvent_ = 0;
 #ifndef __ADAPTIVECPP__
   Temp_Mem_Pool* tempMemPool_;
 #endif
+  std::shared_ptr<Kernel_Profiler> profiler_;
+  std::shared_ptr<Scalar_Result_Pool> scalarResultPool_;
+  std::shared_ptr<Pending_Host_Data> pendingHostData_;
+  gemm_tuning_mode_t gemmTuningMode_ = gemm_tuning_mode_t::disabled;
+  std::shared_ptr<Gemm_Tuning_Cache> gemmTuningCache_;
+  std::shared_ptr<SB_Graph> recording_;
+  bool gemmDeterministic_ = false;
 };
 
 }  // namespace blas
@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_PROFILER_H
+#define ONEMATH_SYCL_BLAS_PROFILER_H
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+/*!
+ * @brief Description of a kernel submitted by the SB_Handle.
+ *
+ * The name and the timestamps are only computed when the records are read,
+ * so the submission itself is not slowed down by the profiling.
+ */
+struct Kernel_Record {
+  std::string name;
+  size_t global_size;
+  size_t local_size;
+  size_t local_memory_size;  // In bytes
+  sycl::event event;
+};
+
+/*!
+ * @brief Collects the kernels submitted by an SB_Handle with profiling
+ * enabled and dumps their timings.
+ *
+ * The profiler is only useful if the queue of the SB_Handle was created with
+ * the sycl::property::queue::enable_profiling property, see
+ * SB_Handle::enable_profiling.
+ */
+class Kernel_Profiler {
+ public:
+  Kernel_Profiler() = default;
+  Kernel_Profiler(const Kernel_Profiler&) = delete;
+  Kernel_Profiler operator=(Kernel_Profiler) = delete;
+
+  /*!
+   * @brief Records the submission of an expression tree.
+   * @param tree The submitted expression tree, used to name the kernel.
+   * @param event Event returned by the submission.
+   * @param local_size Work group size.
+   * @param global_size Global size.
+   * @param local_memory_size Local memory used by the kernel in bytes.
+   */
+  template <typename expression_tree_t>
+  void record(const expression_tree_t& tree, const sycl::event& event,
+              size_t local_size, size_t global_size, size_t local_memory_size);
+
+  /*!
+   * @brief Returns a copy of the records collected so far.
+   */
+  inline std::vector<Kernel_Record> get_records() const;
+
+  /*!
+   * @brief Discards the records collected so far.
+   */
+  inline void clear();
+
+  /*!
+   * @brief Writes the records as a JSON array, one object per kernel with its
+   * name, nd_range, local memory size and start/end timestamps in
+   * nanoseconds. Waits for the completion of the recorded kernels.
+   */
+  inline void dump_json(std::ostream& os) const;
+
+  /*!
+   * @brief Writes the records in the Chrome trace event format, which can be
+   * loaded in chrome://tracing or Perfetto. Waits for the completion of the
+   * recorded kernels.
+   */
+  inline void dump_chrome_trace(std::ostream& os) const;
+
+ private:
+  struct Timestamps {
+    bool valid;
+    uint64_t start;
+    uint64_t end;
+  };
+
+  // Record kept per submission, the kernel name is only built by get_records
+  struct Pending_Record {
+    std::string (*get_name)();
+    size_t global_size;
+    size_t local_size;
+    size_t local_memory_size;
+    sycl::event event;
+  };
+
+  inline static Timestamps get_timestamps(sycl::event event);
+
+  inline static std::string escape(const std::string& str);
+
+  mutable std::mutex records_mutex_;
+  std::vector<Pending_Record> records_;
+};
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_PROFILER_H
@@ -0,0 +1,178 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_SCALAR_RESULT_H
+#define ONEMATH_SYCL_BLAS_SCALAR_RESULT_H
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "helper.h"
+
+namespace blas {
+
+/*!
+ * @brief Result of an asynchronous reduction to a scalar (_dot_async,
+ * _asum_async, _nrm2_async, _iamax_async, _iamin_async).
+ *
+ * The value is copied by the queue to pinned host memory owned by the
+ * Scalar_Result_Pool of the SB_Handle, so reading it only requires the
+ * events to be complete. Several results can be awaited together with
+ * SB_Handle::wait on their events. The memory is returned to the pool when the
+ * last copy of the result is destroyed.
+ */
+template <typename value_t>
+class Scalar_Result {
+ public:
+  using event_t = std::vector<sycl::event>;
+
+  Scalar_Result(const value_t* value, const event_t& events,
+                std::shared_ptr<void> lease)
+      : value_(value), events_(events), lease_(std::move(lease)) {}
+
+  /*!
+   * @brief Waits for the reduction and returns its result.
+   */
+  inline value_t get() const {
+    sycl::event::wait(events_);
+    return *value_;
+  }
+
+  /*!
+   * @brief Whether the result is available without waiting.
+   */
+  inline bool is_ready() const;
+
+  /*!
+   * @brief Events to wait for before reading the result.
+   */
+  inline const event_t& get_events() const { return events_; }
+
+ private:
+  const value_t* value_;
+  event_t events_;
+  std::shared_ptr<void> lease_;
+};
+
+class Scalar_Result_Pool;
+
+/*!
+ * @brief Ownership of a slot of a Scalar_Result_Pool. The slot is released
+ * on destruction and reused once the events are complete.
+ */
+struct Scalar_Result_Lease {
+  std::shared_ptr<Scalar_Result_Pool> pool;
+  size_t index;
+  std::vector<sycl::event> events;
+  inline ~Scalar_Result_Lease();
+};
+
+/*!
+ * @brief Device memory a reduction writes its scalar result to, and the
+ * pinned host memory the result is copied to.
+ * @tparam container_t BufferIterator or USM pointer, matching the inputs of
+ * the reduction.
+ */
+template <typename container_t>
+struct Scalar_Result_Slot {
+  using value_t = typename ValueType<container_t>::type;
+  using event_t = std::vector<sycl::event>;
+
+  container_t device;
+  value_t* host;
+  std::shared_ptr<Scalar_Result_Lease> lease;
+
+  /*!
+   * @brief Copies the device value to the host once dependencies are complete
+   * and returns the corresponding result. The slot must not be used anymore.
+   */
+  inline Scalar_Result<value_t> make_result(sycl::queue q,
+                                            const event_t& dependencies);
+};
+
+/*!
+ * @brief Pool of the memory backing the Scalar_Result of the asynchronous
+ * reductions, so that they do not allocate memory or block.
+ *
+ * The host memory is allocated with sycl::malloc_host in slabs of
+ * slots_per_slab slots, the device memory in slabs of the same size for USM
+ * and as one small buffer per slot for buffers. A slot released by a result
+ * is reused once the copy to the host is complete.
+ */
+class Scalar_Result_Pool
+    : public std::enable_shared_from_this<Scalar_Result_Pool> {
+  using event_t = std::vector<sycl::event>;
+  using buffer_t = sycl::buffer<int8_t, 1>;
+
+ public:
+  // Size in bytes of a slot, the largest supported result type
+  static constexpr size_t slot_size = 16;
+  static constexpr size_t slots_per_slab = 256;
+
+  inline explicit Scalar_Result_Pool(sycl::queue q)
+      : q_(q), in_order_(q.is_in_order()) {}
+  Scalar_Result_Pool(const Scalar_Result_Pool&) = delete;
+  Scalar_Result_Pool operator=(Scalar_Result_Pool) = delete;
+
+  inline ~Scalar_Result_Pool();
+
+  /*!
+   * @brief Acquires a slot for a result of type value_t.
+   * @tparam alloc Memory type of the device memory, the one of the inputs of
+   * the reduction.
+   */
+  template <helper::AllocType alloc, typename value_t>
+  Scalar_Result_Slot<typename helper::AllocHelper<value_t, alloc>::type>
+  acquire();
+
+  inline size_t get_num_slots() const;
+
+ private:
+  friend struct Scalar_Result_Lease;
+
+  inline size_t acquire_index();
+
+  inline void release(size_t index, const event_t& events);
+
+  inline void* get_host_ptr(size_t index) const {
+    return static_cast<int8_t*>(host_slabs_[index / slots_per_slab]) +
+           (index % slots_per_slab) * slot_size;
+  }
+
+  sycl::queue q_;
+  const bool in_order_;
+  mutable std::mutex mutex_;
+  size_t num_slots_ = 0;
+  std::vector<void*> host_slabs_;
+  std::vector<std::optional<buffer_t>> buffers_;
+#ifdef SB_ENABLE_USM
+  std::vector<void*> usm_slabs_;
+#endif
+  std::vector<std::pair<size_t, event_t>> free_slots_;
+};
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_SCALAR_RESULT_H
@@ -24,51 +24,88 @@
 #define TEMP_MEMORY_POOL_H
 
 #ifndef __ADAPTIVECPP__
-#include <map>
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace blas {
+/*!
+ * @brief Pool of the temporary memory used by the operators that need a
+ * scratchpad (reductions, gemv, tall and skinny gemm, ...).
+ *
+ * Allocations are rounded up to power-of-two size classes and cached in free
+ * lists split in shards selected by the calling thread, so that handles used
+ * from different threads rarely contend on the same lock. Releasing memory
+ * does not submit anything to the queue:
+ * - a USM allocation is tagged with the events it depends on, and is only
+ *   handed out again once they are complete (right away if the queue is
+ *   in-order, as the following kernels are ordered after them),
+ * - a buffer is reused right away, the SYCL runtime orders the accesses.
+ *
+ * The cached memory is bounded by a high-water mark: releasing a block above
+ * it frees the cached blocks whose events are complete, largest first.
+ */
 class Temp_Mem_Pool {
   using queue_t = sycl::queue;
   using event_t = std::vector<sycl::event>;
-  using temp_usm_map_t = std::multimap<size_t, void*>;
-  using temp_usm_size_map_t = std::map<void*, size_t>;
-  using temp_buffer_map_t = std::multimap<size_t, sycl::buffer<int8_t, 1>>;
+  using buffer_t = sycl::buffer<int8_t, 1>;
 
  public:
-  Temp_Mem_Pool(queue_t q)
+  static constexpr size_t default_high_water_mark = 1e9;
+
+  Temp_Mem_Pool(queue_t q, size_t high_water_mark = default_high_water_mark)
       : q_(q),
-#ifdef SB_ENABLE_USM
-        temp_usm_map_tot_byte_size_(0),
-#endif
-        temp_buffer_map_tot_byte_size_(0) {
-  }
+        in_order_(q.is_in_order()),
+        high_water_mark_(high_water_mark) {}
   Temp_Mem_Pool(const Temp_Mem_Pool& h) = delete;
   Temp_Mem_Pool operator=(Temp_Mem_Pool) = delete;
 
   ~Temp_Mem_Pool() {
-    // Wait for the completion of all the host tasks
+    // Wait for the completion of the kernels using the cached memory
     q_.wait();
 
 #ifdef VERBOSE
     std::cout << "# buffers destroyed on memory pool destruction: "
-              << temp_buffer_map_.size() << " ("
-              << temp_buffer_map_tot_byte_size_ << " bytes)" << std::endl;
+              << num_cached_buffers() << " (" << temp_buffer_tot_byte_size_
+              << " bytes)" << std::endl;
 #endif
 
 #ifdef SB_ENABLE_USM
 #ifdef VERBOSE
     std::cout << "# USM allocations freed on memory pool destruction: "
-              << temp_usm_map_.size() << " (" << temp_usm_map_tot_byte_size_
+              << num_cached_usm() << " (" << temp_usm_tot_byte_size_
               << " bytes)" << std::endl;
 #endif
-    for (const temp_usm_map_t::value_type& p : temp_usm_map_)
-      sycl::free(p.second, q_);
+    for (auto& shard : shards_) {
+      for (auto& usm_class : shard.usm) {
+        for (auto& block : usm_class) sycl::free(block.ptr, q_);
+      }
+    }
 #endif
   }
 
   inline queue_t get_queue() const { return q_; }
 
+  /*!
+   * @brief Sets the amount of cached memory (per memory type, in bytes) above
+   * which released blocks are freed instead of being cached.
+   */
+  inline void set_high_water_mark(size_t high_water_mark) {
+    high_water_mark_ = high_water_mark;
+  }
+
+  inline size_t get_high_water_mark() const { return high_water_mark_; }
+
+  /*!
+   * @brief Frees the cached blocks that are not in use by a kernel anymore,
+   * until at most max_cached_bytes are cached for each memory type.
+   */
+  inline void trim(size_t max_cached_bytes = 0);
+
   template <typename value_t>
   typename helper::AllocHelper<value_t, helper::AllocType::buffer>::type
   acquire_buff_mem(size_t size);
@@ -88,26 +125,70 @@ class Temp_Mem_Pool {
 #endif
 
  private:
-  static_assert(sizeof(temp_buffer_map_t::mapped_type::value_type) == 1);
+  static_assert(sizeof(buffer_t::value_type) == 1);
+
+  // Size classes go from 2^min_size_class_log2 bytes to 2^(min_size_class_log2
+  // + num_size_classes - 1) bytes, larger requests are not cached
+  static constexpr size_t min_size_class_log2 = 8;
+  static constexpr size_t num_size_classes = 40;
+  static constexpr size_t num_shards = 8;
+  static constexpr size_t usm_alignment = 64;
+
+  struct usm_block_t {
+    void* ptr;
+    // Events to complete before the block can be reused
+    event_t dependencies;
+  };
+
+  struct shard_t {
+    std::mutex mutex;
+    std::array<std::vector<buffer_t>, num_size_classes> buffers;
+#ifdef SB_ENABLE_USM
+    std::array<std::vector<usm_block_t>, num_size_classes> usm;
+#endif
+  };
 
-  static constexpr size_t max_size_temp_mem_ = 1e9;
-  queue_t q_;
+  // Smallest size class holding byte_size bytes
+  inline static size_t size_class(size_t byte_size);
 
-  std::mutex temp_buffer_map_mutex_;
-  size_t temp_buffer_map_tot_byte_size_;
-  temp_buffer_map_t temp_buffer_map_;
+  inline static size_t class_byte_size(size_t size_class) {
+    return size_t{1} << (size_class + min_size_class_log2);
+  }
 
-  template <typename container_t>
-  void release_buff_mem_(const container_t& mem);
+  // Shard holding the free lists of the calling thread
+  inline static size_t get_shard_index() {
+    return std::hash<std::thread::id>{}(std::this_thread::get_id()) %
+           num_shards;
+  }
+
+  inline size_t num_cached_buffers();
+
+  inline void trim_buffers(size_t max_cached_bytes);
+
+  queue_t q_;
+  const bool in_order_;
+  std::atomic<size_t> high_water_mark_;
+  std::array<shard_t, num_shards> shards_;
+
+  std::atomic<size_t> temp_buffer_tot_byte_size_{0};
 
 #ifdef SB_ENABLE_USM
-  std::mutex temp_usm_map_mutex_;
-  size_t temp_usm_map_tot_byte_size_;
-  temp_usm_map_t temp_usm_map_;
-  temp_usm_size_map_t temp_usm_size_map_;
+  // Whether the events are complete
+  inline static bool is_complete(const event_t& dependencies);
 
-  template <typename container_t>
-  void release_usm_mem_(const container_t& mem);
+  // Whether a block depending on the events can be handed out again
+  inline bool is_ready(const event_t& dependencies) const {
+    return in_order_ || is_complete(dependencies);
+  }
+
+  inline size_t num_cached_usm();
+
+  inline void trim_usm(size_t max_cached_bytes);
+
+  std::atomic<size_t> temp_usm_tot_byte_size_{0};
+  // Size class of the USM allocations made by the pool
+  std::shared_mutex temp_usm_size_map_mutex_;
+  std::unordered_map<void*, size_t> temp_usm_size_map_;
 #endif  // SB_ENABLE_USM
 };
 }  // namespace blas
@@ -35,6 +35,18 @@ namespace blas {
 */
 using string_class_t = std::string;
 
+/*!
+@brief Increment of the vectors known at compile time to be contiguous. The
+interface dispatches unit increments to it once per call, so that the views
+access the vectors without checking the stride on every element.
+*/
+using unit_stride_t = std::integral_constant<int, 1>;
+
+template <typename increment_t>
+struct is_unit_stride
+    : std::is_same<typename std::remove_cv<increment_t>::type, unit_stride_t> {
+};
+
 /*!
 @brief Template struct for containing vector that can used within a compile-time
 expression.
@@ -98,13 +110,21 @@ struct VectorView {
   template <bool use_as_ptr = false>
   ONEMATH_SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, value_t &>::type eval(
       index_t i) {
-    return (strd_ == 1) ? *(ptr_ + i) : *(ptr_ + i * strd_);
+    if constexpr (is_unit_stride<increment_t>::value) {
+      return *(ptr_ + i);
+    } else {
+      return (strd_ == 1) ? *(ptr_ + i) : *(ptr_ + i * strd_);
+    }
   }
 
   template <bool use_as_ptr = false>
   ONEMATH_SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, value_t>::type eval(
       index_t i) const {
-    return (strd_ == 1) ? *(ptr_ + i) : *(ptr_ + i * strd_);
+    if constexpr (is_unit_stride<increment_t>::value) {
+      return *(ptr_ + i);
+    } else {
+      return (strd_ == 1) ? *(ptr_ + i) : *(ptr_ + i * strd_);
+    }
   }
 
   ONEMATH_SYCL_BLAS_INLINE value_t &eval(sycl::nd_item<1> ndItem) {
@@ -126,6 +146,32 @@ struct VectorView {
       index_t indx) const noexcept {
     return *(ptr_ + indx);
   }
+
+  /*!
+   * @brief Loads packet_size contiguous elements starting at i, ignoring the
+   * stride (see Vectorized).
+   */
+  template <int packet_size>
+  ONEMATH_SYCL_BLAS_INLINE sycl::vec<value_t, packet_size> eval_packet(
+      index_t i) const {
+    using address_t = sycl::access::address_space;
+    sycl::vec<value_t, packet_size> packet{};
+    packet.template load<address_t::global_space>(
+        0, sycl::multi_ptr<const value_t, address_t::global_space>(ptr_ + i));
+    return packet;
+  }
+
+  /*!
+   * @brief Stores packet_size contiguous elements starting at i, ignoring the
+   * stride (see Vectorized).
+   */
+  template <int packet_size>
+  ONEMATH_SYCL_BLAS_INLINE void store_packet(
+      index_t i, const sycl::vec<value_t, packet_size> &packet) {
+    using address_t = sycl::access::address_space;
+    packet.template store<address_t::global_space>(
+        0, sycl::multi_ptr<value_t, address_t::global_space>(ptr_ + i));
+  }
 };
 
 /*! MatrixView
@@ -116,6 +116,29 @@ typename sb_handle_t::event_t _dot(
 }  // namespace backend
 }  // namespace dot
 
+namespace elementwise {
+namespace backend {
+template <typename sb_handle_t, typename expression_tree_t>
+typename sb_handle_t::event_t _elementwise(
+    sb_handle_t& sb_handle, expression_tree_t t,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using index_t = typename expression_tree_t::index_t;
+  using value_t = typename expression_tree_t::value_t;
+  // 16-byte packets match the width of the block loads of the EUs
+  constexpr int localSize = 256;
+  constexpr int vectorSize =
+      std::min(16, std::max(1, 16 / static_cast<int>(sizeof(value_t))));
+  constexpr int unroll = 2;
+  constexpr index_t elements_per_WG = localSize * vectorSize * unroll;
+  const index_t number_WG = std::min(
+      (t.get_size() + elements_per_WG - 1) / elements_per_WG,
+      static_cast<index_t>(8 * sb_handle.get_num_compute_units()));
+  return blas::internal::_elementwise_impl<localSize, vectorSize, unroll>(
+      sb_handle, t, number_WG, _dependencies);
+}
+}  // namespace backend
+}  // namespace elementwise
+
 }  // namespace blas
 
 #endif
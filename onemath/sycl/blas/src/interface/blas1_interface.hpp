@@ -40,6 +40,110 @@
 
 namespace blas {
 namespace internal {
+/**
+ * \brief Executes an element-wise assignment tree, with the vectorized kernel
+ * chosen by blas::elementwise::backend when all the vectors have a unit
+ * stride and the element type can be held in a sycl::vec, and with one work
+ * item per element otherwise.
+ *
+ * @tparam unit_stride Whether the increments of all the vectors are
+ *                     unit_stride_t
+ * @param sb_handle SB_Handle
+ * @param t Assign or DoubleAssign tree
+ * @param _dependencies Vector of events
+ */
+template <bool unit_stride, typename sb_handle_t, typename expression_tree_t>
+typename sb_handle_t::event_t _execute_elementwise(
+    sb_handle_t &sb_handle, expression_tree_t t,
+    const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (unit_stride &&
+                is_sycl_scalar<typename expression_tree_t::value_t>::value) {
+    return blas::elementwise::backend::_elementwise(sb_handle, t,
+                                                    _dependencies);
+  } else {
+    return sb_handle.execute(t, _dependencies);
+  }
+}
+
+/**
+ * \brief Vectorized execution of an element-wise assignment tree.
+ *
+ * This function is called by blas::elementwise::backend::_elementwise which,
+ * dependent on the platform being compiled for, provides the template
+ * parameters of the kernel.
+ *
+ * @tparam localSize Number of work items per work group
+ * @tparam vectorSize Number of contiguous elements loaded and stored with a
+ *                    single sycl::vec by each work item
+ * @tparam unroll Number of packets processed by each work item per iteration
+ *                of the grid-stride loop
+ * @param number_WG Number of work groups, the grid-stride loop covers the
+ *                  vectors with any number
+ */
+template <int localSize, int vectorSize, int unroll, typename sb_handle_t,
+          typename expression_tree_t, typename index_t>
+typename sb_handle_t::event_t _elementwise_impl(
+    sb_handle_t &sb_handle, expression_tree_t t, const index_t number_WG,
+    const typename sb_handle_t::event_t &_dependencies) {
+  static_assert(localSize >= vectorSize,
+                "The tail of the vectors is evaluated by the first vectorSize "
+                "work items");
+  auto vectorizedOp = make_vectorized<vectorSize, unroll>(t);
+  return sb_handle.execute(vectorizedOp, static_cast<index_t>(localSize),
+                           static_cast<index_t>(number_WG * localSize),
+                           _dependencies);
+}
+
+/**
+ * \brief Runs a reduction of 16-bit floating point values (sycl::half or
+ * bfloat16) with a float accumulator.
+ *
+ * The scalar _rs is copied to a float temporary, reduce accumulates into the
+ * temporary, then the final value is converted back to _rs. The reductions
+ * thus keep the precision of float whatever the size of the vectors, and the
+ * atomics they use are available for float on every device.
+ *
+ * @param sb_handle SB_Handle
+ * @param _rs Memory object holding the scalar result
+ * @param reduce Callable taking the float memory object and a vector of events,
+ *               which submits the reduction and returns its events
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename reduce_t>
+typename sb_handle_t::event_t _reduce_in_float(
+    sb_handle_t &sb_handle, container_t _rs, reduce_t reduce,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  auto acc = sb_handle.template acquire_temp_mem < is_usm
+                 ? helper::AllocType::usm
+                 : helper::AllocType::buffer,
+       float > (1);
+  auto rs = make_vector_view(_rs, unit_stride_t{}, 1);
+  auto accView = make_vector_view(acc, unit_stride_t{}, 1);
+  auto initOp = make_op<Assign>(accView, rs);
+  auto ret = sb_handle.execute(initOp, _dependencies);
+  ret = concatenate_vectors(ret, reduce(acc, ret));
+  auto finalOp = make_op<Assign>(rs, accView);
+  ret = concatenate_vectors(ret, sb_handle.execute(finalOp, ret));
+  sb_handle.release_temp_mem({*ret.rbegin()}, acc);
+  return ret;
+}
+
+/**
+ * @brief Converts the elements of a half or bfloat16 view to value_t, the type
+ * the reductions accumulate in, so that the products are computed in value_t
+ * too. Other views are returned as is.
+ */
+template <typename value_t, typename view_t>
+inline auto _cast_reduced_precision(view_t &view) {
+  if constexpr (is_reduced_precision<
+                    std::remove_cv_t<typename view_t::value_t>>::value) {
+    return make_op<UnaryOp, CastOperator<value_t>>(view);
+  } else {
+    return view;
+  }
+}
+
 /**
  * \brief AXPY constant times a vector plus a vector.
  *
@@ -58,6 +162,12 @@ typename sb_handle_t::event_t _axpy(
     sb_handle_t &sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _axpy(sb_handle, _N, _alpha, _vx, unit_stride_t{}, _vy,
+                   unit_stride_t{}, _dependencies);
+    }
+  }
   typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
@@ -65,7 +175,8 @@ typename sb_handle_t::event_t _axpy(
   auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
   auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
   auto assignOp = make_op<Assign>(vy, addOp);
-  auto ret = sb_handle.execute(assignOp, _dependencies);
+  auto ret = _execute_elementwise<is_unit_stride<increment_t>::value>(
+      sb_handle, assignOp, _dependencies);
   return ret;
 }
 
@@ -85,11 +196,18 @@ typename sb_handle_t::event_t _copy(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _copy(sb_handle, _N, _vx, unit_stride_t{}, _vy, unit_stride_t{},
+                   _dependencies);
+    }
+  }
   typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
   auto assignOp2 = make_op<Assign>(vy, vx);
-  auto ret = sb_handle.execute(assignOp2, _dependencies);
+  auto ret = _execute_elementwise<is_unit_stride<increment_t>::value>(
+      sb_handle, assignOp2, _dependencies);
   return ret;
 }
 
@@ -118,6 +236,12 @@ typename sb_handle_t::event_t _dot(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs,
     const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _dot(sb_handle, _N, _vx, unit_stride_t{}, _vy, unit_stride_t{},
+                  _rs, _dependencies);
+    }
+  }
   return blas::dot::backend::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, _rs,
                                   _dependencies);
 }
@@ -152,14 +276,10 @@ typename sb_handle_t::event_t _sdsdot(
 #ifndef __ADAPTIVECPP__
   if (!_N) {
     using element_t = typename ValueType<container_2_t>::type;
-    sb_handle.wait(_dependencies);
-    auto ret = blas::helper::copy_to_device(
-        sb_handle.get_queue(), reinterpret_cast<element_t *>(&sb), _rs, 1);
-    sb_handle.wait(ret);
-    return {ret};
+    return sb_handle.copy_to_device(reinterpret_cast<element_t *>(&sb), _rs,
+                                    1, _dependencies);
   } else {
-    auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
-                               static_cast<index_t>(1));
+    auto rs = make_vector_view(_rs, unit_stride_t{}, static_cast<index_t>(1));
     auto dotOp = blas::dot::backend::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
                                           _rs, _dependencies);
     auto addOp = make_op<ScalarOp, AddOperator>(sb, rs);
@@ -187,6 +307,11 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _asum(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _asum(sb_handle, _N, _vx, unit_stride_t{}, _rs, _dependencies);
+    }
+  }
   return blas::asum::backend::_asum(sb_handle, _N, _vx, _incx, _rs,
                                     _dependencies);
 }
@@ -224,23 +349,34 @@ typename sb_handle_t::event_t _asum_impl(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const index_t number_WG,
     const typename sb_handle_t::event_t &_dependencies) {
-  typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
-      make_vector_view(_vx, _incx, _N);
-  auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
-                             static_cast<index_t>(1));
-  typename sb_handle_t::event_t ret;
-  auto asumOp =
-      make_wg_atomic_reduction<AbsoluteAddOperator, usmManagedMem>(rs, vx);
-  if constexpr (localMemSize != 0) {
-    ret = sb_handle.execute(asumOp, static_cast<index_t>(localSize),
-                            static_cast<index_t>(number_WG * localSize),
-                            static_cast<index_t>(localMemSize), _dependencies);
+  if constexpr (is_reduced_precision<
+                    typename ValueType<container_1_t>::type>::value) {
+    return _reduce_in_float(
+        sb_handle, _rs,
+        [&](auto acc, const typename sb_handle_t::event_t &deps) {
+          return _asum_impl<localSize, localMemSize, usmManagedMem>(
+              sb_handle, _N, _vx, _incx, acc, number_WG, deps);
+        },
+        _dependencies);
   } else {
-    ret = sb_handle.execute(asumOp, static_cast<index_t>(localSize),
-                            static_cast<index_t>(number_WG * localSize),
-                            _dependencies);
+    typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
+        make_vector_view(_vx, _incx, _N);
+    auto rs = make_vector_view(_rs, unit_stride_t{}, static_cast<index_t>(1));
+    typename sb_handle_t::event_t ret;
+    auto asumOp =
+        make_wg_atomic_reduction<AbsoluteAddOperator, usmManagedMem>(rs, vx);
+    if constexpr (localMemSize != 0) {
+      ret = sb_handle.execute(
+          asumOp, static_cast<index_t>(localSize),
+          static_cast<index_t>(number_WG * localSize),
+          static_cast<index_t>(localMemSize), _dependencies);
+    } else {
+      ret = sb_handle.execute(asumOp, static_cast<index_t>(localSize),
+                              static_cast<index_t>(number_WG * localSize),
+                              _dependencies);
+    }
+    return ret;
   }
-  return ret;
 }
 
 /**
@@ -282,7 +418,7 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
     const typename sb_handle_t::event_t &_dependencies) {
   typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
       make_vector_view(_vx, _incx, _N);
-  auto rs = make_vector_view<index_t>(_rs, static_cast<increment_t>(1),
+  auto rs = make_vector_view<index_t>(_rs, unit_stride_t{},
                                       static_cast<index_t>(1));
   auto tupOp = make_tuple_op(vx);
   typename sb_handle_t::event_t ret;
@@ -322,8 +458,7 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
                        ? helper::AllocType::usm
                        : helper::AllocType::buffer,
          tuple_t > (memory_size);
-    auto gpu_res_vec =
-        make_vector_view(gpu_res, static_cast<increment_t>(1), memory_size);
+    auto gpu_res_vec = make_vector_view(gpu_res, unit_stride_t{}, memory_size);
     auto step0 = make_index_max_min<is_max, true>(gpu_res_vec, tupOp);
     auto step1 = make_index_max_min<is_max, false>(rs, gpu_res_vec);
     if constexpr (localMemSize == 0) {
@@ -336,8 +471,8 @@ typename sb_handle_t::event_t _iamax_iamin_impl(
       // min_sub_group size is not the same as the actual sub_group
       // size used at runtime, the implementation does not use
       // garbage values to effect the correctness of the output.
-      ret = typename sb_handle_t::event_t{helper::copy_to_device(
-          q, init_vec.data(), gpu_res, memory_size, _dependencies)};
+      ret = sb_handle.copy_to_device(init_vec.data(), gpu_res, memory_size,
+                                     _dependencies);
       ret = concatenate_vectors(
           ret, sb_handle.execute(step0, static_cast<index_t>(localSize),
                                  _nWG * static_cast<index_t>(localSize), ret));
@@ -372,12 +507,14 @@ typename sb_handle_t::event_t _iamax(
     ContainerI _rs, const typename sb_handle_t::event_t &_dependencies) {
   if (_incx < 0 || _N < 0) {
     index_t out = 0;
-    return typename sb_handle_t::event_t{
-        helper::fill(sb_handle.get_queue(), _rs, out, 1, _dependencies)};
-  } else {
-    return blas::iamax::backend::_iamax(sb_handle, _N, _vx, _incx, _rs,
-                                        _dependencies);
+    return sb_handle.fill(_rs, out, 1, _dependencies);
+  } else if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _iamax(sb_handle, _N, _vx, unit_stride_t{}, _rs, _dependencies);
+    }
   }
+  return blas::iamax::backend::_iamax(sb_handle, _N, _vx, _incx, _rs,
+                                      _dependencies);
 }
 
 /**
@@ -394,12 +531,14 @@ typename sb_handle_t::event_t _iamin(
     ContainerI _rs, const typename sb_handle_t::event_t &_dependencies) {
   if (_incx < 0 || _N < 0) {
     index_t out = 0;
-    return typename sb_handle_t::event_t{
-        helper::fill(sb_handle.get_queue(), _rs, out, 1, _dependencies)};
-  } else {
-    return blas::iamin::backend::_iamin(sb_handle, _N, _vx, _incx, _rs,
-                                        _dependencies);
+    return sb_handle.fill(_rs, out, 1, _dependencies);
+  } else if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _iamin(sb_handle, _N, _vx, unit_stride_t{}, _rs, _dependencies);
+    }
   }
+  return blas::iamin::backend::_iamin(sb_handle, _N, _vx, _incx, _rs,
+                                      _dependencies);
 }
 
 /**
@@ -418,10 +557,17 @@ typename sb_handle_t::event_t _swap(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _swap(sb_handle, _N, _vx, unit_stride_t{}, _vy, unit_stride_t{},
+                   _dependencies);
+    }
+  }
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
   auto swapOp = make_op<DoubleAssign>(vy, vx, vx, vy);
-  auto ret = sb_handle.execute(swapOp, _dependencies);
+  auto ret = _execute_elementwise<is_unit_stride<increment_t>::value>(
+      sb_handle, swapOp, _dependencies);
 
   return ret;
 }
@@ -438,16 +584,23 @@ template <typename sb_handle_t, typename element_t, typename container_0_t,
 typename sb_handle_t::event_t _scal(
     sb_handle_t &sb_handle, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _scal(sb_handle, _N, _alpha, _vx, unit_stride_t{}, _dependencies);
+    }
+  }
   auto vx = make_vector_view(_vx, _incx, _N);
   if (_alpha == element_t{0}) {
     auto zeroOp = make_op<UnaryOp, AdditionIdentity>(vx);
     auto assignOp = make_op<Assign>(vx, zeroOp);
-    auto ret = sb_handle.execute(assignOp, _dependencies);
+    auto ret = _execute_elementwise<is_unit_stride<increment_t>::value>(
+        sb_handle, assignOp, _dependencies);
     return ret;
   } else {
     auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
     auto assignOp = make_op<Assign>(vx, scalOp);
-    auto ret = sb_handle.execute(assignOp, _dependencies);
+    auto ret = _execute_elementwise<is_unit_stride<increment_t>::value>(
+        sb_handle, assignOp, _dependencies);
     return ret;
   }
 }
@@ -495,6 +648,13 @@ typename sb_handle_t::event_t _scal_matrix_impl(
           _A, _M, _N, _lda, _incA);
   if (_alpha == element_t{1}) {
     return _dependencies;
+  } else if (_alpha == element_t{0}) {
+    // The matrix is zeroed, even where it holds NaN or infinity
+    auto zero_op = make_op<UnaryOp, AdditionIdentity>(m_view);
+    auto copy_op = make_op<Assign>(m_view, zero_op);
+    typename sb_handle_t::event_t ret =
+        sb_handle.execute(copy_op, _dependencies);
+    return ret;
   } else {
     auto scal_op = make_op<ScalarOp, ProductOperator>(_alpha, m_view);
     auto copy_op = make_op<Assign>(m_view, scal_op);
@@ -517,6 +677,11 @@ template <typename sb_handle_t, typename container_0_t, typename container_1_t,
 typename sb_handle_t::event_t _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _nrm2(sb_handle, _N, _vx, unit_stride_t{}, _rs, _dependencies);
+    }
+  }
   return blas::nrm2::backend::_nrm2(sb_handle, _N, _vx, _incx, _rs,
                                     _dependencies);
 }
@@ -554,28 +719,41 @@ typename sb_handle_t::event_t _nrm2_impl(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _rs, const index_t number_WG,
     const typename sb_handle_t::event_t &_dependencies) {
-  typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
-      make_vector_view(_vx, _incx, _N);
-  auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
-                             static_cast<index_t>(1));
-  auto prdOp = make_op<UnaryOp, SquareOperator>(vx);
-
-  auto assignOp =
-      make_wg_atomic_reduction<AddOperator, usmManagedMem>(rs, prdOp);
-  typename sb_handle_t::event_t ret0;
-  if constexpr (localMemSize != 0) {
-    ret0 = sb_handle.execute(assignOp, static_cast<index_t>(localSize),
-                             static_cast<index_t>(number_WG * localSize),
-                             static_cast<index_t>(localMemSize), _dependencies);
+  if constexpr (is_reduced_precision<
+                    typename ValueType<container_1_t>::type>::value) {
+    return _reduce_in_float(
+        sb_handle, _rs,
+        [&](auto acc, const typename sb_handle_t::event_t &deps) {
+          return _nrm2_impl<localSize, localMemSize, usmManagedMem>(
+              sb_handle, _N, _vx, _incx, acc, number_WG, deps);
+        },
+        _dependencies);
   } else {
-    ret0 = sb_handle.execute(assignOp, static_cast<index_t>(localSize),
-                             static_cast<index_t>(number_WG * localSize),
-                             _dependencies);
+    using value_t = typename ValueType<container_1_t>::type;
+    typename VectorViewType<container_0_t, index_t, increment_t>::type vx =
+        make_vector_view(_vx, _incx, _N);
+    auto rs = make_vector_view(_rs, unit_stride_t{}, static_cast<index_t>(1));
+    auto vxValue = _cast_reduced_precision<value_t>(vx);
+    auto prdOp = make_op<UnaryOp, SquareOperator>(vxValue);
+
+    auto assignOp =
+        make_wg_atomic_reduction<AddOperator, usmManagedMem>(rs, prdOp);
+    typename sb_handle_t::event_t ret0;
+    if constexpr (localMemSize != 0) {
+      ret0 = sb_handle.execute(
+          assignOp, static_cast<index_t>(localSize),
+          static_cast<index_t>(number_WG * localSize),
+          static_cast<index_t>(localMemSize), _dependencies);
+    } else {
+      ret0 = sb_handle.execute(assignOp, static_cast<index_t>(localSize),
+                               static_cast<index_t>(number_WG * localSize),
+                               _dependencies);
+    }
+    auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
+    auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
+    auto ret1 = sb_handle.execute(assignOpFinal, ret0);
+    return blas::concatenate_vectors(ret0, ret1);
   }
-  auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
-  auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
-  auto ret1 = sb_handle.execute(assignOpFinal, ret0);
-  return blas::concatenate_vectors(ret0, ret1);
 }
 
 /**
@@ -614,29 +792,47 @@ typename sb_handle_t::event_t _dot_impl(
     container_1_t _vy, increment_t _incy, container_2_t _rs,
     const index_t _number_wg,
     const typename sb_handle_t::event_t &_dependencies) {
-  typename sb_handle_t::event_t ret_event;
   // Skip if N==0, _rs is not overwritten
   if (!_N) return {_dependencies};
-  auto vx = make_vector_view(_vx, _incx, _N);
-  auto vy = make_vector_view(_vy, _incy, _N);
-  auto rs = make_vector_view(_rs, static_cast<increment_t>(1),
-                             static_cast<index_t>(1));
-
-  auto prdOp = make_op<BinaryOpConst, ProductOperator>(vx, vy);
-  auto wgReductionOp =
-      make_wg_atomic_reduction<AddOperator, usmManagedMem>(rs, prdOp);
-
-  if constexpr (localMemSize) {
-    ret_event =
-        sb_handle.execute(wgReductionOp, static_cast<index_t>(localSize),
-                          static_cast<index_t>(_number_wg * localSize),
-                          static_cast<index_t>(localMemSize), _dependencies);
+  if constexpr (is_reduced_precision<
+                    typename ValueType<container_2_t>::type>::value) {
+    return _reduce_in_float(
+        sb_handle, _rs,
+        [&](auto acc, const typename sb_handle_t::event_t &deps) {
+          return _dot_impl<localSize, localMemSize, usmManagedMem>(
+              sb_handle, _N, _vx, _incx, _vy, _incy, acc, _number_wg, deps);
+        },
+        _dependencies);
   } else {
-    ret_event = sb_handle.execute(
-        wgReductionOp, static_cast<index_t>(localSize),
-        static_cast<index_t>(_number_wg * localSize), _dependencies);
+    using value_t = typename ValueType<container_2_t>::type;
+    auto vx = make_vector_view(_vx, _incx, _N);
+    auto vy = make_vector_view(_vy, _incy, _N);
+    auto rs = make_vector_view(_rs, unit_stride_t{}, static_cast<index_t>(1));
+
+    auto reduce = [&](auto prdOp) {
+      auto wgReductionOp =
+          make_wg_atomic_reduction<AddOperator, usmManagedMem>(rs, prdOp);
+      if constexpr (localMemSize) {
+        return sb_handle.execute(
+            wgReductionOp, static_cast<index_t>(localSize),
+            static_cast<index_t>(_number_wg * localSize),
+            static_cast<index_t>(localMemSize), _dependencies);
+      } else {
+        return sb_handle.execute(
+            wgReductionOp, static_cast<index_t>(localSize),
+            static_cast<index_t>(_number_wg * localSize), _dependencies);
+      }
+    };
+    if constexpr (is_reduced_precision<std::remove_cv_t<
+                      typename decltype(vx)::value_t>>::value) {
+      // The UnaryOp casts can't be evaluated by BinaryOpConst
+      auto vxValue = _cast_reduced_precision<value_t>(vx);
+      auto vyValue = _cast_reduced_precision<value_t>(vy);
+      return reduce(make_op<BinaryOp, ProductOperator>(vxValue, vyValue));
+    } else {
+      return reduce(make_op<BinaryOpConst, ProductOperator>(vx, vy));
+    }
   }
-  return ret_event;
 }
 
 /**
@@ -659,6 +855,12 @@ typename sb_handle_t::event_t _rot(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin,
     const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _rot(sb_handle, _N, _vx, unit_stride_t{}, _vy, unit_stride_t{},
+                  _cos, _sin, _dependencies);
+    }
+  }
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
   auto scalOp1 = make_op<ScalarOp, ProductOperator>(_cos, vx);
@@ -668,7 +870,8 @@ typename sb_handle_t::event_t _rot(
   auto addOp12 = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
   auto addOp34 = make_op<BinaryOp, AddOperator>(scalOp3, scalOp4);
   auto DoubleAssignView = make_op<DoubleAssign>(vx, vy, addOp12, addOp34);
-  auto ret = sb_handle.execute(DoubleAssignView, _dependencies);
+  auto ret = _execute_elementwise<is_unit_stride<increment_t>::value>(
+      sb_handle, DoubleAssignView, _dependencies);
   return ret;
 }
 
@@ -711,6 +914,12 @@ typename sb_handle_t::event_t _rotm(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _param,
     const typename sb_handle_t::event_t &_dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _rotm(sb_handle, _N, _vx, unit_stride_t{}, _vy, unit_stride_t{},
+                   _param, _dependencies);
+    }
+  }
   auto vx = make_vector_view(_vx, _incx, _N);
   auto vy = make_vector_view(_vy, _incy, _N);
 
@@ -818,19 +1027,17 @@ typename sb_handle_t::event_t _rotmg(
     auto _y1_tmp = blas::helper::allocate<mem_type, container_3_t>(
         1, sb_handle.get_queue());
 
-    auto copy_y1 = blas::helper::copy_to_device(sb_handle.get_queue(), &_y1,
-                                                _y1_tmp, 1, _dependencies);
+    auto copy_y1 = sb_handle.copy_to_device(&_y1, _y1_tmp, 1, _dependencies);
 
     auto y1_view = make_vector_view(_y1_tmp, inc, vector_size);
     auto operation = Rotmg<decltype(d1_view)>(d1_view, d2_view, x1_view,
                                               y1_view, param_view);
 
-    auto operator_event =
-        sb_handle.execute(operation, typename sb_handle_t::event_t{copy_y1});
+    auto operator_event = sb_handle.execute(operation, copy_y1);
     if constexpr (mem_type != helper::AllocType::buffer) {
       // This wait is necessary to free the temporary memory created above and
       // avoiding the host_task
-      operator_event[0].wait();
+      sb_handle.wait(operator_event);
       sycl::free(_y1_tmp, sb_handle.get_queue());
     }
     return operator_event;
@@ -937,7 +1144,7 @@ void _rotg(sb_handle_t &sb_handle, scalar_t &a, scalar_t &b, scalar_t &c,
 
 /**
  * \brief Computes the inner product of two vectors with double precision
- * accumulation (synchronous version that returns the result directly)
+ * accumulation (asynchronous version that returns a Scalar_Result)
  * @tparam sb_handle_t SB_Handle type
  * @tparam container_0_t Buffer Iterator or USM pointer
  * @tparam container_1_t Buffer Iterator or USM pointer
@@ -949,45 +1156,170 @@ void _rotg(sb_handle_t &sb_handle, scalar_t &a, scalar_t &b, scalar_t &c,
  * @param _incx Stride of vector x (i.e. measured in elements of _vx)
  * @param _vy Memory object holding input vector y
  * @param _incy Stride of vector y (i.e. measured in elements of _vy)
- * @param _rs Output memory object
  * @param _dependencies Vector of events
- * @return Vector of events to wait for.
+ * @return Result of the inner product, copied to the host asynchronously.
  */
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename index_t, typename increment_t>
-typename ValueType<container_0_t>::type _dot(
+Scalar_Result<typename ValueType<container_0_t>::type> _dot_async(
     sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy,
     const typename sb_handle_t::event_t &_dependencies) {
 #ifndef __ADAPTIVECPP__
   constexpr bool is_usm = std::is_pointer<container_0_t>::value;
   using element_t = typename ValueType<container_0_t>::type;
-  element_t res{0};
-  auto gpu_res = helper::allocate < is_usm ? helper::AllocType::usm
-                                           : helper::AllocType::buffer,
-       element_t > (static_cast<index_t>(1), sb_handle.get_queue());
-  auto copyTodD =
-      blas::helper::copy_to_device(sb_handle.get_queue(), &res, gpu_res, 1);
-  typename sb_handle_t::event_t all_deps = concatenate_vectors(
-      _dependencies, typename sb_handle_t::event_t{copyTodD});
+  auto slot = sb_handle.get_scalar_result_pool()
+                  ->template acquire<is_usm ? helper::AllocType::usm
+                                            : helper::AllocType::buffer,
+                                     element_t>();
+  // The reduction accumulates into the result
+  auto init_res_event =
+      sb_handle.fill(slot.device, element_t{0}, 1, _dependencies);
+  auto dotOp = internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy,
+                              slot.device, init_res_event);
+  return slot.make_result(sb_handle.get_queue(), dotOp);
+#else
+  throw std::runtime_error(
+      "Dot is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
+#endif
+}
 
-  auto dotOp =
-      internal::_dot(sb_handle, _N, _vx, _incx, _vy, _incy, gpu_res, all_deps);
+/**
+ * \brief IAMAX finds the index of the first element having maximum
+ * (asynchronous version that returns a Scalar_Result)
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<index_t> _iamax_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  auto slot = sb_handle.get_scalar_result_pool()
+                  ->template acquire<is_usm ? helper::AllocType::usm
+                                            : helper::AllocType::buffer,
+                                     index_t>();
+  auto iamax_event = blas::internal::_iamax(sb_handle, _N, _vx, _incx,
+                                            slot.device, _dependencies);
+  return slot.make_result(sb_handle.get_queue(), iamax_event);
+}
 
-  sb_handle.wait(dotOp);
-  auto copyToH = helper::copy_to_host(sb_handle.get_queue(), gpu_res, &res, 1);
-  sb_handle.wait(copyToH);
+/**
+ * \brief IAMIN finds the index of the first element having minimum
+ * (asynchronous version that returns a Scalar_Result)
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<index_t> _iamin_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  auto slot = sb_handle.get_scalar_result_pool()
+                  ->template acquire<is_usm ? helper::AllocType::usm
+                                            : helper::AllocType::buffer,
+                                     index_t>();
+  auto iamin_event = blas::internal::_iamin(sb_handle, _N, _vx, _incx,
+                                            slot.device, _dependencies);
+  return slot.make_result(sb_handle.get_queue(), iamin_event);
+}
 
-  helper::deallocate<is_usm ? helper::AllocType::usm
-                            : helper::AllocType::buffer>(gpu_res,
-                                                         sb_handle.get_queue());
-  return res;
+/**
+ * \brief ASUM Takes the sum of the absolute values (asynchronous version that
+ * returns a Scalar_Result)
+ *
+ * @param sb_handle_t sb_handle
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<typename ValueType<container_t>::type> _asum_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+#ifndef __ADAPTIVECPP__
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  using element_t = typename ValueType<container_t>::type;
+  auto slot = sb_handle.get_scalar_result_pool()
+                  ->template acquire<is_usm ? helper::AllocType::usm
+                                            : helper::AllocType::buffer,
+                                     element_t>();
+  auto init_res_event =
+      sb_handle.fill(slot.device, element_t{0}, 1, _dependencies);
+  auto asum_event = blas::internal::_asum(sb_handle, _N, _vx, _incx,
+                                          slot.device, init_res_event);
+  return slot.make_result(sb_handle.get_queue(), asum_event);
 #else
   throw std::runtime_error(
-      "Dot is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
+      "Asum is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
+#endif
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector (asynchronous version
+ * that returns a Scalar_Result)
+ *
+ * @param sb_handle_t sb_handle
+ * @param _vx  BufferIterator or USM pointer
+ * @param _incx Increment in X axis
+ * @param _dependencies Vector of events
+ */
+template <typename sb_handle_t, typename container_t, typename index_t,
+          typename increment_t>
+Scalar_Result<typename ValueType<container_t>::type> _nrm2_async(
+    sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
+    const typename sb_handle_t::event_t &_dependencies) {
+#ifndef __ADAPTIVECPP__
+  constexpr bool is_usm = std::is_pointer<container_t>::value;
+  using element_t = typename ValueType<container_t>::type;
+  auto slot = sb_handle.get_scalar_result_pool()
+                  ->template acquire<is_usm ? helper::AllocType::usm
+                                            : helper::AllocType::buffer,
+                                     element_t>();
+  auto init_res_event =
+      sb_handle.fill(slot.device, element_t{0}, 1, _dependencies);
+  auto nrm2_event = blas::internal::_nrm2(sb_handle, _N, _vx, _incx,
+                                          slot.device, init_res_event);
+  return slot.make_result(sb_handle.get_queue(), nrm2_event);
+#else
+  throw std::runtime_error(
+      "Nrm2 is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
 #endif
 }
 
+/**
+ * \brief Computes the inner product of two vectors with double precision
+ * accumulation (synchronous version that returns the result directly)
+ * @tparam sb_handle_t SB_Handle type
+ * @tparam container_0_t Buffer Iterator or USM pointer
+ * @tparam container_1_t Buffer Iterator or USM pointer
+ * @tparam index_t Index type
+ * @tparam increment_t Increment type
+ * @param sb_handle SB_Handle
+ * @param _N Input buffer sizes.
+ * @param _vx Memory object holding input vector x
+ * @param _incx Stride of vector x (i.e. measured in elements of _vx)
+ * @param _vy Memory object holding input vector y
+ * @param _incy Stride of vector y (i.e. measured in elements of _vy)
+ * @param _rs Output memory object
+ * @param _dependencies Vector of events
+ * @return Vector of events to wait for.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename ValueType<container_0_t>::type _dot(
+    sb_handle_t &sb_handle, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy,
+    const typename sb_handle_t::event_t &_dependencies) {
+  return _dot_async(sb_handle, _N, _vx, _incx, _vy, _incy, _dependencies)
+      .get();
+}
+
 /**
  * \brief Computes the inner product of two vectors with double precision
  * accumulation and adds a scalar to the result (synchronous version that
@@ -1049,22 +1381,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 index_t _iamax(sb_handle_t &sb_handle, index_t _N, container_t _vx,
                increment_t _incx,
                const typename sb_handle_t::event_t &_dependencies) {
-  constexpr bool is_usm = std::is_pointer<container_t>::value;
-  using element_t = typename ValueType<container_t>::type;
-  index_t rsT{-1};
-  auto gpu_res = blas::helper::allocate < is_usm ? helper::AllocType::usm
-                                                 : helper::AllocType::buffer,
-       index_t > (static_cast<index_t>(1), sb_handle.get_queue());
-  auto iamax_event =
-      blas::internal::_iamax(sb_handle, _N, _vx, _incx, gpu_res, _dependencies);
-  sb_handle.wait(iamax_event);
-  auto event = blas::helper::copy_to_host<index_t>(sb_handle.get_queue(),
-                                                   gpu_res, &rsT, 1);
-  sb_handle.wait(event);
-  blas::helper::deallocate<is_usm ? helper::AllocType::usm
-                                  : helper::AllocType::buffer>(
-      gpu_res, sb_handle.get_queue());
-  return rsT;
+  return _iamax_async(sb_handle, _N, _vx, _incx, _dependencies).get();
 }
 
 /**
@@ -1078,22 +1395,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 index_t _iamin(sb_handle_t &sb_handle, index_t _N, container_t _vx,
                increment_t _incx,
                const typename sb_handle_t::event_t &_dependencies) {
-  constexpr bool is_usm = std::is_pointer<container_t>::value;
-  using element_t = typename ValueType<container_t>::type;
-  index_t rsT{-1};
-  auto gpu_res = blas::helper::allocate < is_usm ? helper::AllocType::usm
-                                                 : helper::AllocType::buffer,
-       index_t > (static_cast<index_t>(1), sb_handle.get_queue());
-  auto iamin_event =
-      blas::internal::_iamin(sb_handle, _N, _vx, _incx, gpu_res, _dependencies);
-  sb_handle.wait(iamin_event);
-  auto event =
-      blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, &rsT, 1);
-  sb_handle.wait(event);
-  blas::helper::deallocate<is_usm ? helper::AllocType::usm
-                                  : helper::AllocType::buffer>(
-      gpu_res, sb_handle.get_queue());
-  return rsT;
+  return _iamin_async(sb_handle, _N, _vx, _incx, _dependencies).get();
 }
 
 /**
@@ -1109,31 +1411,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies) {
-#ifndef __ADAPTIVECPP__
-  constexpr bool is_usm = std::is_pointer<container_t>::value;
-  using element_t = typename ValueType<container_t>::type;
-  auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = blas::helper::allocate < is_usm ? helper::AllocType::usm
-                                                 : helper::AllocType::buffer,
-       element_t > (static_cast<index_t>(1), sb_handle.get_queue());
-  const typename sb_handle_t::event_t init_res_event = {
-      blas::helper::copy_to_device(sb_handle.get_queue(), res.data(), gpu_res,
-                                   1)};
-  auto local_deps = concatenate_vectors(_dependencies, init_res_event);
-  auto asum_event =
-      blas::internal::_asum(sb_handle, _N, _vx, _incx, gpu_res, local_deps);
-  sb_handle.wait(asum_event);
-  auto event =
-      blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, res.data(), 1);
-  sb_handle.wait(event);
-  blas::helper::deallocate<is_usm ? helper::AllocType::usm
-                                  : helper::AllocType::buffer>(
-      gpu_res, sb_handle.get_queue());
-  return res[0];
-#else
-  throw std::runtime_error(
-      "Asum is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
-#endif
+  return _asum_async(sb_handle, _N, _vx, _incx, _dependencies).get();
 }
 
 /**
@@ -1149,30 +1427,7 @@ template <typename sb_handle_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(
     sb_handle_t &sb_handle, index_t _N, container_t _vx, increment_t _incx,
     const typename sb_handle_t::event_t &_dependencies) {
-#ifndef __ADAPTIVECPP__
-  constexpr bool is_usm = std::is_pointer<container_t>::value;
-  using element_t = typename ValueType<container_t>::type;
-  auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = blas::helper::allocate < is_usm ? helper::AllocType::usm
-                                                 : helper::AllocType::buffer,
-       element_t > (static_cast<index_t>(1), sb_handle.get_queue());
-  typename sb_handle_t::event_t copy_init_val = {blas::helper::copy_to_device(
-      sb_handle.get_queue(), res.data(), gpu_res, 1)};
-  const auto local_deps = concatenate_vectors(_dependencies, copy_init_val);
-  auto nrm2_event =
-      blas::internal::_nrm2(sb_handle, _N, _vx, _incx, gpu_res, local_deps);
-  sb_handle.wait(nrm2_event);
-  auto event =
-      blas::helper::copy_to_host(sb_handle.get_queue(), gpu_res, res.data(), 1);
-  sb_handle.wait(event);
-  blas::helper::deallocate<is_usm ? helper::AllocType::usm
-                                  : helper::AllocType::buffer>(
-      gpu_res, sb_handle.get_queue());
-  return res[0];
-#else
-  throw std::runtime_error(
-      "Nrm2 is not supported with AdaptiveCpp as it uses SYCL 2020 reduction.");
-#endif
+  return _nrm2_async(sb_handle, _N, _vx, _incx, _dependencies).get();
 }
 
 }  // namespace internal
@@ -377,15 +377,13 @@ typename sb_handle_t::event_t _trsv_impl(
                  : ((roundUp<index_t>(_N, subgroup_size) / subgroup_size) - 1);
   sync_vec[1] = sync_vec[0];
 
-  auto queue = sb_handle.get_queue();
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
   auto sync_buffer = sb_handle.template acquire_temp_mem < is_usm
                          ? blas::helper::AllocType::usm
                          : blas::helper::AllocType::buffer,
        int32_t > (sync_vec.size());
-  auto copy_sync = blas::helper::copy_to_device<int32_t>(
-      queue, sync_vec.data(), sync_buffer, sync_vec.size());
-  sb_handle.wait(copy_sync);
+  auto copy_sync =
+      sb_handle.copy_to_device(sync_vec.data(), sync_buffer, sync_vec.size());
 
   auto sync = make_vector_view(sync_buffer, 1, sync_vec.size());
 
@@ -399,7 +397,7 @@ typename sb_handle_t::event_t _trsv_impl(
       trsv, static_cast<index_t>(sub_num * subgroup_size),
       roundUp<index_t>(sub_num * _N, sub_num * subgroup_size),
       static_cast<index_t>(subgroup_size * (subgroup_size + 2 + sub_num)),
-      _dependencies);
+      concatenate_vectors(_dependencies, copy_sync));
 
   sb_handle.release_temp_mem(ret, sync_buffer);
 
@@ -773,15 +771,13 @@ typename sb_handle_t::event_t _tbsv_impl(
   sync_vec[1] = sync_vec[0];
 
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
-  auto queue = sb_handle.get_queue();
 
   auto sync_buffer = sb_handle.template acquire_temp_mem < is_usm
                          ? blas::helper::AllocType::usm
                          : blas::helper::AllocType::buffer,
        int32_t > (sync_vec.size());
-  auto copy_sync = blas::helper::copy_to_device<int32_t>(
-      queue, sync_vec.data(), sync_buffer, sync_vec.size());
-  sb_handle.wait(copy_sync);
+  auto copy_sync =
+      sb_handle.copy_to_device(sync_vec.data(), sync_buffer, sync_vec.size());
 
   auto sync = make_vector_view(sync_buffer, 1, sync_vec.size());
 
@@ -794,7 +790,7 @@ typename sb_handle_t::event_t _tbsv_impl(
       tbsv, static_cast<index_t>(sub_num * subgroup_size),
       roundUp<index_t>(sub_num * _N, sub_num * subgroup_size),
       static_cast<index_t>(subgroup_size * (subgroup_size + 2 + sub_num)),
-      _dependencies);
+      concatenate_vectors(_dependencies, copy_sync));
 
   sb_handle.release_temp_mem(ret, sync_buffer);
 
@@ -837,15 +833,13 @@ typename sb_handle_t::event_t _tpsv_impl(
   sync_vec[1] = sync_vec[0];
 
   constexpr bool is_usm = std::is_pointer<container_t0>::value;
-  auto queue = sb_handle.get_queue();
 
   auto sync_buffer = sb_handle.template acquire_temp_mem < is_usm
                          ? blas::helper::AllocType::usm
                          : blas::helper::AllocType::buffer,
        int32_t > (sync_vec.size());
-  auto copy_sync = blas::helper::copy_to_device<int32_t>(
-      queue, sync_vec.data(), sync_buffer, sync_vec.size());
-  sb_handle.wait(copy_sync);
+  auto copy_sync =
+      sb_handle.copy_to_device(sync_vec.data(), sync_buffer, sync_vec.size());
 
   auto sync =
       make_vector_view(sync_buffer, one_increment_t::value(), sync_vec.size());
@@ -859,7 +853,7 @@ typename sb_handle_t::event_t _tpsv_impl(
       tpsv, static_cast<index_t>(sub_num * subgroup_size),
       roundUp<index_t>(sub_num * _N, sub_num * subgroup_size),
       static_cast<index_t>(subgroup_size * (subgroup_size + 2 + sub_num)),
-      _dependencies);
+      concatenate_vectors(_dependencies, copy_sync));
 
   sb_handle.release_temp_mem(ret, sync_buffer);
 
@@ -1180,6 +1174,13 @@ typename sb_handle_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy,  // The increment for elements in y (nonzero).
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _gemv(sb_handle, _trans, _M, _N, _alpha, _mA, _lda, _vx,
+                   unit_stride_t{}, _beta, _vy, unit_stride_t{},
+                   _dependencies);
+    }
+  }
   return tolower(_trans) == 'n'
              ? blas::gemv::backend::_gemv<transpose_type::Normal>(
                    sb_handle, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
@@ -1195,6 +1196,12 @@ typename sb_handle_t::event_t inline _trmv(
     sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
     container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _trmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _lda, _vx,
+                   unit_stride_t{}, _dependencies);
+    }
+  }
   // TODO: Here we can use some heuristics to select localn global, local, and
   // scratch size per device
   return tolower(_trans) == 'n'
@@ -1264,6 +1271,13 @@ typename sb_handle_t::event_t inline _symv(
     container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
     element_t _beta, container_t2 _vy, increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _symv(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx,
+                   unit_stride_t{}, _beta, _vy, unit_stride_t{},
+                   _dependencies);
+    }
+  }
   // TODO: Here we can use some heuristics to select localn global, local, and
   // scratch size per device
   return _symv_impl(sb_handle, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx, _beta,
@@ -1278,6 +1292,13 @@ typename sb_handle_t::event_t inline _gbmv(
     index_t _KU, element_t _alpha, container_t0 _mA, index_t _lda,
     container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
     increment_t _incy, const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _gbmv(sb_handle, _trans, _M, _N, _KL, _KU, _alpha, _mA, _lda,
+                   _vx, unit_stride_t{}, _beta, _vy, unit_stride_t{},
+                   _dependencies);
+    }
+  }
   return tolower(_trans) == 'n'
              ? blas::gbmv::backend::_gbmv<transpose_type::Normal>(
                    sb_handle, _M, _N, _KL, _KU, _alpha, _mA, _lda, _vx, _incx,
@@ -1295,6 +1316,12 @@ typename sb_handle_t::event_t inline _ger(
     container_t0 _vx, increment_t _incx, container_t1 _vy, increment_t _incy,
     container_t2 _mA, index_t _lda,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _ger(sb_handle, _M, _N, _alpha, _vx, unit_stride_t{}, _vy,
+                  unit_stride_t{}, _mA, _lda, _dependencies);
+    }
+  }
   index_t localSize = 0;
   bool useLocalMem = true;
   index_t nRowsWG = 0;
@@ -1329,6 +1356,13 @@ typename sb_handle_t::event_t inline _sbmv(
     element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _vx,
     increment_t _incx, element_t _beta, container_t2 _vy, increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _sbmv(sb_handle, _Uplo, _N, _K, _alpha, _mA, _lda, _vx,
+                   unit_stride_t{}, _beta, _vy, unit_stride_t{},
+                   _dependencies);
+    }
+  }
   return tolower(_Uplo) == 'u' ? blas::sbmv::backend::_sbmv<uplo_type::Upper>(
                                      sb_handle, _N, _K, _alpha, _mA, _lda, _vx,
                                      _incx, _beta, _vy, _incy, _dependencies)
@@ -1345,6 +1379,12 @@ typename sb_handle_t::event_t inline _spmv(
     container_t0 _mA, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _spmv(sb_handle, _Uplo, _N, _alpha, _mA, _vx, unit_stride_t{},
+                   _beta, _vy, unit_stride_t{}, _dependencies);
+    }
+  }
   return tolower(_Uplo) == 'u' ? blas::spmv::backend::_spmv<uplo_type::Upper>(
                                      sb_handle, _N, _alpha, _mA, _vx, _incx,
                                      _beta, _vy, _incy, _dependencies)
@@ -1359,6 +1399,12 @@ typename sb_handle_t::event_t inline _syr(
     sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
     container_t0 _vx, increment_t _incx, container_t1 _mA, index_t _lda,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _syr(sb_handle, _Uplo, _N, _alpha, _vx, unit_stride_t{}, _mA,
+                  _lda, _dependencies);
+    }
+  }
   // TODO: Here we can use some heuristics to select localn global, local, and
   // scratch size per device
   return _syr_impl(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mA, _lda,
@@ -1371,6 +1417,12 @@ typename sb_handle_t::event_t inline _spr(
     sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
     container_t0 _vx, increment_t _incx, container_t1 _mPA,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _spr(sb_handle, _Uplo, _N, _alpha, _vx, unit_stride_t{}, _mPA,
+                  _dependencies);
+    }
+  }
   return _spr_impl(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _mPA,
                    _dependencies);
 }
@@ -1382,6 +1434,12 @@ typename sb_handle_t::event_t inline _spr2(
     sb_handle_t& sb_handle, char _Uplo, index_t _N, element_t _alpha,
     container_t0 _vx, increment_t _incx, container_t1 _vy, increment_t _incy,
     container_t2 _mPA, const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _spr2(sb_handle, _Uplo, _N, _alpha, _vx, unit_stride_t{}, _vy,
+                   unit_stride_t{}, _mPA, _dependencies);
+    }
+  }
   return _spr2_impl<sb_handle_t, index_t, element_t, container_t0, increment_t,
                     container_t1, container_t2>(sb_handle, _Uplo, _N, _alpha,
                                                 _vx, _incx, _vy, _incy, _mPA,
@@ -1396,6 +1454,12 @@ typename sb_handle_t::event_t inline _syr2(
     container_t0 _vx, increment_t _incx, container_t1 _vy, increment_t _incy,
     container_t2 _mA, index_t _lda,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1 && _incy == 1) {
+      return _syr2(sb_handle, _Uplo, _N, _alpha, _vx, unit_stride_t{}, _vy,
+                   unit_stride_t{}, _mA, _lda, _dependencies);
+    }
+  }
   // TODO: Here we can use some heuristics to select localn global, local, and
   // scratch size per device
   return _syr2_impl(sb_handle, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy, _mA,
@@ -1408,6 +1472,12 @@ typename sb_handle_t::event_t _tbmv(
     sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
     index_t _K, container_t0 _mA, index_t _lda, container_t1 _vx,
     increment_t _incx, const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _tbmv(sb_handle, _Uplo, _trans, _Diag, _N, _K, _mA, _lda, _vx,
+                   unit_stride_t{}, _dependencies);
+    }
+  }
   INST_UPLO_TRANS_DIAG(blas::tbmv::backend::_tbmv, sb_handle, _N, _K, _mA, _lda,
                        _vx, _incx, _dependencies)
 }
@@ -1428,6 +1498,12 @@ typename sb_handle_t::event_t _tpmv(
     sb_handle_t& sb_handle, char _Uplo, char _trans, char _Diag, index_t _N,
     container_t0 _mA, container_t1 _vx, increment_t _incx,
     const typename sb_handle_t::event_t& _dependencies) {
+  if constexpr (!is_unit_stride<increment_t>::value) {
+    if (_incx == 1) {
+      return _tpmv(sb_handle, _Uplo, _trans, _Diag, _N, _mA, _vx,
+                   unit_stride_t{}, _dependencies);
+    }
+  }
   INST_UPLO_TRANS_DIAG(blas::tpmv::backend::_tpmv, sb_handle, _N, _mA, _vx,
                        _incx, _dependencies)
 }
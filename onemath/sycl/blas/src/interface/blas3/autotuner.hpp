@@ -0,0 +1,344 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_GEMM_AUTOTUNER_HPP
+#define ONEMATH_SYCL_BLAS_GEMM_AUTOTUNER_HPP
+
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <tuple>
+#include <typeinfo>
+
+#include "interface/blas3/backend/backend.hpp"
+#include "interface/gemm_launcher.h"
+#include "sb_handle/gemm_tuning_cache.h"
+
+namespace blas {
+namespace gemm {
+namespace autotuner {
+
+/*!
+ * @brief Candidate configuration of the autotuner. The template parameters
+ * are forwarded to the Gemm_Launcher of a strided, non-symmetric Gemm.
+ */
+template <int WgSize, bool DoubleBuffer, bool NbcAB, int ClSize,
+          typename TileT, int GemmMemoryType, int GemmVectorization,
+          int VectorSize>
+struct Gemm_Variant {
+  static constexpr bool uses_local_memory =
+      GemmMemoryType == static_cast<int>(gemm_memory_t::local);
+
+  /*!
+   * @brief Name of the configuration, used as value in the tuning cache.
+   */
+  static std::string get_name() {
+    std::ostringstream str{};
+    str << "wg" << WgSize << (DoubleBuffer ? "_db" : "")
+        << (NbcAB ? "_nbc" : "") << "_cl" << ClSize
+        << (uses_local_memory ? "_local" : "_no_local") << "_vec"
+        << GemmVectorization << "_vs" << VectorSize << "_"
+        << TileT::get_type_string();
+    return str.str();
+  }
+
+  template <typename sb_handle_t>
+  static bool is_supported(const sb_handle_t& sb_handle) {
+    return !uses_local_memory ||
+           (sb_handle.has_local_memory() &&
+            sb_handle.get_work_group_size() >=
+                static_cast<size_t>(TileT::wg_rows * TileT::wg_cols));
+  }
+
+  template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
+            typename container_0_t, typename container_1_t,
+            typename container_2_t, typename element_t, typename index_t>
+  static typename sb_handle_t::event_t run(
+      sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+      element_t _alpha, container_0_t _a, index_t _lda, index_t _stridea,
+      container_1_t _b, index_t _ldb, index_t _strideb, element_t _beta,
+      container_2_t _c, index_t _ldc, index_t _stridec, index_t batch_size,
+      const typename sb_handle_t::event_t& _dependencies) {
+    return blas::Gemm_Launcher<
+        container_0_t, container_1_t, container_2_t, WgSize, DoubleBuffer,
+        NbcAB, NbcAB, ClSize, TileT, _t_a, _t_b, false, false, GemmMemoryType,
+        static_cast<int>(gemm_algorithm_t::standard), GemmVectorization,
+        is_beta_zero, VectorSize,
+        static_cast<int>(
+            gemm_batch_type_t::strided)>::_select_gemm(sb_handle, _M, _N, _K,
+                                                       _alpha, _a, _lda,
+                                                       _stridea, _b, _ldb,
+                                                       _strideb, _beta, _c,
+                                                       _ldc, _stridec,
+                                                       batch_size,
+                                                       _dependencies);
+  }
+};
+
+/*!
+ * @brief Configurations timed by the autotuner, taken from the backends. Each
+ * of them is instantiated for every Gemm call site, so the list is kept
+ * short. The configuration chosen by the backend of TUNING_TARGET is always
+ * timed as well (see backend_variant_name).
+ */
+using gemm_variants_t = std::tuple<
+    Gemm_Variant<128, false, false, 64, Tile<2, 2, 2, 2>,
+                 static_cast<int>(gemm_memory_t::no_local),
+                 static_cast<int>(gemm_vectorization_t::full), 2>,
+    Gemm_Variant<128, false, false, 64, Tile<4, 4, 4, 4>,
+                 static_cast<int>(gemm_memory_t::no_local),
+                 static_cast<int>(gemm_vectorization_t::partial), 1>,
+    Gemm_Variant<128, false, false, 64, Tile<4, 4, 8, 8>,
+                 static_cast<int>(gemm_memory_t::no_local),
+                 static_cast<int>(gemm_vectorization_t::full), 1>,
+    Gemm_Variant<64, false, false, 64, Tile<8, 8, 8, 8>,
+                 static_cast<int>(gemm_memory_t::no_local),
+                 static_cast<int>(gemm_vectorization_t::partial), 1>,
+    Gemm_Variant<64, true, false, 64, Tile<4, 4, 8, 8>,
+                 static_cast<int>(gemm_memory_t::local),
+                 static_cast<int>(gemm_vectorization_t::full), 1>,
+    Gemm_Variant<64, false, false, 64, Tile<4, 8, 16, 8>,
+                 static_cast<int>(gemm_memory_t::local),
+                 static_cast<int>(gemm_vectorization_t::full), 1>,
+    Gemm_Variant<128, false, true, 128, Tile<4, 4, 16, 8>,
+                 static_cast<int>(gemm_memory_t::local),
+                 static_cast<int>(gemm_vectorization_t::full), 1>>;
+
+constexpr size_t num_variants = std::tuple_size<gemm_variants_t>::value;
+
+// Index of the configuration chosen by the backend thresholds
+constexpr size_t backend_variant = num_variants;
+
+inline std::string backend_variant_name() { return "backend"; }
+
+// Number of timed runs of each candidate, after a warm-up run
+constexpr int num_tuning_reps = 3;
+
+/*!
+ * @brief Whether the autotuner handles the Gemm. Symmetric, half, complex and
+ * mixed precision Gemms always use the backend thresholds.
+ */
+template <bool s_a, bool s_b, typename element_t, typename container_0_t>
+struct is_tunable {
+  static constexpr bool value =
+      !s_a && !s_b && is_sycl_scalar<element_t>::value &&
+      !is_half<element_t>::value &&
+      std::is_same_v<typename ValueType<container_0_t>::type, element_t>;
+};
+
+/*!
+ * @brief Calls f with a default constructed Gemm_Variant of index id.
+ */
+template <size_t I = 0, typename functor_t>
+inline auto visit_variant(size_t id, functor_t&& f) {
+  using variant_t = typename std::tuple_element<I, gemm_variants_t>::type;
+  if constexpr (I + 1 < num_variants) {
+    if (id != I) {
+      return visit_variant<I + 1>(id, std::forward<functor_t>(f));
+    }
+  }
+  return f(variant_t{});
+}
+
+inline std::string get_variant_name(size_t id) {
+  if (id == backend_variant) {
+    return backend_variant_name();
+  }
+  return visit_variant(id, [](auto variant) {
+    return decltype(variant)::get_name();
+  });
+}
+
+/*!
+ * @brief Index of the configuration called name, or -1 if it is not part of
+ * the candidates (e.g. the cache was written by another version).
+ */
+inline int find_variant(const std::string& name) {
+  for (size_t id = 0; id <= num_variants; id++) {
+    if (get_variant_name(id) == name) {
+      return static_cast<int>(id);
+    }
+  }
+  return -1;
+}
+
+// Smallest power of two greater than or equal to size
+template <typename index_t>
+inline index_t size_bucket(index_t size) {
+  index_t bucket = 1;
+  while (bucket < size) {
+    bucket *= 2;
+  }
+  return bucket;
+}
+
+template <typename value_t>
+inline std::string get_type_name() {
+  if constexpr (std::is_same<value_t, float>::value) {
+    return "float";
+  } else if constexpr (std::is_same<value_t, double>::value) {
+    return "double";
+  } else {
+    return typeid(value_t).name();
+  }
+}
+
+/*!
+ * @brief Key of a problem in the tuning cache. The sizes are rounded up to the
+ * next power of two, so one entry covers the problems of similar shapes.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename value_t,
+          typename index_t>
+inline std::string make_key(const sycl::queue& q, index_t _M, index_t _N,
+                            index_t _K, index_t batch_size) {
+  std::ostringstream str{};
+  str << Gemm_Tuning_Cache::device_key(q) << "|" << get_type_name<value_t>()
+      << "|" << (_t_a ? 't' : 'n') << (_t_b ? 't' : 'n') << "|"
+      << size_bucket(_M) << "x" << size_bucket(_N) << "x" << size_bucket(_K)
+      << "|batch" << size_bucket(batch_size)
+      << (is_beta_zero ? "|beta_zero" : "");
+  return str.str();
+}
+
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _run_variant(
+    size_t id, sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t _a, index_t _lda, index_t _stridea,
+    container_1_t _b, index_t _ldb, index_t _strideb, element_t _beta,
+    container_2_t _c, index_t _ldc, index_t _stridec, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (id == backend_variant) {
+    return blas::gemm::backend::_gemm<_t_a, _t_b, false, false, is_beta_zero>(
+        sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b, _ldb, _strideb,
+        _beta, _c, _ldc, _stridec, batch_size, gemm_batch_type_t::strided,
+        _dependencies);
+  }
+  return visit_variant(id, [&](auto variant) {
+    return decltype(variant)::template run<_t_a, _t_b, is_beta_zero>(
+        sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b, _ldb, _strideb,
+        _beta, _c, _ldc, _stridec, batch_size, _dependencies);
+  });
+}
+
+/*!
+ * @brief Times every supported candidate on the problem and returns the index
+ * of the fastest one. The candidates write to a temporary copy of C so that
+ * the output is only computed once, by the selected configuration.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+size_t _tune(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+             element_t _alpha, container_0_t _a, index_t _lda,
+             index_t _stridea, container_1_t _b, index_t _ldb,
+             index_t _strideb, element_t _beta, index_t _ldc,
+             index_t _stridec, index_t batch_size,
+             const typename sb_handle_t::event_t& _dependencies) {
+  using value_t = typename ValueType<container_2_t>::type;
+  constexpr auto alloc = std::is_pointer<container_2_t>::value
+                            ? helper::AllocType::usm
+                            : helper::AllocType::buffer;
+  const size_t c_size =
+      static_cast<size_t>(_ldc) * _N + (batch_size - 1) * _stridec;
+  container_2_t scratch =
+      sb_handle.template acquire_temp_mem<alloc, value_t>(c_size);
+  sb_handle.wait(_dependencies);
+
+  size_t best_id = backend_variant;
+  double best_time = std::numeric_limits<double>::max();
+  for (size_t id = 0; id <= num_variants; id++) {
+    const bool supported =
+        id == backend_variant ||
+        visit_variant(id, [&](auto variant) {
+          return decltype(variant)::is_supported(sb_handle);
+        });
+    if (!supported) {
+      continue;
+    }
+    try {
+      // The warm-up run also triggers the JIT compilation of the kernel
+      sb_handle.wait(_run_variant<_t_a, _t_b, is_beta_zero>(
+          id, sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b, _ldb,
+          _strideb, _beta, scratch, _ldc, _stridec, batch_size, {}));
+      const auto start = std::chrono::steady_clock::now();
+      for (int rep = 0; rep < num_tuning_reps; rep++) {
+        sb_handle.wait(_run_variant<_t_a, _t_b, is_beta_zero>(
+            id, sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b, _ldb,
+            _strideb, _beta, scratch, _ldc, _stridec, batch_size, {}));
+      }
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      if (elapsed.count() < best_time) {
+        best_time = elapsed.count();
+        best_id = id;
+      }
+    } catch (const sycl::exception&) {
+      // The configuration cannot run on this device (e.g. not enough local
+      // memory), it is not a candidate
+    }
+  }
+  sb_handle.release_temp_mem({}, scratch);
+  return best_id;
+}
+
+/*!
+ * @brief Runs a strided, non-symmetric Gemm with the configuration stored in
+ * the tuning cache of the SB_Handle. On a cache miss the configuration is
+ * tuned and stored if the handle is in tuning mode, otherwise the backend
+ * thresholds are used.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t _a, index_t _lda, index_t _stridea,
+    container_1_t _b, index_t _ldb, index_t _strideb, element_t _beta,
+    container_2_t _c, index_t _ldc, index_t _stridec, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  auto cache = sb_handle.get_gemm_tuning_cache();
+  using value_t = typename ValueType<container_2_t>::type;
+  const std::string key = make_key<_t_a, _t_b, is_beta_zero, value_t>(
+      sb_handle.get_queue(), _M, _N, _K, batch_size);
+  std::string name;
+  int id = cache->lookup(key, name) ? find_variant(name) : -1;
+  if (id < 0 && sb_handle.get_gemm_tuning_mode() == gemm_tuning_mode_t::tune) {
+    id = static_cast<int>(_tune<_t_a, _t_b, is_beta_zero, sb_handle_t,
+                                container_0_t, container_1_t, container_2_t>(
+        sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b, _ldb, _strideb,
+        _beta, _ldc, _stridec, batch_size, _dependencies));
+    cache->store(key, get_variant_name(id));
+  }
+  return _run_variant<_t_a, _t_b, is_beta_zero>(
+      id < 0 ? backend_variant : static_cast<size_t>(id), sb_handle, _M, _N,
+      _K, _alpha, _a, _lda, _stridea, _b, _ldb, _strideb, _beta, _c, _ldc,
+      _stridec, batch_size, _dependencies);
+}
+
+}  // namespace autotuner
+}  // namespace gemm
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_GEMM_AUTOTUNER_HPP
@@ -46,12 +46,16 @@ _gemm(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
     return _dependencies;
   } else {
     if (batch_type == gemm_batch_type_t::interleaved) {
+      // bfloat16 can't be held in a sycl::vec, its batches aren't vectorized
+      constexpr int vector_size =
+          is_bfloat16<typename ValueType<container_0_t>::type>::value ? 1 : 4;
       return blas::Gemm_Launcher<
           container_0_t, container_1_t, container_2_t, 64, false, false, false,
           64, Tile<2, 2, 4, 4, 1, 1, 1, 1, 4, 4>, _t_a, _t_b, s_a, s_b,
           static_cast<int>(gemm_memory_t::no_local),
           static_cast<int>(gemm_algorithm_t::standard),
-          static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+          static_cast<int>(gemm_vectorization_t::full), is_beta_zero,
+          vector_size,
           static_cast<int>(
               gemm_batch_type_t::interleaved)>::_select_gemm(sb_handle, _M, _N,
                                                              _K, _alpha, _a,
@@ -78,7 +82,48 @@ _gemm(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
                                                        batch_size,
                                                        _dependencies);
 #else
-    if (_M <= 128 && _N <= 128 && _K <= 256 && !s_a && !s_b) {
+    if (!s_a && !s_b &&
+        use_stream_k(static_cast<index_t>(sb_handle.get_num_compute_units()),
+                     _M, _N, _K, batch_size)) {
+      // Stream-K spreads the 32x32 tiles and their blocks of K evenly over
+      // the compute units
+      return blas::Gemm_Launcher<
+          container_0_t, container_1_t, container_2_t, 64, false, false, false,
+          64, Tile<4, 4, 8, 8>, _t_a, _t_b, s_a, s_b,
+          static_cast<int>(gemm_memory_t::local),
+          static_cast<int>(gemm_algorithm_t::stream_k),
+          static_cast<int>(gemm_vectorization_t::none), is_beta_zero, 1,
+          static_cast<int>(
+              gemm_batch_type_t::strided)>::_select_gemm(sb_handle, _M, _N, _K,
+                                                         _alpha, _a, _lda,
+                                                         _stridea, _b, _ldb,
+                                                         _strideb, _beta, _c,
+                                                         _ldc, _stridec,
+                                                         batch_size,
+                                                         _dependencies);
+    } else if (!s_a && !s_b && sb_handle.get_queue().get_device().is_cpu()) {
+      // The micro-tile of C is 6 columns of a 512-bit vector, which are two
+      // registers on AVX2. A KC deep micro-panel of B fits in L1, the MC x KC
+      // panel of A in L2.
+      using cpu_tile_t =
+          typename std::conditional<std::is_same<element_t, double>::value,
+                                    Cpu_Tile<8, 6, 96, 128, 192>,
+                                    Cpu_Tile<16, 6, 96, 256, 192>>::type;
+      return blas::Gemm_Launcher<
+          container_0_t, container_1_t, container_2_t, 1, false, false, false,
+          64, cpu_tile_t, _t_a, _t_b, s_a, s_b,
+          static_cast<int>(gemm_memory_t::no_local),
+          static_cast<int>(gemm_algorithm_t::cpu),
+          static_cast<int>(gemm_vectorization_t::none), is_beta_zero, 1,
+          static_cast<int>(
+              gemm_batch_type_t::strided)>::_select_gemm(sb_handle, _M, _N, _K,
+                                                         _alpha, _a, _lda,
+                                                         _stridea, _b, _ldb,
+                                                         _strideb, _beta, _c,
+                                                         _ldc, _stridec,
+                                                         batch_size,
+                                                         _dependencies);
+    } else if (_M <= 128 && _N <= 128 && _K <= 256 && !s_a && !s_b) {
       return blas::Gemm_Launcher<
           container_0_t, container_1_t, container_2_t, 128, false, false, false,
           64, Tile<2, 2, 2, 2>, _t_a, _t_b, s_a, s_b,
@@ -243,6 +288,39 @@ _gemm(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
 }
 #endif
 
+#ifdef SB_ENABLE_USM
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_grouped(
+    sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+    const index_t* _M, const index_t* _N, const index_t* _K,
+    const element_t* _alpha, const container_0_t* _a, const index_t* _lda,
+    const container_1_t* _b, const index_t* _ldb, const element_t* _beta,
+    const container_2_t* _c, const index_t* _ldc, index_t group_count,
+    const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  // Work groups of 64 items, which also suit the CPU devices
+  return blas::Gemm_Grouped_Launcher<64, Tile<4, 4, 8, 8>>::_select_gemm(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, _a, _lda, _b, _ldb,
+      _beta, _c, _ldc, group_count, group_size, _dependencies);
+}
+#endif  // SB_ENABLE_USM
+
+/*!
+ * @brief Launcher of _gemm_pack and _gemm_compute, its tile sets the layout
+ * of the packed matrices.
+ */
+// Work groups of 64 items, which also suit the CPU devices
+using gemm_packed_launcher_t =
+    blas::Gemm_Packed_Launcher<64, Tile<4, 4, 8, 8>>;
+
+/*!
+ * @brief Launcher of the rank-k updates, whose square tiles only cover the
+ * triangle of C.
+ */
+using gemm_triangular_launcher_t =
+    blas::Gemm_Triangular_Launcher<64, Tile<4, 4, 8, 8>>;
+
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
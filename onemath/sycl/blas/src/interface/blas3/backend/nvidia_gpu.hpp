@@ -46,12 +46,16 @@ _gemm(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
     return _dependencies;
   } else {
     if (batch_type == gemm_batch_type_t::interleaved) {
+      // bfloat16 can't be held in a sycl::vec, its batches aren't vectorized
+      constexpr int vector_size =
+          is_bfloat16<typename ValueType<container_0_t>::type>::value ? 1 : 4;
       return blas::Gemm_Launcher<
           container_0_t, container_1_t, container_2_t, 64, false, false, false,
           64, Tile<2, 2, 4, 4, 1, 1, 1, 1, 4, 4, 1, 1, 1, float, float>, _t_a,
           _t_b, s_a, s_b, static_cast<int>(gemm_memory_t::no_local),
           static_cast<int>(gemm_algorithm_t::standard),
-          static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+          static_cast<int>(gemm_vectorization_t::full), is_beta_zero,
+          vector_size,
           static_cast<int>(
               gemm_batch_type_t::interleaved)>::_select_gemm(sb_handle, _M, _N,
                                                              _K, _alpha, _a,
@@ -257,6 +261,37 @@ _gemm(sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
 }
 #endif
 
+#ifdef SB_ENABLE_USM
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_grouped(
+    sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+    const index_t* _M, const index_t* _N, const index_t* _K,
+    const element_t* _alpha, const container_0_t* _a, const index_t* _lda,
+    const container_1_t* _b, const index_t* _ldb, const element_t* _beta,
+    const container_2_t* _c, const index_t* _ldc, index_t group_count,
+    const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return blas::Gemm_Grouped_Launcher<128, Tile<4, 4, 16, 16>>::_select_gemm(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, _a, _lda, _b, _ldb,
+      _beta, _c, _ldc, group_count, group_size, _dependencies);
+}
+#endif  // SB_ENABLE_USM
+
+/*!
+ * @brief Launcher of _gemm_pack and _gemm_compute, its tile sets the layout
+ * of the packed matrices.
+ */
+using gemm_packed_launcher_t =
+    blas::Gemm_Packed_Launcher<128, Tile<4, 4, 16, 16>>;
+
+/*!
+ * @brief Launcher of the rank-k updates, whose square tiles only cover the
+ * triangle of C.
+ */
+using gemm_triangular_launcher_t =
+    blas::Gemm_Triangular_Launcher<128, Tile<4, 4, 16, 16>>;
+
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
@@ -27,6 +27,8 @@
 #include "interface/gemm_interface.hpp"
 #include "interface/gemm_launcher.hpp"
 #include "interface/symm_interface.hpp"
+#include "interface/syrk_interface.hpp"
+#include "interface/trmm_interface.hpp"
 #include "interface/trsm_interface.hpp"
 
 #endif  // ONEMATH_SYCL_BLAS_BLAS3_INTERFACE_HPP
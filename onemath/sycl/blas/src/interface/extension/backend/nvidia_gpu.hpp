@@ -23,6 +23,7 @@
 #ifndef ONEMATH_SYCL_BLAS_TRANSPOSE_NVIDIA_GPU_BACKEND_HPP
 #define ONEMATH_SYCL_BLAS_TRANSPOSE_NVIDIA_GPU_BACKEND_HPP
 #include "interface/extension_interface.h"
+#include "interface/gemm_launcher.h"
 
 namespace blas {
 namespace transpose {
@@ -169,6 +170,79 @@ typename sb_handle_t::event_t _axpy_batch(
 }
 }  // namespace backend
 }  // namespace axpy_batch
+
+namespace reduction_batch {
+namespace backend {
+template <batch_reduction_t op, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  // Each work-group computes a whole batch entry, smaller work-groups are
+  // used for short vectors to keep all the work-items busy
+  if (_N <= 1024) {
+    return blas::internal::_reduction_batch_impl<op, 128>(
+        sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy, _stride_y, _rs,
+        _batch_size, _dependencies, _batch_size);
+  } else {
+    return blas::internal::_reduction_batch_impl<op, 256>(
+        sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy, _stride_y, _rs,
+        _batch_size, _dependencies, _batch_size);
+  }
+}
+}  // namespace backend
+}  // namespace reduction_batch
+
+namespace gemm_epilogue {
+namespace backend {
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename epilogue_t>
+typename sb_handle_t::event_t _gemm_epilogue(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t _a, index_t _lda, index_t _stridea,
+    container_1_t _b, index_t _ldb, index_t _strideb, element_t _beta,
+    container_2_t _c, index_t _ldc, index_t _stridec, index_t batch_size,
+    epilogue_t epilogue, const typename sb_handle_t::event_t& _dependencies) {
+  // Same configurations as the strided gemm, the epilogue only changes the
+  // store of the kernels
+  if (_M <= 256 && _N <= 256) {
+    return blas::Gemm_Launcher<
+        container_0_t, container_1_t, container_2_t, 128, false, false, false,
+        64, Tile<2, 2, 16, 8>, _t_a, _t_b, false, false,
+        static_cast<int>(gemm_memory_t::local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero,
+        1>::_select_gemm(sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b,
+                         _ldb, _strideb, _beta, _c, _ldc, _stridec, batch_size,
+                         _dependencies, epilogue);
+  } else if (_M <= 1024 && _N <= 1024) {
+    return blas::Gemm_Launcher<
+        container_0_t, container_1_t, container_2_t, 128, false, false, false,
+        64, Tile<4, 4, 16, 8>, _t_a, _t_b, false, false,
+        static_cast<int>(gemm_memory_t::local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero,
+        1>::_select_gemm(sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b,
+                         _ldb, _strideb, _beta, _c, _ldc, _stridec, batch_size,
+                         _dependencies, epilogue);
+  } else {
+    return blas::Gemm_Launcher<
+        container_0_t, container_1_t, container_2_t, 128, false, false, false,
+        64, Tile<8, 8, 16, 16>, _t_a, _t_b, false, false,
+        static_cast<int>(gemm_memory_t::local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero,
+        1>::_select_gemm(sb_handle, _M, _N, _K, _alpha, _a, _lda, _stridea, _b,
+                         _ldb, _strideb, _beta, _c, _ldc, _stridec, batch_size,
+                         _dependencies, epilogue);
+  }
+}
+}  // namespace backend
+}  // namespace gemm_epilogue
 }  // namespace blas
 
 #endif
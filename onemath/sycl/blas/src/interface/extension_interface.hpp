@@ -27,15 +27,18 @@
 #include "blas_meta.h"
 #include "interface/extension/backend/backend.hpp"
 #include "interface/extension_interface.h"
+#include "interface/gemm_launcher.h"
 #include "operations/blas1_trees.h"
 #include "operations/blas_operators.hpp"
 #include "operations/extension/axpy_batch.h"
 #include "operations/extension/matcopy_batch.h"
 #include "operations/extension/reduction.h"
+#include "operations/extension/reduction_batch.h"
 #include "operations/extension/transpose.h"
 #include "helper.h"
 #include "sb_handle/handle.h"
 #include "views/view.h"
+#include <limits>
 
 namespace blas {
 namespace internal {
@@ -640,6 +643,268 @@ typename sb_handle_t::event_t _axpy_batch_impl(
   }
 }
 
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _dot_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return blas::reduction_batch::backend::_reduction_batch<
+      batch_reduction_t::dot>(sb_handle, _N, _vx, _incx, _stride_x, _vy, _incy,
+                              _stride_y, _rs, _batch_size, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _asum_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return blas::reduction_batch::backend::_reduction_batch<
+      batch_reduction_t::asum>(sb_handle, _N, _vx, _incx, _stride_x, _vx,
+                               _incx, _stride_x, _rs, _batch_size,
+                               _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename index_t>
+typename sb_handle_t::event_t _nrm2_batch(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return blas::reduction_batch::backend::_reduction_batch<
+      batch_reduction_t::nrm2>(sb_handle, _N, _vx, _incx, _stride_x, _vx,
+                               _incx, _stride_x, _rs, _batch_size,
+                               _dependencies);
+}
+
+template <batch_reduction_t op, int localSize, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename sb_handle_t::event_t _reduction_batch_impl(
+    sb_handle_t& sb_handle, index_t _N, container_0_t _vx, index_t _incx,
+    index_t _stride_x, container_1_t _vy, index_t _incy, index_t _stride_y,
+    container_2_t _rs, index_t _batch_size,
+    const typename sb_handle_t::event_t& _dependencies, index_t num_wg) {
+  if (_N < 0 || _batch_size < 0) {
+    throw std::invalid_argument("invalid _N and/or _batch_size");
+  } else if (_incx == 0 || _incy == 0) {
+    throw std::invalid_argument("invalid _incx and/or _incy");
+  }
+  if (!_batch_size) return _dependencies;
+  if (_stride_x < 0 || _stride_y < 0) {
+    throw std::invalid_argument("invalid _stride_x and/or _stride_y");
+  }
+  // A vector spans (1 - n) * inc elements, from which the kernel starts with
+  // a negative increment. The vectors are only read, so they may overlap
+  const index_t extent_x = _N ? (_N - 1) * std::abs(_incx) + 1 : 0;
+  const index_t extent_y = _N ? (_N - 1) * std::abs(_incy) + 1 : 0;
+  // if a stride is zero the same vector is used for the whole batch
+  const index_t overall_vx_size = _stride_x * (_batch_size - 1) + extent_x;
+  const index_t overall_vy_size = _stride_y * (_batch_size - 1) + extent_y;
+  typename VectorViewType<container_0_t, index_t, index_t>::type vx =
+      make_vector_view(_vx, static_cast<index_t>(1), overall_vx_size);
+  typename VectorViewType<container_1_t, index_t, index_t>::type vy =
+      make_vector_view(_vy, static_cast<index_t>(1), overall_vy_size);
+  auto rs = make_vector_view(_rs, static_cast<index_t>(1), _batch_size);
+  auto op_batch = make_reduction_batch<op, localSize>(
+      rs, vx, vy, _N, _incx, _stride_x, _incy, _stride_y, _batch_size);
+  // One value per sub-group is stored in local memory
+  return sb_handle.execute(op_batch, static_cast<index_t>(localSize),
+                           num_wg * static_cast<index_t>(localSize),
+                           static_cast<index_t>(localSize), _dependencies);
+}
+
+/*!
+ * @brief Makes the view of the bias of a Gemm_Epilogue, or the placeholder
+ * Gemm_Epilogue_Identity if there is no bias.
+ */
+template <gemm_bias_t bias, typename container_t, typename index_t>
+inline auto make_gemm_epilogue_bias(container_t _bias, index_t _size) {
+  if constexpr (bias == gemm_bias_t::none) {
+    return Gemm_Epilogue_Identity{};
+  } else {
+    return make_vector_view(_bias, index_t{1}, _size);
+  }
+}
+
+/*!
+ * @brief Makes the view of the residual of a Gemm_Epilogue, or the
+ * placeholder Gemm_Epilogue_Identity if there is no residual.
+ */
+template <bool residual, typename container_t, typename index_t>
+inline auto make_gemm_epilogue_residual(container_t _residual, index_t _M,
+                                        index_t _N, index_t _ldr) {
+  if constexpr (!residual) {
+    return Gemm_Epilogue_Identity{};
+  } else {
+    return make_matrix_view<col_major>(_residual, _M, _N, _ldr);
+  }
+}
+
+template <bool _t_a, bool _t_b, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t, typename epilogue_t>
+typename sb_handle_t::event_t _gemm_epilogue_is_beta_zero(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, index_t _stridea,
+    container_1_t b_, index_t _ldb, index_t _strideb, element_t _beta,
+    container_2_t _C, index_t _ldc, index_t _stridec, index_t batch_size,
+    epilogue_t epilogue, const typename sb_handle_t::event_t& _dependencies) {
+  // The optimized kernels store beta / alpha, which is not exact for integers
+  // unless alpha divides beta
+  bool inexact_beta = false;
+  if constexpr (std::is_integral_v<element_t>) {
+    inexact_beta = _alpha != element_t{0} && _beta % _alpha != element_t{0};
+  }
+  if (_alpha == element_t{0} || inexact_beta) {
+    // The epilogue still has to be applied to beta * C, the naive kernel stores
+    // beta as is
+    return blas::Gemm_Launcher<
+        container_0_t, container_1_t, container_2_t, 64, false, false, false,
+        64, Tile<8, 8, 8, 8>, _t_a, _t_b, false, false,
+        static_cast<int>(gemm_memory_t::no_local),
+        static_cast<int>(gemm_algorithm_t::naive),
+        static_cast<int>(gemm_vectorization_t::none), false,
+        1>::_select_gemm(sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_,
+                         _ldb, _strideb, _beta, _C, _ldc, _stridec, batch_size,
+                         _dependencies, epilogue);
+  }
+  if (_beta == element_t{0}) {
+    return blas::gemm_epilogue::backend::_gemm_epilogue<_t_a, _t_b, true>(
+        sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
+        _beta, _C, _ldc, _stridec, batch_size, epilogue, _dependencies);
+  } else {
+    return blas::gemm_epilogue::backend::_gemm_epilogue<_t_a, _t_b, false>(
+        sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
+        _beta, _C, _ldc, _stridec, batch_size, epilogue, _dependencies);
+  }
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename epilogue_t>
+typename sb_handle_t::event_t _gemm_epilogue_trans(
+    sb_handle_t& sb_handle, bool _TrA, bool _TrB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    index_t batch_size, epilogue_t epilogue,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (_TrA && _TrB) {
+    return _gemm_epilogue_is_beta_zero<true, true>(
+        sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
+        _beta, _C, _ldc, _stridec, batch_size, epilogue, _dependencies);
+  } else if (!_TrA && _TrB) {
+    return _gemm_epilogue_is_beta_zero<false, true>(
+        sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
+        _beta, _C, _ldc, _stridec, batch_size, epilogue, _dependencies);
+  } else if (_TrA && !_TrB) {
+    return _gemm_epilogue_is_beta_zero<true, false>(
+        sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
+        _beta, _C, _ldc, _stridec, batch_size, epilogue, _dependencies);
+  } else {
+    return _gemm_epilogue_is_beta_zero<false, false>(
+        sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
+        _beta, _C, _ldc, _stridec, batch_size, epilogue, _dependencies);
+  }
+}
+
+template <gemm_bias_t bias, gemm_activation_t activation, bool residual,
+          typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_epilogue(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    container_3_t _bias, index_t _stride_bias, container_4_t _residual,
+    index_t _ldr, index_t _stride_residual, element_t _scale,
+    element_t _clamp_min, element_t _clamp_max, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  static_assert(is_sycl_scalar<element_t>::value,
+                "The gemm epilogue only supports real data types");
+  if (!_M || !_N || !batch_size) return _dependencies;
+
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("Invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("Invalid _TransB");
+  }
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+
+  if (batch_size > index_t(1)) {
+    if (_stridec < _ldc * _N || _stridea < 0 || _strideb < 0) {
+      throw std::invalid_argument("Invalid stridea, strideb and/or stridec");
+    } else if (_stride_bias < 0 ||
+               (residual && _stride_residual < _ldr * _N)) {
+      throw std::invalid_argument(
+          "Invalid stride_bias and/or stride_residual");
+    }
+  }
+  if (residual && _ldr < _M) {
+    throw std::invalid_argument("Invalid ldr");
+  }
+
+  const index_t bias_size = (bias == gemm_bias_t::row ? _M : _N) +
+                            _stride_bias * (batch_size - 1);
+  auto epilogue = make_gemm_epilogue<bias, activation>(
+      make_gemm_epilogue_bias<bias>(_bias, bias_size), _stride_bias,
+      make_gemm_epilogue_residual<residual>(_residual, _M, _N, _ldr),
+      _stride_residual, _scale, _clamp_min, _clamp_max);
+
+  return _gemm_epilogue_trans(sb_handle, _TrA, _TrB, _M, _N, _K, _alpha, a_,
+                              _lda, _stridea, b_, _ldb, _strideb, _beta, _C,
+                              _ldc, _stridec, batch_size, epilogue,
+                              _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename scale_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_requantize(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    index_t _stridea, container_1_t b_, index_t _ldb, index_t _strideb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t _stridec,
+    scale_t _scale, element_t _zero_point, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using out_t = typename ValueType<container_2_t>::type;
+  static_assert(std::is_integral_v<element_t> && std::is_integral_v<out_t>,
+                "The requantization only supports integer gemm");
+  static_assert(std::is_floating_point_v<scale_t>,
+                "The requantization scale must be a floating point type");
+  if (!_M || !_N || !batch_size) return _dependencies;
+
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("Invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("Invalid _TransB");
+  }
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+
+  if (batch_size > index_t(1) &&
+      (_stridec < _ldc * _N || _stridea < 0 || _strideb < 0)) {
+    throw std::invalid_argument("Invalid stridea, strideb and/or stridec");
+  }
+  Gemm_Epilogue_Requantize<element_t, scale_t, index_t> epilogue(
+      _scale, _zero_point, element_t{std::numeric_limits<out_t>::min()},
+      element_t{std::numeric_limits<out_t>::max()});
+
+  return _gemm_epilogue_trans(sb_handle, _TrA, _TrB, _M, _N, _K, _alpha, a_,
+                              _lda, _stridea, b_, _ldb, _strideb, _beta, _C,
+                              _ldc, _stridec, batch_size, epilogue,
+                              _dependencies);
+}
+
 }  // namespace internal
 }  // namespace blas
 
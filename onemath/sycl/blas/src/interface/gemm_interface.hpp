@@ -26,6 +26,9 @@
 #include "blas_meta.h"
 #include "interface/blas1_interface.h"
 #include "interface/blas3/backend/backend.hpp"
+#ifdef BLAS_ENABLE_GEMM_AUTOTUNER
+#include "interface/blas3/autotuner.hpp"
+#endif
 #include "interface/blas3_interface.h"
 #include "operations/blas3_trees.h"
 #include "helper.h"
@@ -73,6 +76,17 @@ typename sb_handle_t::event_t _gemm_platform_specific(
     container_2_t _C, index_t _ldc, index_t _stridec, index_t batch_size,
     gemm_batch_type_t batch_type,
     const typename sb_handle_t::event_t& _dependencies) {
+#ifdef BLAS_ENABLE_GEMM_AUTOTUNER
+  if constexpr (gemm::autotuner::is_tunable<s_a, s_b, element_t,
+                                            container_0_t>::value) {
+    if (batch_type == gemm_batch_type_t::strided &&
+        sb_handle.get_gemm_tuning_mode() != gemm_tuning_mode_t::disabled) {
+      return blas::gemm::autotuner::_gemm<_t_a, _t_b, is_beta_zero>(
+          sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb,
+          _strideb, _beta, _C, _ldc, _stridec, batch_size, _dependencies);
+    }
+  }
+#endif
   return blas::gemm::backend::_gemm<_t_a, _t_b, s_a, s_b, is_beta_zero>(
       sb_handle, _M, _N, _K, _alpha, a_, _lda, _stridea, b_, _ldb, _strideb,
       _beta, _C, _ldc, _stridec, batch_size, batch_type, _dependencies);
@@ -98,6 +112,42 @@ typename sb_handle_t::event_t _gemm_is_beta_zero(
                              batch_size, batch_type, _dependencies);
 }
 
+/*!
+ * @brief Scales the batch_size matrices C by beta.
+ */
+template <typename sb_handle_t, typename container_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_scale_c(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, element_t _beta,
+    container_t _C, index_t _ldc, index_t _stridec, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  index_t size_c = _ldc * _N;
+  if (size_c == _stridec) {
+    if (_ldc == _M) {
+      // When LDC is M, we can scale the full batched-matrices at once as a
+      // single vector.
+      return ::blas::_scal(sb_handle, size_c * batch_size, _beta, _C,
+                           index_t{1}, _dependencies);
+    } else {
+      // When stride matches matrix size, the _ldc is conserved between
+      // matrices, we can thus scale the full batched-matrices at one as a
+      // single matrix.
+      return _scal_matrix(sb_handle, _M, _N * batch_size, _beta, _C, _ldc,
+                          index_t{1}, _dependencies);
+    }
+
+  } else {
+    typename sb_handle_t::event_t events;
+    // Generic case needs to be serialized across batch matrices.
+    for (index_t b = 0; b < batch_size; b++) {
+      auto ev = _scal_matrix(sb_handle, _M, _N, _beta, _C + b * _stridec, _ldc,
+                             index_t{1}, _dependencies);
+      append_vector(events, ev);
+    }
+    return events;
+  }
+}
+
 template <bool symm_A, bool symm_B, typename sb_handle_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -109,32 +159,9 @@ typename sb_handle_t::event_t _gemm_backend(
     index_t batch_size, gemm_batch_type_t batch_type,
     const typename sb_handle_t::event_t& _dependencies) {
   if (_alpha == element_t{0}) {
-    index_t size_c = _ldc * _N;
     // When alpha = 0, GEMM is equivalent to {batch_size Times C = beta * C}.
-    if (size_c == _stridec) {
-      if (_ldc == _M) {
-        // When LDC is M, we can scale the full batched-matrices at once as a
-        // single vector.
-        return ::blas::_scal(sb_handle, size_c * batch_size, _beta, _C,
-                             index_t{1}, _dependencies);
-      } else {
-        // When stride matches matrix size, the _ldc is conserved between
-        // matrices, we can thus scale the full batched-matrices at one as a
-        // single matrix.
-        return _scal_matrix(sb_handle, _M, _N * batch_size, _beta, _C, _ldc,
-                            index_t{1}, _dependencies);
-      }
-
-    } else {
-      typename sb_handle_t::event_t events;
-      // Generic case needs to be serialized across batch matrices.
-      for (index_t b = 0; b < batch_size; b++) {
-        auto ev = _scal_matrix(sb_handle, _M, _N, _beta, _C + b * _stridec,
-                               _ldc, index_t{1}, _dependencies);
-        append_vector(events, ev);
-      }
-      return events;
-    }
+    return _gemm_scale_c(sb_handle, _M, _N, _beta, _C, _ldc, _stridec,
+                         batch_size, _dependencies);
   }
 
   _TransA = tolower(_TransA);
@@ -146,6 +173,20 @@ typename sb_handle_t::event_t _gemm_backend(
     throw std::invalid_argument("invalid _TransB");
   }
 
+  // The kernels accumulate beta / alpha * C before scaling by alpha, which
+  // is only exact for integers when alpha divides beta. Otherwise C is scaled
+  // by beta first, and the kernels add it with beta = alpha.
+  if constexpr (std::is_integral_v<element_t>) {
+    if (_beta % _alpha != element_t{0}) {
+      auto scaled = _gemm_scale_c(sb_handle, _M, _N, _beta, _C, _ldc, _stridec,
+                                  batch_size, _dependencies);
+      return _gemm_backend<symm_A, symm_B>(
+          sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, _stridea,
+          b_, _ldb, _strideb, _alpha, _C, _ldc, _stridec, batch_size,
+          batch_type, scaled);
+    }
+  }
+
   bool _TrA = _TransA != 'n';
   bool _TrB = _TransB != 'n';
 
@@ -238,6 +279,308 @@ typename sb_handle_t::event_t _gemm_strided_batched(
       gemm_batch_type_t::strided, _dependencies);
 }
 
+template <typename value_t, typename index_t>
+index_t _gemm_pack_get_size(gemm_pack_matrix_t matrix, index_t _M, index_t _N,
+                            index_t _K) {
+  if (_M < 0 || _N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid _M, _N and/or _K");
+  }
+  return blas::gemm::backend::gemm_packed_launcher_t::template get_packed_size<
+      value_t>(matrix, _M, _N, _K);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_pack(
+    sb_handle_t& sb_handle, gemm_pack_matrix_t matrix, char _Trans, index_t _M,
+    index_t _N, index_t _K, element_t _alpha, container_0_t src_, index_t _ld,
+    container_1_t packed_,
+    const typename sb_handle_t::event_t& _dependencies) {
+  static_assert(is_sycl_scalar<element_t>::value,
+                "The packed gemm only supports real data types");
+  using launcher_t = blas::gemm::backend::gemm_packed_launcher_t;
+  _Trans = tolower(_Trans);
+  if (_Trans != 'n' && _Trans != 't' && _Trans != 'c') {
+    throw std::invalid_argument("invalid _Trans");
+  } else if (_M < 0 || _N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid _M, _N and/or _K");
+  }
+  const bool pack_b = matrix == gemm_pack_matrix_t::b;
+  // Rows of the stored matrix, op(A) being m x k and op(B) k x n
+  const index_t rows =
+      pack_b ? (_Trans != 'n' ? _N : _K) : (_Trans != 'n' ? _K : _M);
+  if (_ld < std::max<index_t>(1, rows)) {
+    throw std::invalid_argument("invalid _ld");
+  }
+  if ((pack_b ? _N : _M) == 0) {
+    return _dependencies;
+  }
+  return _Trans != 'n'
+             ? launcher_t::template _pack<true>(sb_handle, matrix, _M, _N, _K,
+                                                _alpha, src_, _ld, packed_,
+                                                _dependencies)
+             : launcher_t::template _pack<false>(sb_handle, matrix, _M, _N, _K,
+                                                 _alpha, src_, _ld, packed_,
+                                                 _dependencies);
+}
+
+template <bool TransA, bool TransB, bool PackedA, bool PackedB,
+          typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemm_compute_is_beta_zero(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using launcher_t = blas::gemm::backend::gemm_packed_launcher_t;
+  return isZero(_beta)
+             ? launcher_t::template _select_gemm<TransA, TransB, PackedA,
+                                                 PackedB, true>(
+                   sb_handle, _M, _N, _K, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                   _dependencies)
+             : launcher_t::template _select_gemm<TransA, TransB, PackedA,
+                                                 PackedB, false>(
+                   sb_handle, _M, _N, _K, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                   _dependencies);
+}
+
+template <bool TransA, bool PackedA, typename sb_handle_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_compute_trans_b(
+    sb_handle_t& sb_handle, char _TransB, index_t _M, index_t _N, index_t _K,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  // The gemms without packed operand are computed by _gemm, so B is packed
+  // when A is not
+  if (!PackedA || _TransB == 'p') {
+    return _gemm_compute_is_beta_zero<TransA, false, PackedA, true>(
+        sb_handle, _M, _N, _K, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _dependencies);
+  }
+  return _TransB != 'n'
+             ? _gemm_compute_is_beta_zero<false, true, true, false>(
+                   sb_handle, _M, _N, _K, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                   _dependencies)
+             : _gemm_compute_is_beta_zero<false, false, true, false>(
+                   sb_handle, _M, _N, _K, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                   _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_compute(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  static_assert(is_sycl_scalar<element_t>::value,
+                "The packed gemm only supports real data types");
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c' && _TransA != 'p') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c' &&
+             _TransB != 'p') {
+    throw std::invalid_argument("invalid _TransB");
+  } else if (_M < 0 || _N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid _M, _N and/or _K");
+  } else if ((_TransA != 'p' &&
+              _lda < std::max<index_t>(1, _TransA != 'n' ? _K : _M)) ||
+             (_TransB != 'p' &&
+              _ldb < std::max<index_t>(1, _TransB != 'n' ? _N : _K)) ||
+             _ldc < std::max<index_t>(1, _M)) {
+    throw std::invalid_argument("invalid _lda, _ldb and/or _ldc");
+  }
+  if (_M == 0 || _N == 0) {
+    return _dependencies;
+  }
+  if (_TransA != 'p' && _TransB != 'p') {
+    // Without packed operand, alpha is one
+    return _gemm(sb_handle, _TransA, _TransB, _M, _N, _K, element_t{1}, a_,
+                 _lda, b_, _ldb, _beta, _C, _ldc, _dependencies);
+  }
+  if (_TransA == 'p') {
+    return _gemm_compute_trans_b<false, true>(sb_handle, _TransB, _M, _N, _K,
+                                              a_, _lda, b_, _ldb, _beta, _C,
+                                              _ldc, _dependencies);
+  } else if (_TransA != 'n') {
+    return _gemm_compute_trans_b<true, false>(sb_handle, _TransB, _M, _N, _K,
+                                              a_, _lda, b_, _ldb, _beta, _C,
+                                              _ldc, _dependencies);
+  }
+  return _gemm_compute_trans_b<false, false>(sb_handle, _TransB, _M, _N, _K,
+                                             a_, _lda, b_, _ldb, _beta, _C,
+                                             _ldc, _dependencies);
+}
+
+template <bool TransX, bool TransY, bool ConjX, bool ConjY,
+          typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemmt_uplo(
+    sb_handle_t& sb_handle, char _uplo, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using launcher_t = blas::gemm::backend::gemm_triangular_launcher_t;
+  if (_uplo == 'u') {
+    return isZero(_beta)
+               ? launcher_t::template _select_gemm<TransX, TransY, ConjX,
+                                                   ConjY, true, false, false,
+                                                   true>(
+                     sb_handle, _N, _K, _alpha, _alpha, a_, _lda, b_, _ldb,
+                     _beta, _C, _ldc, _dependencies)
+               : launcher_t::template _select_gemm<TransX, TransY, ConjX,
+                                                   ConjY, true, false, false,
+                                                   false>(
+                     sb_handle, _N, _K, _alpha, _alpha, a_, _lda, b_, _ldb,
+                     _beta, _C, _ldc, _dependencies);
+  }
+  return isZero(_beta)
+             ? launcher_t::template _select_gemm<TransX, TransY, ConjX, ConjY,
+                                                 false, false, false, true>(
+                   sb_handle, _N, _K, _alpha, _alpha, a_, _lda, b_, _ldb,
+                   _beta, _C, _ldc, _dependencies)
+             : launcher_t::template _select_gemm<TransX, TransY, ConjX, ConjY,
+                                                 false, false, false, false>(
+                   sb_handle, _N, _K, _alpha, _alpha, a_, _lda, b_, _ldb,
+                   _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief The triangular kernel computes X * Y^T with X = op(A) and Y read as
+ * an N x K matrix, so Y^T = op(B) reads B transposed when _TransB is 'n'.
+ */
+template <bool TransX, bool ConjX, typename sb_handle_t,
+          typename container_0_t, typename container_1_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _gemmt_trans_b(
+    sb_handle_t& sb_handle, char _uplo, char _TransB, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (_TransB == 'n') {
+    return _gemmt_uplo<TransX, true, ConjX, false>(
+        sb_handle, _uplo, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _dependencies);
+  } else if (_TransB == 't') {
+    return _gemmt_uplo<TransX, false, ConjX, false>(
+        sb_handle, _uplo, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _dependencies);
+  }
+  return _gemmt_uplo<TransX, false, ConjX, true>(sb_handle, _uplo, _N, _K,
+                                                 _alpha, a_, _lda, b_, _ldb,
+                                                 _beta, _C, _ldc,
+                                                 _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemmt(
+    sb_handle_t& sb_handle, char _uplo, char _TransA, char _TransB, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_0_t b_, index_t _ldb, element_t _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies) {
+  _uplo = tolower(_uplo);
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+  if (_uplo != 'u' && _uplo != 'l') {
+    throw std::invalid_argument("invalid _uplo");
+  } else if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  } else if (_N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid _N and/or _K");
+  } else if (_lda < std::max<index_t>(1, _TransA != 'n' ? _K : _N) ||
+             _ldb < std::max<index_t>(1, _TransB != 'n' ? _N : _K) ||
+             _ldc < std::max<index_t>(1, _N)) {
+    throw std::invalid_argument("invalid _lda, _ldb and/or _ldc");
+  }
+  if (_N == 0) {
+    return _dependencies;
+  }
+  if (_TransA == 'n') {
+    return _gemmt_trans_b<false, false>(sb_handle, _uplo, _TransB, _N, _K,
+                                        _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                                        _ldc, _dependencies);
+  } else if (_TransA == 't') {
+    return _gemmt_trans_b<true, false>(sb_handle, _uplo, _TransB, _N, _K,
+                                       _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                                       _ldc, _dependencies);
+  }
+  return _gemmt_trans_b<true, true>(sb_handle, _uplo, _TransB, _N, _K, _alpha,
+                                    a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                                    _dependencies);
+}
+
+#ifdef SB_ENABLE_USM
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+    const index_t* _M, const index_t* _N, const index_t* _K,
+    const element_t* _alpha, const container_0_t* a_, const index_t* _lda,
+    const container_1_t* b_, const index_t* _ldb, const element_t* _beta,
+    const container_2_t* _C, const index_t* _ldc, index_t group_count,
+    const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  static_assert(std::is_pointer<container_0_t>::value &&
+                    std::is_pointer<container_1_t>::value &&
+                    std::is_pointer<container_2_t>::value,
+                "The grouped gemm takes arrays of USM pointers");
+  static_assert(is_sycl_scalar<element_t>::value,
+                "The grouped gemm only supports real data types");
+  if (group_count < 0) {
+    throw std::invalid_argument("invalid group_count");
+  }
+  for (index_t g = 0; g < group_count; ++g) {
+    const char trans_a = tolower(_TransA[g]);
+    const char trans_b = tolower(_TransB[g]);
+    if (trans_a != 'n' && trans_a != 't' && trans_a != 'c') {
+      throw std::invalid_argument("invalid _TransA");
+    } else if (trans_b != 'n' && trans_b != 't' && trans_b != 'c') {
+      throw std::invalid_argument("invalid _TransB");
+    } else if (_M[g] < 0 || _N[g] < 0 || _K[g] < 0 || group_size[g] < 0) {
+      throw std::invalid_argument("invalid _M, _N, _K and/or group_size");
+    } else if (_lda[g] < std::max<index_t>(1, trans_a != 'n' ? _K[g] : _M[g]) ||
+               _ldb[g] < std::max<index_t>(1, trans_b != 'n' ? _N[g] : _K[g]) ||
+               _ldc[g] < std::max<index_t>(1, _M[g])) {
+      throw std::invalid_argument("invalid _lda, _ldb and/or _ldc");
+    }
+  }
+  if (group_count == 0) {
+    return _dependencies;
+  }
+  return blas::gemm::backend::_gemm_grouped(
+      sb_handle, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_, _ldb,
+      _beta, _C, _ldc, group_count, group_size, _dependencies);
+}
+
+/*!
+ * @brief Batched gemm of matrices given by arrays of USM pointers, computed
+ * as a grouped gemm with a single group, whose kernel reads the pointers of
+ * each matrix from the arrays.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _gemm_batch(
+    sb_handle_t& sb_handle, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, const container_0_t* a_, index_t _lda,
+    const container_1_t* b_, index_t _ldb, element_t _beta,
+    const container_2_t* _C, index_t _ldc, index_t batch_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (batch_size < 0) {
+    throw std::invalid_argument("invalid batch_size");
+  }
+  return _gemm_batch(sb_handle, &_TransA, &_TransB, &_M, &_N, &_K, &_alpha,
+                     a_, &_lda, b_, &_ldb, &_beta, _C, &_ldc, index_t{1},
+                     &batch_size, _dependencies);
+}
+#endif  // SB_ENABLE_USM
+
 }  // namespace internal
 }  // namespace blas
 
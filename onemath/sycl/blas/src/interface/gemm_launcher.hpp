@@ -27,6 +27,9 @@
 #include "interface/gemm_launcher.h"
 #include "views/view.h"
 
+#include <cctype>
+#include <vector>
+
 namespace blas {
 
 /*!
@@ -38,7 +41,8 @@ template <typename container_t0, typename container_t1, typename container_t2,
           bool SymmB, int GemmMemoryType, int GemmAlgorithm,
           int GemmVectorization, bool is_beta_zero, int VectorSize,
           int BatchType, bool UseJointMatrix>
-template <typename sb_handle_t, typename element_t, typename index_t>
+template <typename sb_handle_t, typename element_t, typename index_t,
+          typename epilogue_t>
 typename sb_handle_t::event_t Gemm_Launcher<
     container_t0, container_t1, container_t2, WgSize, DoubleBuffer, ConflictA,
     ConflictB, ClSize, TileT, TransA, TransB, SymmA, SymmB, GemmMemoryType,
@@ -52,7 +56,8 @@ typename sb_handle_t::event_t Gemm_Launcher<
                                   index_t _ldc, index_t _stridec,
                                   index_t batch_size,
                                   const typename sb_handle_t::event_t&
-                                      _dependencies) {
+                                      _dependencies,
+                                  epilogue_t _epilogue) {
   auto a_view = make_matrix_view<col_major>(a_, _M, _K, _lda);
   auto b_view = make_matrix_view<col_major>(b_, _K, _N, _ldb);
   auto c_view = make_matrix_view<col_major>(_C, _M, _N, _ldc);
@@ -62,10 +67,199 @@ typename sb_handle_t::event_t Gemm_Launcher<
                         GemmAlgorithm, GemmVectorization, is_beta_zero,
                         VectorSize, BatchType, UseJointMatrix>(
       a_view, b_view, c_view, element_t(_alpha), element_t(_beta), batch_size,
-      index_t(_stridea), index_t(_strideb), index_t(_stridec));
+      index_t(_stridea), index_t(_strideb), index_t(_stridec), _epilogue);
   return sb_handle.execute(gemm, _dependencies);
 }
 
+template <int ClSize, typename TileT>
+template <typename value_t, typename index_t>
+index_t Gemm_Packed_Launcher<ClSize, TileT>::get_packed_size(
+    gemm_pack_matrix_t matrix, index_t _M, index_t _N, index_t _K) {
+  // The size only depends on the value type of the views
+  using view_t = MatrixView<value_t*, index_t, col_major>;
+  if (matrix == gemm_pack_matrix_t::a) {
+    return GemmPack<view_t, view_t, ClSize, TileT, false, false,
+                    value_t>::get_packed_size(_M, _K);
+  }
+  return GemmPack<view_t, view_t, ClSize, TileT, true, false,
+                  value_t>::get_packed_size(_N, _K);
+}
+
+/*!
+ * @brief Makes and launches GemmPack, the packed matrix being viewed as a
+ * single column.
+ */
+template <int ClSize, typename TileT>
+template <bool Trans, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t Gemm_Packed_Launcher<ClSize, TileT>::_pack(
+    sb_handle_t& sb_handle, gemm_pack_matrix_t matrix, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t src_, index_t _ld,
+    container_1_t packed_,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using value_t = typename ValueType<container_0_t>::type;
+  const index_t size = get_packed_size<value_t>(matrix, _M, _N, _K);
+  auto src_view = make_matrix_view<col_major>(src_, _M, _K, _ld);
+  auto packed_view = make_matrix_view<col_major>(packed_, size, index_t{1},
+                                                 size);
+  using src_view_t = decltype(src_view);
+  using packed_view_t = decltype(packed_view);
+  if (matrix == gemm_pack_matrix_t::b) {
+    return sb_handle.execute(
+        GemmPack<src_view_t, packed_view_t, ClSize, TileT, true, Trans,
+                 element_t>(src_view, packed_view, _alpha, _N, _K),
+        _dependencies);
+  }
+  return sb_handle.execute(
+      GemmPack<src_view_t, packed_view_t, ClSize, TileT, false, Trans,
+               element_t>(src_view, packed_view, _alpha, _M, _K),
+      _dependencies);
+}
+
+/*!
+ * @brief Makes and launches GemmPacked. The packed operands are viewed as a
+ * single column.
+ */
+template <int ClSize, typename TileT>
+template <bool TransA, bool TransB, bool PackedA, bool PackedB,
+          bool is_beta_zero, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t
+Gemm_Packed_Launcher<ClSize, TileT>::_select_gemm(
+    sb_handle_t& sb_handle, index_t _M, index_t _N, index_t _K,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using value_t = typename ValueType<container_0_t>::type;
+  const index_t size_a =
+      get_packed_size<value_t>(gemm_pack_matrix_t::a, _M, _N, _K);
+  const index_t size_b =
+      get_packed_size<value_t>(gemm_pack_matrix_t::b, _M, _N, _K);
+  auto a_view = make_matrix_view<col_major>(
+      a_, PackedA ? size_a : _M, PackedA ? index_t{1} : _K,
+      PackedA ? size_a : _lda);
+  auto b_view = make_matrix_view<col_major>(
+      b_, PackedB ? size_b : _K, PackedB ? index_t{1} : _N,
+      PackedB ? size_b : _ldb);
+  auto c_view = make_matrix_view<col_major>(_C, _M, _N, _ldc);
+
+  using gemm_t = GemmPacked<decltype(a_view), decltype(b_view),
+                            decltype(c_view), ClSize, TileT, TransA, TransB,
+                            PackedA, PackedB, element_t, is_beta_zero>;
+  gemm_t gemm(a_view, b_view, c_view, _beta, _M, _N, _K);
+  const auto nd_range = gemm.get_nd_range();
+  return sb_handle.execute(
+      gemm, static_cast<index_t>(nd_range.get_local_range()[0]),
+      static_cast<index_t>(nd_range.get_global_range()[0]),
+      gemm_t::local_memory_size, _dependencies);
+}
+
+/*!
+ * @brief Makes and launches GemmTriangular, with a work group per tile
+ * intersecting the triangle of C.
+ */
+template <int ClSize, typename TileT>
+template <bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, bool is_beta_zero, typename sb_handle_t,
+          typename container_0_t, typename container_1_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t
+Gemm_Triangular_Launcher<ClSize, TileT>::_select_gemm(
+    sb_handle_t& sb_handle, index_t _N, index_t _K, element_t _alpha,
+    element_t _alpha2, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  // The sizes of the views are not used, only their leading dimensions
+  auto a_view = make_matrix_view<col_major>(a_, _N, _K, _lda);
+  auto b_view = make_matrix_view<col_major>(b_, _N, _K, _ldb);
+  auto c_view = make_matrix_view<col_major>(_C, _N, _N, _ldc);
+
+  using gemm_t =
+      GemmTriangular<decltype(a_view), decltype(c_view), ClSize, TileT,
+                     TransX, TransY, ConjX, ConjY, IsUpper, Rank2, Hermitian,
+                     element_t, is_beta_zero>;
+  gemm_t gemm(a_view, b_view, c_view, _alpha, _alpha2, _beta, _N, _K);
+  const auto nd_range = gemm.get_nd_range();
+  return sb_handle.execute(
+      gemm, static_cast<index_t>(nd_range.get_local_range()[0]),
+      static_cast<index_t>(nd_range.get_global_range()[0]),
+      gemm_t::local_memory_size, _dependencies);
+}
+
+#ifdef SB_ENABLE_USM
+/*!
+ * @brief Wrapper around GemmGrouped. The arguments have already been checked
+ * by _gemm_batch.
+ */
+template <int ClSize, typename TileT>
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t
+Gemm_Grouped_Launcher<ClSize, TileT>::_select_gemm(
+    sb_handle_t& sb_handle, const char* _TransA, const char* _TransB,
+    const index_t* _M, const index_t* _N, const index_t* _K,
+    const element_t* _alpha, const container_0_t* a_, const index_t* _lda,
+    const container_1_t* b_, const index_t* _ldb, const element_t* _beta,
+    const container_2_t* _C, const index_t* _ldc, index_t group_count,
+    const index_t* group_size,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using value_t = std::remove_const_t<std::remove_pointer_t<container_0_t>>;
+  using out_t = std::remove_pointer_t<container_2_t>;
+  using group_t = Gemm_Group<element_t, index_t>;
+  using gemm_t =
+      GemmGrouped<value_t, out_t, element_t, index_t, ClSize, TileT>;
+
+  std::vector<group_t> groups(group_count);
+  index_t num_matrices = 0;
+  index_t num_tiles = 0;
+  for (index_t g = 0; g < group_count; ++g) {
+    group_t& group = groups[g];
+    group.trans_a = tolower(_TransA[g]) != 'n';
+    group.trans_b = tolower(_TransB[g]) != 'n';
+    group.m = _M[g];
+    group.n = _N[g];
+    group.k = _K[g];
+    group.lda = _lda[g];
+    group.ldb = _ldb[g];
+    group.ldc = _ldc[g];
+    group.alpha = _alpha[g];
+    group.beta = _beta[g];
+    group.first_matrix = num_matrices;
+    group.first_tile = num_tiles;
+    group.tiles_m = (_M[g] + gemm_t::block_rows - 1) / gemm_t::block_rows;
+    group.tiles_n = (_N[g] + gemm_t::block_cols - 1) / gemm_t::block_cols;
+    num_matrices += group_size[g];
+    num_tiles += group.tiles_m * group.tiles_n * group_size[g];
+  }
+  if (num_tiles == 0) {
+    return _dependencies;
+  }
+
+  auto groups_mem =
+      sb_handle.template acquire_temp_mem<helper::AllocType::usm, group_t>(
+          group_count);
+  // The handle keeps a copy of the host descriptors until the copy completes
+  auto copy_groups =
+      sb_handle.copy_to_device(groups.data(), groups_mem, group_count);
+
+  auto gemm = make_gemm_grouped<ClSize, TileT>(
+      groups_mem, group_count,
+      reinterpret_cast<const value_t* const*>(a_),
+      reinterpret_cast<const value_t* const*>(b_),
+      reinterpret_cast<out_t* const*>(_C), num_tiles);
+  const auto nd_range = gemm.get_nd_range(
+      static_cast<index_t>(sb_handle.get_num_compute_units()));
+  auto events = sb_handle.execute(
+      gemm, static_cast<index_t>(nd_range.get_local_range()[0]),
+      static_cast<index_t>(nd_range.get_global_range()[0]),
+      gemm_t::local_memory_size,
+      concatenate_vectors(_dependencies, copy_groups));
+  sb_handle.release_temp_mem(events, groups_mem);
+  return events;
+}
+#endif  // SB_ENABLE_USM
+
 }  // namespace blas
 
 #endif  // ONEMATH_SYCL_BLAS_BLAS3_LAUNCHER_HPP
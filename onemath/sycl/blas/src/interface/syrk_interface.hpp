@@ -0,0 +1,177 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_SYRK_INTERFACE_HPP
+#define ONEMATH_SYCL_BLAS_SYRK_INTERFACE_HPP
+
+#include "interface/gemm_interface.hpp"
+
+namespace blas {
+namespace internal {
+
+template <bool Trans, bool IsUpper, bool Rank2, bool Hermitian,
+          typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _rank_k_update_is_beta_zero(
+    sb_handle_t& sb_handle, index_t _N, index_t _K, element_t _alpha,
+    element_t _alpha2, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using launcher_t = blas::gemm::backend::gemm_triangular_launcher_t;
+  // Y is conjugated by A * A^H, X by A^H * A
+  constexpr bool conj_x = Hermitian && Trans;
+  constexpr bool conj_y = Hermitian && !Trans;
+  return isZero(_beta)
+             ? launcher_t::template _select_gemm<Trans, Trans, conj_x, conj_y,
+                                                 IsUpper, Rank2, Hermitian,
+                                                 true>(
+                   sb_handle, _N, _K, _alpha, _alpha2, a_, _lda, b_, _ldb,
+                   _beta, _C, _ldc, _dependencies)
+             : launcher_t::template _select_gemm<Trans, Trans, conj_x, conj_y,
+                                                 IsUpper, Rank2, Hermitian,
+                                                 false>(
+                   sb_handle, _N, _K, _alpha, _alpha2, a_, _lda, b_, _ldb,
+                   _beta, _C, _ldc, _dependencies);
+}
+
+/*!
+ * @brief Rank-k (rank-2k when Rank2) update of a triangle of C, computed by
+ * GemmTriangular on the tiles of the triangle only. X = op(A) and Y = op(B)
+ * are N x K, op being the transpose, or the conjugate transpose when
+ * Hermitian.
+ */
+template <bool Rank2, bool Hermitian, typename sb_handle_t,
+          typename container_0_t, typename container_1_t, typename element_t,
+          typename index_t>
+typename sb_handle_t::event_t _rank_k_update(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, element_t _alpha2, container_0_t a_, index_t _lda,
+    container_0_t b_, index_t _ldb, element_t _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies) {
+  _uplo = tolower(_uplo);
+  _trans = tolower(_trans);
+  // The conjugate transpose of a real matrix is its transpose
+  const bool valid_trans =
+      _trans == 'n' ||
+      (Hermitian ? _trans == 'c'
+                 : (_trans == 't' ||
+                    (_trans == 'c' && is_sycl_scalar<element_t>::value)));
+  if (_uplo != 'u' && _uplo != 'l') {
+    throw std::invalid_argument("invalid _uplo");
+  } else if (!valid_trans) {
+    throw std::invalid_argument("invalid _trans");
+  } else if (_N < 0 || _K < 0) {
+    throw std::invalid_argument("invalid _N and/or _K");
+  }
+  const bool trans = _trans != 'n';
+  const index_t rows = trans ? _K : _N;
+  if (_lda < std::max<index_t>(1, rows) ||
+      (Rank2 && _ldb < std::max<index_t>(1, rows)) ||
+      _ldc < std::max<index_t>(1, _N)) {
+    throw std::invalid_argument("invalid _lda, _ldb and/or _ldc");
+  }
+  if (_N == 0) {
+    return _dependencies;
+  }
+
+  if (trans && _uplo == 'u') {
+    return _rank_k_update_is_beta_zero<true, true, Rank2, Hermitian>(
+        sb_handle, _N, _K, _alpha, _alpha2, a_, _lda, b_, _ldb, _beta, _C,
+        _ldc, _dependencies);
+  } else if (trans) {
+    return _rank_k_update_is_beta_zero<true, false, Rank2, Hermitian>(
+        sb_handle, _N, _K, _alpha, _alpha2, a_, _lda, b_, _ldb, _beta, _C,
+        _ldc, _dependencies);
+  } else if (_uplo == 'u') {
+    return _rank_k_update_is_beta_zero<false, true, Rank2, Hermitian>(
+        sb_handle, _N, _K, _alpha, _alpha2, a_, _lda, b_, _ldb, _beta, _C,
+        _ldc, _dependencies);
+  } else {
+    return _rank_k_update_is_beta_zero<false, false, Rank2, Hermitian>(
+        sb_handle, _N, _K, _alpha, _alpha2, a_, _lda, b_, _ldb, _beta, _C,
+        _ldc, _dependencies);
+  }
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syrk(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return _rank_k_update<false, false>(sb_handle, _uplo, _trans, _N, _K,
+                                      _alpha, _alpha, a_, _lda, a_, _lda,
+                                      _beta, _C, _ldc, _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _syr2k(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, element_t _beta, container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  return _rank_k_update<true, false>(sb_handle, _uplo, _trans, _N, _K, _alpha,
+                                     _alpha, a_, _lda, b_, _ldb, _beta, _C,
+                                     _ldc, _dependencies);
+}
+
+#ifdef BLAS_ENABLE_COMPLEX
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _herk(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, element_t _beta,
+    container_1_t _C, index_t _ldc,
+    const typename sb_handle_t::event_t& _dependencies) {
+  using complex_t = typename ValueType<container_1_t>::type;
+  static_assert(is_complex_sycl<complex_t>::value,
+                "herk is only defined for complex matrices");
+  const complex_t alpha(_alpha, 0);
+  return _rank_k_update<false, true>(sb_handle, _uplo, _trans, _N, _K, alpha,
+                                     alpha, a_, _lda, a_, _lda,
+                                     complex_t(_beta, 0), _C, _ldc,
+                                     _dependencies);
+}
+
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _her2k(
+    sb_handle_t& sb_handle, char _uplo, char _trans, index_t _N, index_t _K,
+    element_t _alpha, container_0_t a_, index_t _lda, container_0_t b_,
+    index_t _ldb, typename element_t::value_type _beta, container_1_t _C,
+    index_t _ldc, const typename sb_handle_t::event_t& _dependencies) {
+  static_assert(is_complex_sycl<element_t>::value,
+                "her2k is only defined for complex matrices");
+  // C = alpha * X * Y^H + conj(alpha) * Y * X^H + beta * C
+  return _rank_k_update<true, true>(
+      sb_handle, _uplo, _trans, _N, _K, _alpha,
+      sycl::ext::oneapi::experimental::conj(_alpha), a_, _lda, b_, _ldb,
+      element_t(_beta, 0), _C, _ldc, _dependencies);
+}
+#endif  // BLAS_ENABLE_COMPLEX
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_SYRK_INTERFACE_HPP
@@ -0,0 +1,244 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_TRMM_INTERFACE_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_TRMM_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "interface/gemm_interface.hpp"
+#include "operations/blas3_trees.h"
+#include "sb_handle/handle.h"
+#include "helper.h"
+#include "views/view.h"
+
+namespace blas {
+namespace internal {
+
+/**
+ * @brief Recursive step of TRMM, computing B = alpha * op(A) * B (Left) or
+ * B = alpha * B * op(A) in place, where A is n x n and B has m columns (Left)
+ * or m rows.
+ *
+ * With op(A) lower triangular and on the left, the decomposition
+ *
+ *   [ B0 ]  =  alpha * [ A00   0  ] * [ B0 ]
+ *   [ B1 ]             [ A10  A11 ]   [ B1 ]
+ *
+ * yields, in the order that never overwrites a block still to be read:
+ *
+ *  B1 = alpha*A11*B1
+ *  B1 = alpha*A10*B0 + 1*B1
+ *  B0 = alpha*A00*B0
+ *
+ * The off-diagonal product is a single GEMM of half the size of A, and the
+ * triangles A00 and A11 are split again until they fit the
+ * TriangularBlockMultiplier leaves. The upper and right side cases run the
+ * same steps in the other order.
+ */
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _trmm_recursive(
+    sb_handle_t& sb_handle, index_t n, index_t m, element_t alpha,
+    container_0_t A, index_t lda, container_1_t B, index_t ldb,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (n <= BlockSize) {
+    auto bufferA = make_matrix_view<col_major>(A, n, n, lda);
+    auto bufferB = Left ? make_matrix_view<col_major>(B, n, m, ldb)
+                        : make_matrix_view<col_major>(B, m, n, ldb);
+    auto multiplier =
+        make_triangular_block_multiplier<Left, Upper, Trans, Conj, UnitDiag,
+                                         BlockSize>(
+            bufferA, bufferB, alpha, n, m,
+            static_cast<index_t>(sb_handle.get_work_group_size()));
+    const auto nd_range = multiplier.get_nd_range();
+    return sb_handle.execute(
+        multiplier, static_cast<index_t>(nd_range.get_local_range()[0]),
+        static_cast<index_t>(nd_range.get_global_range()[0]),
+        decltype(multiplier)::local_memory_size, _dependencies);
+  }
+
+  // The first half is a multiple of the block size so that all the leaves
+  // but the last one are full
+  const index_t n0 = roundUp<index_t>((n + 1) / 2, BlockSize);
+  const index_t n1 = n - n0;
+  const char trans = Trans ? (Conj ? 'c' : 't') : 'n';
+  // op(A) is lower triangular when A is lower and not transposed, or upper
+  // and transposed
+  constexpr bool is_lower = Upper == Trans;
+
+  container_0_t a00 = A;
+  container_0_t a11 = A + n0 * lda + n0;
+  // The stored off-diagonal block, A01 or A10, is n0 x n1 or n1 x n0
+  helper::add_const<container_0_t> a_off = A + (Upper ? n0 * lda : n0);
+  container_1_t b0 = B;
+  container_1_t b1 = B + (Left ? n0 : n0 * ldb);
+  helper::add_const<container_1_t> b0_in = b0;
+  helper::add_const<container_1_t> b1_in = b1;
+
+  // The diagonal block whose part of B the off-diagonal GEMM reads is
+  // multiplied last
+  const bool first_block_0 = Left != is_lower;
+  typename sb_handle_t::event_t event;
+  if (first_block_0) {
+    event = _trmm_recursive<Left, Upper, Trans, Conj, UnitDiag, BlockSize>(
+        sb_handle, n0, m, alpha, a00, lda, b0, ldb, _dependencies);
+  } else {
+    event = _trmm_recursive<Left, Upper, Trans, Conj, UnitDiag, BlockSize>(
+        sb_handle, n1, m, alpha, a11, lda, b1, ldb, _dependencies);
+  }
+
+  if (Left && is_lower) {
+    // B1 = alpha*op(A)10*B0 + B1
+    event = internal::_gemm(sb_handle, trans, 'n', n1, m, n0, alpha, a_off,
+                            lda, b0_in, ldb, element_t{1}, b1, ldb, event);
+  } else if (Left) {
+    // B0 = alpha*op(A)01*B1 + B0
+    event = internal::_gemm(sb_handle, trans, 'n', n0, m, n1, alpha, a_off,
+                            lda, b1_in, ldb, element_t{1}, b0, ldb, event);
+  } else if (is_lower) {
+    // B0 = alpha*B1*op(A)10 + B0
+    event = internal::_gemm(sb_handle, 'n', trans, m, n0, n1, alpha, b1_in,
+                            ldb, a_off, lda, element_t{1}, b0, ldb, event);
+  } else {
+    // B1 = alpha*B0*op(A)01 + B1
+    event = internal::_gemm(sb_handle, 'n', trans, m, n1, n0, alpha, b0_in,
+                            ldb, a_off, lda, element_t{1}, b1, ldb, event);
+  }
+
+  if (first_block_0) {
+    return _trmm_recursive<Left, Upper, Trans, Conj, UnitDiag, BlockSize>(
+        sb_handle, n1, m, alpha, a11, lda, b1, ldb, event);
+  }
+  return _trmm_recursive<Left, Upper, Trans, Conj, UnitDiag, BlockSize>(
+      sb_handle, n0, m, alpha, a00, lda, b0, ldb, event);
+}
+
+template <bool Left, bool Upper, typename sb_handle_t, typename container_0_t,
+          typename container_1_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _trmm_trans(
+    sb_handle_t& sb_handle, char trans, bool unit_diag, index_t n, index_t m,
+    element_t alpha, container_0_t A, index_t lda, container_1_t B,
+    index_t ldb, const typename sb_handle_t::event_t& _dependencies) {
+  constexpr int blockSize = 32;
+  if (trans == 'n') {
+    return unit_diag
+               ? _trmm_recursive<Left, Upper, false, false, true, blockSize>(
+                     sb_handle, n, m, alpha, A, lda, B, ldb, _dependencies)
+               : _trmm_recursive<Left, Upper, false, false, false, blockSize>(
+                     sb_handle, n, m, alpha, A, lda, B, ldb, _dependencies);
+  } else if (trans == 't') {
+    return unit_diag
+               ? _trmm_recursive<Left, Upper, true, false, true, blockSize>(
+                     sb_handle, n, m, alpha, A, lda, B, ldb, _dependencies)
+               : _trmm_recursive<Left, Upper, true, false, false, blockSize>(
+                     sb_handle, n, m, alpha, A, lda, B, ldb, _dependencies);
+  }
+  return unit_diag
+             ? _trmm_recursive<Left, Upper, true, true, true, blockSize>(
+                   sb_handle, n, m, alpha, A, lda, B, ldb, _dependencies)
+             : _trmm_recursive<Left, Upper, true, true, false, blockSize>(
+                   sb_handle, n, m, alpha, A, lda, B, ldb, _dependencies);
+}
+
+/**
+ * @brief Implementation of Triangular Matrix-Matrix multiplication (TRMM).
+ * @param side Indicates if A is on the left or right of B
+ * @param uplo Indicates if A is lower or upper triangular
+ * @param trans Indicates the form that the matrix A will take in the
+ * multiplication
+ * @param diag Indicates if A has a non-unit diagonal or is assumed to be
+ *             unit diagonal.
+ * @param M The number of rows of matrix B
+ * @param N The number of columns of B
+ * @param alpha The scalar alpha that is applied to the product
+ * @param A Memory object that holds the input matrix A
+ * @param lda Leading dimension of matrix A
+ * @param B Memory object that holds the input/output matrix B
+ * @param ldb Leading dimension of matrix B
+ *
+ * @note both matrices A and B are expected to be stored in column major order
+ *
+ * TRMM computes one of the following matrix products
+ *
+ * B = alpha*op(A)*B      or     B = alpha*B*op(A)
+ *
+ * in place, see @ref _trmm_recursive. No temporary copy of B is made.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t>
+typename sb_handle_t::event_t _trmm(
+    sb_handle_t& sb_handle, char side, char uplo, char trans, char diag,
+    index_t M, index_t N, element_t alpha, container_0_t A, index_t lda,
+    container_1_t B, index_t ldb,
+    const typename sb_handle_t::event_t& _dependencies) {
+  side = tolower(side);
+  uplo = tolower(uplo);
+  trans = tolower(trans);
+  diag = tolower(diag);
+
+  if (side != 'l' && side != 'r') {
+    throw std::invalid_argument("invalid Side argument");
+  } else if (uplo != 'u' && uplo != 'l') {
+    throw std::invalid_argument("invalid Triangle argument");
+  } else if (trans != 'n' && trans != 't' && trans != 'c') {
+    throw std::invalid_argument("invalid Transpose argument");
+  } else if (diag != 'u' && diag != 'n') {
+    throw std::invalid_argument("invalid Diagonal argument");
+  } else if (M < 0 || N < 0) {
+    throw std::invalid_argument("invalid matrix size argument");
+  }
+
+  // The order of A and the other dimension of B
+  const index_t K = (side == 'l') ? M : N;
+  const index_t L = (side == 'l') ? N : M;
+  if (lda < std::max<index_t>(1, K) || ldb < std::max<index_t>(1, M)) {
+    throw std::invalid_argument("invalid lda and/or ldb");
+  }
+  if (M == 0 || N == 0) {
+    return _dependencies;
+  }
+  if (alpha == element_t{0}) {
+    // B is zeroed without reading A
+    return _scal_matrix(sb_handle, M, N, alpha, B, ldb, index_t{1},
+                        _dependencies);
+  }
+
+  const bool isUnitDiag = diag == 'u';
+  if (side == 'l' && uplo == 'u') {
+    return _trmm_trans<true, true>(sb_handle, trans, isUnitDiag, K, L, alpha,
+                                   A, lda, B, ldb, _dependencies);
+  } else if (side == 'l') {
+    return _trmm_trans<true, false>(sb_handle, trans, isUnitDiag, K, L, alpha,
+                                    A, lda, B, ldb, _dependencies);
+  } else if (uplo == 'u') {
+    return _trmm_trans<false, true>(sb_handle, trans, isUnitDiag, K, L, alpha,
+                                    A, lda, B, ldb, _dependencies);
+  }
+  return _trmm_trans<false, false>(sb_handle, trans, isUnitDiag, K, L, alpha,
+                                   A, lda, B, ldb, _dependencies);
+}
+
+}  // namespace internal
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_TRMM_INTERFACE_HPP
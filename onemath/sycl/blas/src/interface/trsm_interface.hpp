@@ -33,6 +33,154 @@
 namespace blas {
 namespace internal {
 
+/**
+ * @brief Size of the diagonal blocks of A inverted by the TRSM. Each doubling
+ * of the block size halves the number of leaves of the recursion, and so of
+ * GEMM launches, so the largest block is chosen as long as the inverter, which
+ * runs one work group of blockSize items per block, still has a block per
+ * compute unit and a block fits the local memory of the device.
+ */
+template <typename element_t, typename sb_handle_t, typename index_t>
+inline index_t _trsm_block_size(sb_handle_t& sb_handle, index_t K) {
+  auto q = sb_handle.get_queue();
+  const size_t localMemSize = helper::get_local_mem_size(q);
+  const size_t workGroupSize = helper::get_work_group_size(q);
+  const size_t computeUnits = sb_handle.get_num_compute_units();
+  index_t blockSize = 16;
+  while (blockSize < 128) {
+    const index_t nextSize = 2 * blockSize;
+    if (static_cast<size_t>(nextSize) > workGroupSize ||
+        static_cast<size_t>(nextSize * nextSize) * sizeof(element_t) >
+            localMemSize ||
+        static_cast<size_t>(nextSize) * computeUnits >
+            static_cast<size_t>(K)) {
+      break;
+    }
+    blockSize = nextSize;
+  }
+  return blockSize;
+}
+
+/**
+ * @brief Inverts the BlockSize x BlockSize diagonal blocks of the K x K matrix
+ * A into invA, see @ref make_diag_blocks_inverter.
+ */
+template <int BlockSize, typename sb_handle_t, typename matrix_a_t,
+          typename matrix_inv_a_t, typename index_t>
+typename sb_handle_t::event_t _trsm_invert_diagonal_blocks(
+    sb_handle_t& sb_handle, bool isUnitDiag, bool isUpper, index_t K,
+    matrix_a_t bufferA, matrix_inv_a_t bufferInvA,
+    const typename sb_handle_t::event_t& _dependencies) {
+  // Calculate the parameters for the diagonal blocks inversion
+  const index_t numInternalBlocks = roundUp<index_t>(K, BlockSize) / BlockSize;
+  const index_t globalSize = numInternalBlocks * BlockSize;
+  const index_t localSize = BlockSize;
+  const index_t localMemSize = BlockSize * BlockSize;
+
+  // Instantiate the appropriate diagonal blocks inversion based on the matrix
+  // type
+  if (isUnitDiag && isUpper) {
+    auto diagInverter =
+        make_diag_blocks_inverter<true, true, BlockSize>(bufferA, bufferInvA);
+    return sb_handle.execute(diagInverter, localSize, globalSize,
+                             localMemSize, _dependencies);
+  } else if (!isUnitDiag && isUpper) {
+    auto diagInverter =
+        make_diag_blocks_inverter<false, true, BlockSize>(bufferA, bufferInvA);
+    return sb_handle.execute(diagInverter, localSize, globalSize,
+                             localMemSize, _dependencies);
+  } else if (isUnitDiag && !isUpper) {
+    auto diagInverter =
+        make_diag_blocks_inverter<true, false, BlockSize>(bufferA, bufferInvA);
+    return sb_handle.execute(diagInverter, localSize, globalSize,
+                             localMemSize, _dependencies);
+  }
+  auto diagInverter =
+      make_diag_blocks_inverter<false, false, BlockSize>(bufferA, bufferInvA);
+  return sb_handle.execute(diagInverter, localSize, globalSize, localMemSize,
+                           _dependencies);
+}
+
+/**
+ * @brief Recursive step of TRSM, solving op(A)*X = alpha*B (isLeft) or
+ * X*op(A) = alpha*B where A is n x n and B has m columns (isLeft) or m rows.
+ * B is overwritten by the updates, invA holds the inverse of the diagonal
+ * blocks of A and isLower tells whether op(A) is lower triangular.
+ *
+ * With op(A) lower triangular and on the left:
+ *
+ *  X0 = solve(A00, alpha*B0)
+ *  B1 = -1 * A10*X0 + alpha*B1
+ *  X1 = solve(A11, B1)
+ *
+ * where the leaves of the recursion, of at most blockSize rows, compute
+ * X0 = alpha*A00^{-1}*B0. The other cases solve the half whose X is read by
+ * the update first.
+ */
+template <typename sb_handle_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename sb_handle_t::event_t _trsm_recursive(
+    sb_handle_t& sb_handle, bool isLeft, bool isLower, bool isUpper,
+    char trans, index_t n, index_t m, index_t blockSize, element_t alpha,
+    container_0_t A, index_t lda, container_2_t invA, container_1_t B,
+    index_t ldb, container_2_t X, index_t ldx,
+    const typename sb_handle_t::event_t& _dependencies) {
+  if (n <= blockSize) {
+    helper::add_const<container_2_t> invA_ = invA;
+    helper::add_const<container_1_t> b_ = B;
+    return isLeft ? internal::_gemm(sb_handle, trans, 'n', n, m, n, alpha,
+                                    invA_, blockSize, b_, ldb, element_t{0}, X,
+                                    ldx, _dependencies)
+                  : internal::_gemm(sb_handle, 'n', trans, m, n, n, alpha, b_,
+                                    ldb, invA_, blockSize, element_t{0}, X,
+                                    ldx, _dependencies);
+  }
+
+  // The first half is a multiple of the block size so that the leaves match
+  // the inverted diagonal blocks
+  const index_t n0 = roundUp<index_t>((n + 1) / 2, blockSize);
+  const index_t n1 = n - n0;
+
+  container_0_t a11 = A + n0 * lda + n0;
+  // The stored off-diagonal block, A01 or A10, is n0 x n1 or n1 x n0
+  helper::add_const<container_0_t> aOff = A + (isUpper ? n0 * lda : n0);
+  container_2_t invA1 = invA + n0 * blockSize;
+  container_1_t b1 = B + (isLeft ? n0 : n0 * ldb);
+  container_2_t x1 = X + (isLeft ? n0 : n0 * ldx);
+  helper::add_const<container_2_t> x0_ = X;
+  helper::add_const<container_2_t> x1_ = x1;
+
+  typename sb_handle_t::event_t event;
+  if (isLeft == isLower) {
+    // X0 is solved first and B1 updated with it
+    event = _trsm_recursive(sb_handle, isLeft, isLower, isUpper, trans, n0, m,
+                            blockSize, alpha, A, lda, invA, B, ldb, X, ldx,
+                            _dependencies);
+    event = isLeft ? internal::_gemm(sb_handle, trans, 'n', n1, m, n0,
+                                     element_t{-1}, aOff, lda, x0_, ldx, alpha,
+                                     b1, ldb, event)
+                   : internal::_gemm(sb_handle, 'n', trans, m, n1, n0,
+                                     element_t{-1}, x0_, ldx, aOff, lda, alpha,
+                                     b1, ldb, event);
+    return _trsm_recursive(sb_handle, isLeft, isLower, isUpper, trans, n1, m,
+                           blockSize, element_t{1}, a11, lda, invA1, b1, ldb,
+                           x1, ldx, event);
+  }
+  // X1 is solved first and B0 updated with it
+  event = _trsm_recursive(sb_handle, isLeft, isLower, isUpper, trans, n1, m,
+                          blockSize, alpha, a11, lda, invA1, b1, ldb, x1, ldx,
+                          _dependencies);
+  event = isLeft ? internal::_gemm(sb_handle, trans, 'n', n0, m, n1,
+                                   element_t{-1}, aOff, lda, x1_, ldx, alpha, B,
+                                   ldb, event)
+                 : internal::_gemm(sb_handle, 'n', trans, m, n0, n1,
+                                   element_t{-1}, x1_, ldx, aOff, lda, alpha, B,
+                                   ldb, event);
+  return _trsm_recursive(sb_handle, isLeft, isLower, isUpper, trans, n0, m,
+                         blockSize, element_t{1}, A, lda, invA, B, ldb, X, ldx,
+                         event);
+}
+
 /**
  * @brief Implementation of Triangle Solve with Multiple Right Hand Sides
  * (TRSM).
@@ -97,10 +245,13 @@ namespace internal {
  *  B1 = -1 * A01*X0      + alpha*B1
  *  X1 =  1 * A11^{-1}*B1 +     0*X1
  *
- * This step can be repeated as many times as necessary for larger matrices.
- * Despite having to invert blocks of the matrix A, this TRSM implementation
- * takes advantage of GEMM calls that are heavily optimized for the target
- * hardware, thus running with maximum performance.
+ * This step is applied recursively: the triangle of A is halved, the GEMM
+ * updating B1 is as large as the off-diagonal block, and the two halves are
+ * solved the same way until they fit a single inverted diagonal block, which
+ * is the leaf GEMM computing X0. Larger diagonal blocks mean fewer leaves, see
+ * @ref _trsm_block_size. Despite having to invert blocks of the matrix A, this
+ * TRSM implementation takes advantage of GEMM calls that are heavily optimized
+ * for the target hardware, thus running with maximum performance.
  */
 template <typename sb_handle_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
@@ -138,7 +289,7 @@ typename sb_handle_t::event_t _trsm(
   const bool isLeft = side == 'l';
   const bool isTranspose = trans == 't';
 
-  constexpr index_t blockSize = 16;
+  const index_t blockSize = _trsm_block_size<element_t>(sb_handle, K);
 
   typename sb_handle_t::event_t trsmEvents;
 
@@ -150,8 +301,7 @@ typename sb_handle_t::event_t _trsm(
                   ? helper::AllocType::usm
                   : helper::AllocType::buffer,
        element_t > (invASize);
-  typename sb_handle_t::event_t event = {blas::helper::fill(
-      sb_handle.get_queue(), invA, element_t{0}, invASize, _dependencies)};
+  auto event = sb_handle.fill(invA, element_t{0}, invASize, _dependencies);
   trsmEvents = concatenate_vectors(trsmEvents, event);
 
   // Create the matrix views from the input buffers
@@ -160,36 +310,19 @@ typename sb_handle_t::event_t _trsm(
   auto bufferInvA =
       make_matrix_view<col_major>(invA, blockSize, blockSize, lda);
 
-  // Calculate the parameters for the diagonal blocks inversion
-  const index_t numBlocks = roundUp<index_t>(K, blockSize) / blockSize;
-  const index_t numInternalBlocks = roundUp<index_t>(K, blockSize) / blockSize;
-  const index_t globalSize = numInternalBlocks * blockSize;
-  const index_t localSize = blockSize;
-  const index_t localMemSize = blockSize * blockSize;
-
-  // Instantiate the appropriate diagonal blocks inversion based on the matrix
-  // type
   typename sb_handle_t::event_t invertBlocksEvent;
-  if (isUnitDiag && isUpper) {
-    auto diagInverter =
-        make_diag_blocks_inverter<true, true, blockSize>(bufferA, bufferInvA);
-    invertBlocksEvent = sb_handle.execute(diagInverter, localSize, globalSize,
-                                          localMemSize, event);
-  } else if (!isUnitDiag && isUpper) {
-    auto diagInverter =
-        make_diag_blocks_inverter<false, true, blockSize>(bufferA, bufferInvA);
-    invertBlocksEvent = sb_handle.execute(diagInverter, localSize, globalSize,
-                                          localMemSize, event);
-  } else if (isUnitDiag && !isUpper) {
-    auto diagInverter =
-        make_diag_blocks_inverter<true, false, blockSize>(bufferA, bufferInvA);
-    invertBlocksEvent = sb_handle.execute(diagInverter, localSize, globalSize,
-                                          localMemSize, event);
-  } else if (!isUnitDiag && !isUpper) {
-    auto diagInverter =
-        make_diag_blocks_inverter<false, false, blockSize>(bufferA, bufferInvA);
-    invertBlocksEvent = sb_handle.execute(diagInverter, localSize, globalSize,
-                                          localMemSize, event);
+  if (blockSize == 128) {
+    invertBlocksEvent = _trsm_invert_diagonal_blocks<128>(
+        sb_handle, isUnitDiag, isUpper, K, bufferA, bufferInvA, event);
+  } else if (blockSize == 64) {
+    invertBlocksEvent = _trsm_invert_diagonal_blocks<64>(
+        sb_handle, isUnitDiag, isUpper, K, bufferA, bufferInvA, event);
+  } else if (blockSize == 32) {
+    invertBlocksEvent = _trsm_invert_diagonal_blocks<32>(
+        sb_handle, isUnitDiag, isUpper, K, bufferA, bufferInvA, event);
+  } else {
+    invertBlocksEvent = _trsm_invert_diagonal_blocks<16>(
+        sb_handle, isUnitDiag, isUpper, K, bufferA, bufferInvA, event);
   }
   trsmEvents = concatenate_vectors(trsmEvents, invertBlocksEvent);
 
@@ -206,179 +339,14 @@ typename sb_handle_t::event_t _trsm(
       internal::_copy<sb_handle_t, index_t, decltype(B), decltype(X), index_t>(
           sb_handle, BSize, B, 1, X, 1, trsmEvents));
 
-  if (isLeft) {
-    if ((isUpper && isTranspose) || (!isUpper && !isTranspose)) {
-      // Solves the system AX = alpha*B, as described in the documentation of
-      // the function when X is lower triangular.
-      //
-      //         A            X                 B
-      //    [ A00   0  ] * [ X0 ]  =  alpha * [ B0 ]
-      //    [ A10  A11 ]   [ X1 ]             [ B1 ]
-      //
-      // yields:
-      //
-      //  X0 = alpha*A00{-1}*B0
-      //  B1 = -1 * A10*X0 + alpha*B1
-      //  X1 = A11{-1}*B1  + 0*X1
-      //
-
-      // True when (lower triangular) or (upper triangular and transposed)
-      for (index_t i = 0; i < M; i += blockSize) {
-        const index_t currentBlockSize = std::min(M - i, blockSize);
-        auto gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', currentBlockSize, N,
-            currentBlockSize, (i == 0) ? alpha : element_t{1},
-            invA + i * blockSize, blockSize, B + i, ldb, element_t{0}, X + i,
-            ldx, trsmEvents);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-
-        if ((i + blockSize) >= M) {
-          break;
-        }
-
-        const std::ptrdiff_t offsetA = !isTranspose
-                                           ? ((i + blockSize) + (i * lda))
-                                           : (i + (blockSize + i) * lda);
-
-        helper::add_const<container_0_t> a_ = A + offsetA;
-        helper::add_const<container_1_t> b_ = X + i;
-        gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', M - i - blockSize, N,
-            blockSize, element_t{-1}, a_, lda, b_, ldx,
-            (i == 0) ? alpha : element_t{1}, B + i + blockSize, ldb, gemmEvent);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-    } else {
-      // Solves the system AX = alpha*B when X is upper triangular
-      //
-      //         A            X                 B
-      //    [ A00  A01  ] * [ X0 ]  =  alpha * [ B0 ]
-      //    [  0   A11  ]   [ X1 ]             [ B1 ]
-      //
-      // yields:
-      //
-      //  X1 = alpha*A11{-1}*B1
-      //  B0 = -1 * A01*X1 + alpha*B0
-      //  X0 = A00{-1}*B0  + 0*X0
-      //
-
-      // True when (upper triangular) or (lower triangular and transposed)
-      const index_t specialBlockSize =
-          (M % blockSize == 0) ? blockSize : (M % blockSize);
-      const index_t iStart = M - specialBlockSize;
-      for (index_t i = iStart; i >= 0; i -= blockSize) {
-        const index_t currentBlockSize =
-            (i == iStart) ? specialBlockSize : blockSize;
-        auto gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', currentBlockSize, N,
-            currentBlockSize, (i == iStart) ? alpha : element_t{1},
-            invA + i * blockSize, blockSize, B + i, ldb, element_t{0}, X + i,
-            ldx, trsmEvents);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-
-        if ((i - blockSize) < 0) {
-          break;
-        }
-
-        helper::add_const<container_0_t> a_ =
-            A + (!isTranspose ? (i * lda) : i);
-        helper::add_const<container_1_t> b_ = X + i;
-        gemmEvent = internal::_gemm(
-            sb_handle, isTranspose ? 't' : 'n', 'n', i, N, currentBlockSize,
-            element_t{-1}, a_, lda, b_, ldx,
-            (i == iStart) ? alpha : element_t{1}, B, ldb, gemmEvent);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-    }
-  } else {
-    // Right side
-
-    if ((isUpper && isTranspose) || (!isUpper && !isTranspose)) {
-      // Solves the system XA = alpha*B when A is lower triangular
-
-      //         X     *      A                        B
-      //    [ X0  X1 ]   [ A00   0   ]  =  alpha * [ B0  B1 ]
-      //                 [ A10  A11  ]
-      //
-      // yields:
-      //
-      //  X1 = alpha*B1*A11{-1}
-      //  B0 = -1 * X1*A10 + alpha*B0
-      //  X0 = B0*A00{-1}  + 0*X0
-      //
-
-      // True when (lower triangular) or (upper triangular and transposed)
-      const index_t specialBlockSize =
-          (N % blockSize == 0) ? blockSize : (N % blockSize);
-      const index_t iStart = N - specialBlockSize;
-      for (index_t i = iStart; i >= 0; i -= blockSize) {
-        const index_t currentBlockSize =
-            (i == iStart) ? specialBlockSize : blockSize;
-        auto gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, currentBlockSize,
-            currentBlockSize, (i == iStart) ? alpha : element_t{1}, B + i * ldb,
-            ldb, invA + i * blockSize, blockSize, element_t{0}, X + i * ldx,
-            ldx, trsmEvents);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-
-        if ((i - blockSize) < 0) {
-          break;
-        }
-
-        helper::add_const<container_1_t> a_ = X + i * ldx;
-        helper::add_const<container_0_t> b_ =
-            A + (!isTranspose ? i : (i * lda));
-        gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, i, currentBlockSize,
-            element_t{-1}, a_, ldx, b_, lda,
-            (i == iStart) ? alpha : element_t{1}, B, ldb, gemmEvent);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-
-    } else {
-      // Solves the system XA = alpha*B when A is upper triangular
-
-      //      X        *      A                         B
-      //    [ X0  X1 ]   [ A00  A01  ]  =  alpha * [ B0  B1 ]
-      //                 [  0   A11  ]
-      //
-      // yields:
-      //
-      //  X0 = alpha*B0*A00^{-1}
-      //  B1 = -1 * X0*A01 + alpha*B1
-      //  X1 = B1*A11{-1}  + 0*X1
-      //
-
-      // True when (upper triangular) or (lower triangular and transposed)
-      for (index_t i = 0; i < N; i += blockSize) {
-        const index_t currentBlockSize = std::min(N - i, blockSize);
-
-        auto gemmEvent = internal::_gemm(
-            sb_handle, 'n', isTranspose ? 't' : 'n', M, currentBlockSize,
-            currentBlockSize, (i == 0) ? alpha : element_t{1}, B + i * ldb, ldb,
-            invA + i * blockSize, blockSize, element_t{0}, X + i * ldx, ldx,
-            trsmEvents);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-
-        if ((i + blockSize) > N) {
-          break;
-        }
-
-        const std::ptrdiff_t offset = !isTranspose
-                                          ? (i + (blockSize + i) * lda)
-                                          : (i + blockSize) + (i * lda);
-
-        helper::add_const<container_1_t> a_ = X + i * ldx;
-        helper::add_const<container_0_t> b_ = A + offset;
-        gemmEvent =
-            internal::_gemm(sb_handle, 'n', isTranspose ? 't' : 'n', M,
-                            N - i - blockSize, blockSize, element_t{-1}, a_,
-                            ldx, b_, lda, (i == 0) ? alpha : element_t{1},
-                            B + (i + blockSize) * ldb, ldb, gemmEvent);
-        trsmEvents = concatenate_vectors(trsmEvents, gemmEvent);
-      }
-    }
-  }
+  // op(A) is lower triangular when (lower triangular) or (upper triangular
+  // and transposed)
+  const bool isLower = isUpper == isTranspose;
+  trsmEvents = concatenate_vectors(
+      trsmEvents,
+      _trsm_recursive(sb_handle, isLeft, isLower, isUpper, trans, K,
+                      isLeft ? N : M, blockSize, alpha, A, lda, invA, B, ldb,
+                      X, ldx, trsmEvents));
 
   // Copy bufferX to bufferB as the TRSM result
   typename sb_handle_t::event_t lastEvent;
@@ -26,6 +26,12 @@
 
 #include "sb_handle/handle.hpp"
 
+#include "sb_handle/gemm_tuning_cache.hpp"
+
+#include "sb_handle/scalar_result.hpp"
+
+#include "sb_handle/graph.hpp"
+
 #include "sb_handle/kernel_constructor.hpp"
 
 #include "interface/blas1_interface.hpp"
@@ -52,6 +58,8 @@
 
 #include "operations/extension/axpy_batch.hpp"
 
+#include "operations/extension/reduction_batch.hpp"
+
 #include "operations/blas_constants.hpp"
 
 #include "operations/blas_operators.hpp"
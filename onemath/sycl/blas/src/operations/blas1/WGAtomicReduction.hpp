@@ -74,7 +74,7 @@ ONEMATH_SYCL_BLAS_INLINE
 
   // First loop for big arrays
   for (int id = lid; id < size; id += loop_stride) {
-    val = operator_t::eval(val, rhs_.eval(id));
+    val = operator_t::eval(val, static_cast<value_t>(rhs_.eval(id)));
   }
 
   val = sycl::reduce_over_group(ndItem.get_sub_group(), val,
@@ -102,7 +102,7 @@ ONEMATH_SYCL_BLAS_INLINE
 
   // First loop for big arrays
   for (int id = lid; id < size; id += loop_stride) {
-    val = operator_t::eval(val, rhs_.eval(id));
+    val = operator_t::eval(val, static_cast<value_t>(rhs_.eval(id)));
   }
 
   val = sycl::reduce_over_group(ndItem.get_sub_group(), val,
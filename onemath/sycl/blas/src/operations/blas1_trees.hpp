@@ -85,6 +85,17 @@ struct DetectScalar<sycl::half> {
   static element_t get_scalar(element_t &scalar) { return scalar; }
 };
 
+#ifdef BLAS_ENABLE_BFLOAT16
+/*! DetectScalar.
+ * @brief See Detect Scalar.
+ */
+template <>
+struct DetectScalar<bfloat16> {
+  using element_t = bfloat16;
+  static element_t get_scalar(element_t &scalar) { return scalar; }
+};
+#endif
+
 #ifdef BLAS_ENABLE_COMPLEX
 /*! DetectScalar (for sycl::complex<value_t>)
  * @brief See Detect Scalar.
@@ -180,6 +191,14 @@ Assign<lhs_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
   return Assign<lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 
+template <typename lhs_t, typename rhs_t>
+template <int packet_size>
+ONEMATH_SYCL_BLAS_INLINE void Assign<lhs_t, rhs_t>::eval_packet(
+    typename Assign<lhs_t, rhs_t>::index_t i) {
+  lhs_.template store_packet<packet_size>(
+      i, rhs_.template eval_packet<packet_size>(i));
+}
+
 template <typename lhs_t, typename rhs_t>
 ONEMATH_SYCL_BLAS_INLINE void Assign<lhs_t, rhs_t>::bind(sycl::handler &h) {
   lhs_.bind(h);
@@ -237,6 +256,20 @@ ONEMATH_SYCL_BLAS_INLINE
   return DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::eval(
       ndItem.get_global_id(0));
 }
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+template <int packet_size>
+ONEMATH_SYCL_BLAS_INLINE void
+DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::eval_packet(
+    typename DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::index_t i) {
+  // Both sides are read before writing, as in eval, for swap
+  auto val1 = rhs_1_.template eval_packet<packet_size>(i);
+  auto val2 = rhs_2_.template eval_packet<packet_size>(i);
+  lhs_1_.template store_packet<packet_size>(i, val1);
+  lhs_2_.template store_packet<packet_size>(i, val2);
+}
+
 template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
           typename rhs_2_t>
 ONEMATH_SYCL_BLAS_INLINE void DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::bind(
@@ -288,6 +321,20 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
   return ScalarOp<operator_t, scalar_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename scalar_t, typename rhs_t>
+template <int packet_size>
+ONEMATH_SYCL_BLAS_INLINE sycl::vec<
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::value_t, packet_size>
+ScalarOp<operator_t, scalar_t, rhs_t>::eval_packet(
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::index_t i) {
+  const auto scalar = internal::get_scalar(scalar_);
+  auto packet = rhs_.template eval_packet<packet_size>(i);
+#pragma unroll
+  for (int k = 0; k < packet_size; ++k) {
+    packet[k] = operator_t::eval(scalar, packet[k]);
+  }
+  return packet;
+}
+template <typename operator_t, typename scalar_t, typename rhs_t>
 ONEMATH_SYCL_BLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     sycl::handler &h) {
   rhs_.bind(h);
@@ -329,6 +376,19 @@ UnaryOp<operator_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
   return UnaryOp<operator_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename rhs_t>
+template <int packet_size>
+ONEMATH_SYCL_BLAS_INLINE
+    sycl::vec<typename UnaryOp<operator_t, rhs_t>::value_t, packet_size>
+    UnaryOp<operator_t, rhs_t>::eval_packet(
+        typename UnaryOp<operator_t, rhs_t>::index_t i) {
+  auto packet = rhs_.template eval_packet<packet_size>(i);
+#pragma unroll
+  for (int k = 0; k < packet_size; ++k) {
+    packet[k] = operator_t::eval(packet[k]);
+  }
+  return packet;
+}
+template <typename operator_t, typename rhs_t>
 ONEMATH_SYCL_BLAS_INLINE void UnaryOp<operator_t, rhs_t>::bind(sycl::handler &h) {
   rhs_.bind(h);
 }
@@ -367,6 +427,20 @@ BinaryOp<operator_t, lhs_t, rhs_t>::eval(sycl::nd_item<1> ndItem) {
   return BinaryOp<operator_t, lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename lhs_t, typename rhs_t>
+template <int packet_size>
+ONEMATH_SYCL_BLAS_INLINE sycl::vec<
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::value_t, packet_size>
+BinaryOp<operator_t, lhs_t, rhs_t>::eval_packet(
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::index_t i) {
+  const auto lhs_packet = lhs_.template eval_packet<packet_size>(i);
+  auto packet = rhs_.template eval_packet<packet_size>(i);
+#pragma unroll
+  for (int k = 0; k < packet_size; ++k) {
+    packet[k] = operator_t::eval(lhs_packet[k], packet[k]);
+  }
+  return packet;
+}
+template <typename operator_t, typename lhs_t, typename rhs_t>
 ONEMATH_SYCL_BLAS_INLINE void BinaryOp<operator_t, lhs_t, rhs_t>::bind(
     sycl::handler &h) {
   lhs_.bind(h);
@@ -461,6 +535,64 @@ ONEMATH_SYCL_BLAS_INLINE void TupleOp<rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! Vectorized.
+ * @brief See Vectorized in blas1_trees.h.
+ */
+template <int vector_size, int unroll, typename tree_t>
+Vectorized<vector_size, unroll, tree_t>::Vectorized(tree_t &_t) : tree_(_t) {}
+
+template <int vector_size, int unroll, typename tree_t>
+ONEMATH_SYCL_BLAS_INLINE typename Vectorized<vector_size, unroll, tree_t>::index_t
+Vectorized<vector_size, unroll, tree_t>::get_size() const {
+  return tree_.get_size();
+}
+
+template <int vector_size, int unroll, typename tree_t>
+ONEMATH_SYCL_BLAS_INLINE bool Vectorized<vector_size, unroll, tree_t>::valid_thread(
+    sycl::nd_item<1>) const {
+  // The grid-stride loop covers the whole vector with any global size
+  return true;
+}
+
+template <int vector_size, int unroll, typename tree_t>
+ONEMATH_SYCL_BLAS_INLINE void Vectorized<vector_size, unroll, tree_t>::eval(
+    sycl::nd_item<1> ndItem) {
+  const index_t size = tree_.get_size();
+  const index_t id = static_cast<index_t>(ndItem.get_global_id(0));
+  const index_t stride = static_cast<index_t>(ndItem.get_global_range(0));
+  const index_t num_packets = size / vector_size;
+
+  // Consecutive work items access consecutive packets, so the accesses of a
+  // sub-group stay contiguous
+  for (index_t packet = id; packet < num_packets; packet += stride * unroll) {
+#pragma unroll
+    for (int u = 0; u < unroll; ++u) {
+      const index_t p = packet + u * stride;
+      if (p < num_packets) {
+        tree_.template eval_packet<vector_size>(p * vector_size);
+      }
+    }
+  }
+
+  // Fewer than vector_size elements remain
+  const index_t tail = num_packets * vector_size + id;
+  if (tail < size) {
+    tree_.template eval_packet<1>(tail);
+  }
+}
+
+template <int vector_size, int unroll, typename tree_t>
+ONEMATH_SYCL_BLAS_INLINE void Vectorized<vector_size, unroll, tree_t>::bind(
+    sycl::handler &h) {
+  tree_.bind(h);
+}
+
+template <int vector_size, int unroll, typename tree_t>
+ONEMATH_SYCL_BLAS_INLINE void
+Vectorized<vector_size, unroll, tree_t>::adjust_access_displacement() {
+  tree_.adjust_access_displacement();
+}
+
 /*! AssignReduction.
  * @brief Implements the reduction operation for assignments (in the form y
  * = x) with y a scalar and x a subexpression tree.
@@ -574,6 +706,127 @@ AssignReduction<operator_t, lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! SinglePassReduction.
+ * @brief Implements the reduction of x into the scalar y in a single kernel,
+ * the last work group to finish reducing the results of the others.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t,
+                    counter_t>::SinglePassReduction(lhs_t &_l, rhs_t &_r,
+                                                    partials_t &_partials,
+                                                    counter_t &_counter)
+    : lhs_(_l), rhs_(_r), partials_(_partials), counter_(_counter) {}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE typename SinglePassReduction<
+    operator_t, lhs_t, rhs_t, partials_t, counter_t>::index_t
+SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t,
+                    counter_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE bool
+SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t,
+                    counter_t>::valid_thread(sycl::nd_item<1>) const {
+  return true;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+template <typename sharedT>
+ONEMATH_SYCL_BLAS_INLINE typename SinglePassReduction<
+    operator_t, lhs_t, rhs_t, partials_t, counter_t>::value_t
+SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t, counter_t>::
+    reduce_work_group(sharedT scratch, sycl::nd_item<1> ndItem, value_t val) {
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  scratch[localid] = val;
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(sycl::access::fence_space::local_space);
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    ndItem.barrier(sycl::access::fence_space::local_space);
+  }
+  return scratch[0];
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+template <typename sharedT>
+ONEMATH_SYCL_BLAS_INLINE typename SinglePassReduction<
+    operator_t, lhs_t, rhs_t, partials_t, counter_t>::value_t
+SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t, counter_t>::eval(
+    sharedT scratch, sycl::nd_item<1> ndItem) {
+  const index_t localid = ndItem.get_local_id(0);
+  const index_t localSz = ndItem.get_local_range(0);
+  const index_t groupid = ndItem.get_group(0);
+  const index_t num_groups = ndItem.get_group_range(0);
+  const index_t vecS = rhs_.get_size();
+
+  const value_t init_val = operator_t::template init<rhs_t>();
+  value_t val = init_val;
+  for (index_t k = ndItem.get_global_id(0); k < vecS;
+       k += localSz * num_groups) {
+    val = operator_t::eval(val, rhs_.eval(k));
+  }
+  val = reduce_work_group(scratch, ndItem, val);
+
+  auto counter =
+      sycl::atomic_ref<uint32_t, sycl::memory_order::acq_rel,
+                       sycl::memory_scope::device,
+                       sycl::access::address_space::global_space>(
+          counter_.get_data()[0]);
+  bool is_last = false;
+  if (localid == 0) {
+    partials_.eval(groupid) = val;
+    // Releases the partial result, acquires the others if last
+    is_last = counter.fetch_add(1u) == static_cast<uint32_t>(num_groups - 1);
+  }
+  is_last = sycl::group_broadcast(ndItem.get_group(), is_last);
+  if (!is_last) {
+    return val;
+  }
+
+  sycl::atomic_fence(sycl::memory_order::acquire, sycl::memory_scope::device);
+  val = init_val;
+  for (index_t k = localid; k < num_groups; k += localSz) {
+    val = operator_t::eval(val, partials_.eval(k));
+  }
+  val = reduce_work_group(scratch, ndItem, val);
+  if (localid == 0) {
+    lhs_.eval(0) = val;
+  }
+  return val;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE void SinglePassReduction<
+    operator_t, lhs_t, rhs_t, partials_t, counter_t>::bind(sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+  partials_.bind(h);
+  counter_.bind(h);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE void
+SinglePassReduction<operator_t, lhs_t, rhs_t, partials_t,
+                    counter_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+  partials_.adjust_access_displacement();
+  counter_.adjust_access_displacement();
+}
+
 template <typename operand_t>
 Rotg<operand_t>::Rotg(operand_t &_a, operand_t &_b, operand_t &_c,
                       operand_t &_s)
@@ -23,6 +23,7 @@
 #ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_COMMON_HPP
 #define ONEMATH_SYCL_BLAS_BLAS3_GEMM_COMMON_HPP
 
+#include "gemm_epilogue.hpp"
 #include "operations/blas3_trees.h"
 #include "views/view.h"
 #include <string>
@@ -48,11 +49,14 @@ mul_add(Tin a, Tin b, Tout c,
   return (sycl::mad(a, b, c));
 }
 
+// Mixed precision: the inputs are widened to the accumulator type before the
+// product, e.g. half or bfloat16 into float and int8_t into int32_t
 template <typename Tin, typename Tout>
 static ONEMATH_SYCL_BLAS_INLINE Tout
 mul_add(Tin a, Tin b, Tout c,
         typename std::enable_if<!std::is_same<Tin, Tout>::value &&
-                                is_sycl_scalar<Tin>::value>::type * = 0) {
+                                (is_sycl_scalar<Tin>::value ||
+                                 is_bfloat16<Tin>::value)>::type * = 0) {
   return static_cast<Tout>(a) * static_cast<Tout>(b) + c;
 }
 
@@ -69,6 +73,8 @@ struct type_string {
 
 ENABLE_TYPE_STRING(float)
 ENABLE_TYPE_STRING(double)
+ENABLE_TYPE_STRING(int8_t)
+ENABLE_TYPE_STRING(int32_t)
 
 #undef ENABLE_TYPE_STRING
 
@@ -94,6 +100,15 @@ Tile<ItemRows, ItemCols, WgRows, WgCols, SgRows, SgCols, TlRows, TlCols,
   return str.str();
 }
 
+template <int MR, int NR, int MC, int KC, int NC>
+ONEMATH_SYCL_BLAS_INLINE std::string
+Cpu_Tile<MR, NR, MC, KC, NC>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "Cpu_Tile<" << MR << ", " << NR << ", " << MC << ", " << KC << ", "
+      << NC << ">";
+  return str.str();
+}
+
 /*!
  * Optionally avoid evaluating the expression given as input.
  *
@@ -0,0 +1,315 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_CPU_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_GEMM_CPU_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::GemmCpu(input_t A, input_t B, output_t C,
+                              element_t alpha, element_t beta,
+                              index_t batch_size, index_t stride_a,
+                              index_t stride_b, index_t stride_c,
+                              index_t block_m, index_t block_n, index_t num_wg,
+                              workspace_t workspace)
+    : a_(A),
+      b_(B),
+      c_(C),
+      workspace_(workspace),
+      alpha_(alpha),
+      beta_(beta),
+      m_(a_.get_size_row()),
+      n_(b_.get_size_col()),
+      k_(a_.get_size_col()),
+      lda_(a_.getSizeL()),
+      ldb_(b_.getSizeL()),
+      ldc_(c_.getSizeL()),
+      batch_size_(batch_size),
+      stridea_(stride_a),
+      strideb_(stride_b),
+      stridec_(stride_c),
+      block_m_(block_m),
+      block_n_(block_n),
+      num_wg_(num_wg) {}
+
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE std::string
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "GemmCpu <" << tile_type::get_type_string() << ", "
+      << type_string<value_t>::get_value() << "_"
+      << type_string<element_t>::get_value() << ", " << TransA << ", "
+      << TransB << ">";
+  return str.str();
+}
+
+/*!
+ * @brief Computes the blocks of C and the number of work groups. The blocks
+ * start at MC x NC and are halved, the widest dimension first, until there is
+ * a block of C (of any batch) per compute unit or they are a single
+ * micro-tile.
+ *
+ * @return the number of work groups, at most one per compute unit
+ */
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE typename GemmCpu<input_t, output_t, tile_type, TransA,
+                                          TransB, element_t, is_beta_zero,
+                                          workspace_t>::index_t
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::get_blocking(index_t compute_units, index_t m,
+                                   index_t n, index_t batch_size,
+                                   index_t& block_m,
+                                   index_t& block_n) noexcept {
+  const auto round_up = [](index_t x, index_t multiple) {
+    return ((x - 1) / multiple + 1) * multiple;
+  };
+  const auto num_blocks = [&]() {
+    return batch_size * ((m - 1) / block_m + 1) * ((n - 1) / block_n + 1);
+  };
+  block_m = std::min(mc, round_up(std::max(m, index_t(1)), mr));
+  block_n = std::min(nc, round_up(std::max(n, index_t(1)), nr));
+  while (num_blocks() < compute_units) {
+    if (block_n > nr && (block_n >= block_m || block_m == mr)) {
+      block_n = round_up(block_n / 2, nr);
+    } else if (block_m > mr) {
+      block_m = round_up(block_m / 2, mr);
+    } else {
+      break;
+    }
+  }
+  return std::max(index_t(1), std::min(compute_units, num_blocks()));
+}
+
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::get_nd_range() const noexcept {
+  return sycl::nd_range<1>(sycl::range<1>(num_wg_), sycl::range<1>(1));
+}
+
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE bool
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::valid_thread(const sycl::nd_item<1>&) const {
+  return true;
+}
+
+/*!
+ * @brief Loops over the blocks of C of the work group. For each KC deep slice
+ * of K, the panels of A and B are packed, then the micro-kernel runs on each
+ * micro-panel of B (kept in L1) and each micro-panel of A (streamed from L2).
+ */
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::eval(sycl::nd_item<1> id) noexcept {
+  const index_t wg_id = id.get_group(0);
+  const index_t tiles_m = (m_ - 1) / block_m_ + 1;
+  const index_t tiles_per_matrix = tiles_m * ((n_ - 1) / block_n_ + 1);
+  auto packed_a = workspace_.get_pointer() + wg_id * workspace_size_per_wg;
+  auto packed_b = packed_a + mc * kc;
+
+  for (index_t block = wg_id; block < batch_size_ * tiles_per_matrix;
+       block += num_wg_) {
+    const index_t batch = block / tiles_per_matrix;
+    const index_t tile = block % tiles_per_matrix;
+    const index_t row_start = (tile % tiles_m) * block_m_;
+    const index_t col_start = (tile / tiles_m) * block_n_;
+    const index_t rows = std::min(block_m_, m_ - row_start);
+    const index_t cols = std::min(block_n_, n_ - col_start);
+
+    // A single empty slice when K is zero, so that C is still scaled by beta
+    for (index_t k_start = 0; k_start < k_ || k_start == 0; k_start += kc) {
+      const index_t depth = std::min(kc, k_ - k_start);
+      pack_a(packed_a, batch * stridea_, row_start, k_start, rows, depth);
+      pack_b(packed_b, batch * strideb_, k_start, col_start, depth, cols);
+      for (index_t j = 0; j < cols; j += nr) {
+        for (index_t i = 0; i < rows; i += mr) {
+          micro_kernel(packed_a + i * depth, packed_b + j * depth, depth,
+                       batch * stridec_, row_start + i, col_start + j,
+                       std::min(mr, rows - i), std::min(nr, cols - j),
+                       k_start == 0);
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * @brief Packs the rows x depth panel of A in micro-panels of MR rows, each
+ * stored k-major and zero-padded to MR rows.
+ */
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+template <typename ptr_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::pack_a(ptr_t packed, index_t offset, index_t row_start,
+                             index_t k_start, index_t rows,
+                             index_t depth) noexcept {
+  const auto A = a_.get_pointer() + offset;
+  for (index_t panel = 0; panel < rows; panel += mr) {
+    auto out = packed + panel * depth;
+    for (index_t k = 0; k < depth; ++k) {
+#pragma unroll
+      for (index_t i = 0; i < mr; ++i) {
+        const index_t row = row_start + panel + i;
+        const index_t col = k_start + k;
+        out[k * mr + i] =
+            panel + i < rows
+                ? static_cast<element_t>(
+                      A[TransA ? row * lda_ + col : col * lda_ + row])
+                : element_t{0};
+      }
+    }
+  }
+}
+
+/*!
+ * @brief Packs the depth x cols panel of B in micro-panels of NR columns,
+ * each stored k-major and zero-padded to NR columns.
+ */
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+template <typename ptr_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::pack_b(ptr_t packed, index_t offset, index_t k_start,
+                             index_t col_start, index_t depth,
+                             index_t cols) noexcept {
+  const auto B = b_.get_pointer() + offset;
+  for (index_t panel = 0; panel < cols; panel += nr) {
+    auto out = packed + panel * depth;
+    for (index_t k = 0; k < depth; ++k) {
+#pragma unroll
+      for (index_t j = 0; j < nr; ++j) {
+        const index_t row = k_start + k;
+        const index_t col = col_start + panel + j;
+        out[k * nr + j] =
+            panel + j < cols
+                ? static_cast<element_t>(
+                      B[TransB ? row * ldb_ + col : col * ldb_ + row])
+                : element_t{0};
+      }
+    }
+  }
+}
+
+/*!
+ * @brief Computes an MR x NR micro-tile of C from a micro-panel of A and one
+ * of B. The NR columns of the micro-tile are held in sycl::vec registers of
+ * MR elements, as C is column major. The first slice of K applies beta,
+ * the following ones accumulate to C.
+ */
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+template <typename ptr_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::micro_kernel(ptr_t packed_a, ptr_t packed_b,
+                                   index_t depth, index_t c_offset,
+                                   index_t row, index_t col, index_t rows,
+                                   index_t cols, bool first_k) noexcept {
+  using vector_t = sycl::vec<element_t, mr>;
+  using address_t = sycl::access::address_space;
+  vector_t reg_res[nr];
+#pragma unroll
+  for (index_t j = 0; j < nr; ++j) {
+    reg_res[j] = vector_t(element_t{0});
+  }
+
+  for (index_t k = 0; k < depth; ++k) {
+    vector_t reg_a;
+    reg_a.load(0, sycl::multi_ptr<element_t, address_t::global_space>(
+                      packed_a + k * mr));
+#pragma unroll
+    for (index_t j = 0; j < nr; ++j) {
+      reg_res[j] += reg_a * packed_b[k * nr + j];
+    }
+  }
+
+  auto C = c_.get_pointer() + c_offset;
+#pragma unroll
+  for (index_t j = 0; j < nr; ++j) {
+    if (j < cols) {
+      for (index_t i = 0; i < rows; ++i) {
+        const index_t idx = (col + j) * ldc_ + row + i;
+        const element_t res = alpha_ * reg_res[j][i];
+        if (!first_k) {
+          C[idx] = static_cast<element_t>(C[idx]) + res;
+        } else if (is_beta_zero) {
+          C[idx] = res;
+        } else {
+          C[idx] = res + beta_ * static_cast<element_t>(C[idx]);
+        }
+      }
+    }
+  }
+}
+
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::bind(sycl::handler& h) {
+  a_.bind(h);
+  b_.bind(h);
+  c_.bind(h);
+  workspace_.bind(h);
+}
+
+template <typename input_t, typename output_t, typename tile_type, bool TransA,
+          bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmCpu<input_t, output_t, tile_type, TransA, TransB, element_t, is_beta_zero,
+        workspace_t>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+  workspace_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_CPU_HPP
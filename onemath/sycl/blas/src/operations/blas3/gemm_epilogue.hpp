@@ -0,0 +1,123 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_EPILOGUE_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_GEMM_EPILOGUE_HPP
+
+#include "blas_meta.h"
+#include "operations/blas3_trees.h"
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+template <gemm_bias_t Bias, gemm_activation_t Activation, typename element_t,
+          typename index_t, typename bias_t, typename residual_t>
+ONEMATH_SYCL_BLAS_INLINE
+Gemm_Epilogue<Bias, Activation, element_t, index_t, bias_t,
+              residual_t>::Gemm_Epilogue(bias_t bias, index_t stride_bias,
+                                         residual_t residual,
+                                         index_t stride_residual,
+                                         element_t scale, element_t clamp_min,
+                                         element_t clamp_max)
+    : bias_(bias),
+      residual_(residual),
+      stride_bias_(stride_bias),
+      stride_residual_(stride_residual),
+      scale_(scale),
+      clamp_min_(clamp_min),
+      clamp_max_(clamp_max) {}
+
+template <gemm_bias_t Bias, gemm_activation_t Activation, typename element_t,
+          typename index_t, typename bias_t, typename residual_t>
+ONEMATH_SYCL_BLAS_INLINE element_t
+Gemm_Epilogue<Bias, Activation, element_t, index_t, bias_t, residual_t>::eval(
+    element_t value, index_t row, index_t col, index_t batch) const noexcept {
+  if constexpr (Bias == gemm_bias_t::row) {
+    value += bias_.get_pointer()[batch * stride_bias_ + row];
+  } else if constexpr (Bias == gemm_bias_t::column) {
+    value += bias_.get_pointer()[batch * stride_bias_ + col];
+  }
+
+  if constexpr (Activation == gemm_activation_t::relu) {
+    value = value > element_t{0} ? value : element_t{0};
+  } else if constexpr (Activation == gemm_activation_t::gelu) {
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+    const element_t inner = element_t{0.7978845608028654} *
+                            (value + element_t{0.044715} * value * value *
+                                         value);
+    value = element_t{0.5} * value * (element_t{1} + sycl::tanh(inner));
+  } else if constexpr (Activation == gemm_activation_t::clamp) {
+    value = value < clamp_min_ ? clamp_min_
+                               : (value > clamp_max_ ? clamp_max_ : value);
+  }
+
+  value *= scale_;
+
+  if constexpr (has_residual) {
+    value += residual_.get_pointer()[batch * stride_residual_ + row +
+                                     col * residual_.getSizeL()];
+  }
+  return value;
+}
+
+template <gemm_bias_t Bias, gemm_activation_t Activation, typename element_t,
+          typename index_t, typename bias_t, typename residual_t>
+ONEMATH_SYCL_BLAS_INLINE void
+Gemm_Epilogue<Bias, Activation, element_t, index_t, bias_t, residual_t>::bind(
+    sycl::handler& h) {
+  bias_.bind(h);
+  residual_.bind(h);
+}
+
+template <gemm_bias_t Bias, gemm_activation_t Activation, typename element_t,
+          typename index_t, typename bias_t, typename residual_t>
+ONEMATH_SYCL_BLAS_INLINE void
+Gemm_Epilogue<Bias, Activation, element_t, index_t, bias_t,
+              residual_t>::adjust_access_displacement() {
+  bias_.adjust_access_displacement();
+  residual_.adjust_access_displacement();
+}
+
+template <typename element_t, typename scale_t, typename index_t>
+ONEMATH_SYCL_BLAS_INLINE
+Gemm_Epilogue_Requantize<element_t, scale_t, index_t>::Gemm_Epilogue_Requantize(
+    scale_t scale, element_t zero_point, element_t q_min, element_t q_max)
+    : scale_(scale), zero_point_(zero_point), q_min_(q_min), q_max_(q_max) {}
+
+template <typename element_t, typename scale_t, typename index_t>
+ONEMATH_SYCL_BLAS_INLINE element_t
+Gemm_Epilogue_Requantize<element_t, scale_t, index_t>::eval(
+    element_t value, index_t, index_t, index_t) const noexcept {
+  const scale_t scaled =
+      sycl::rint(static_cast<scale_t>(value) * scale_) +
+      static_cast<scale_t>(zero_point_);
+  // Saturated in scale_t, before the conversion can overflow element_t
+  return scaled < static_cast<scale_t>(q_min_)
+             ? q_min_
+             : (scaled > static_cast<scale_t>(q_max_)
+                    ? q_max_
+                    : static_cast<element_t>(scaled));
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_EPILOGUE_HPP
@@ -0,0 +1,192 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_GROUPED_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_GEMM_GROUPED_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename value_t, typename out_t, typename element_t,
+          typename index_t, int ClSize, typename tile_type>
+GemmGrouped<value_t, out_t, element_t, index_t, ClSize,
+            tile_type>::GemmGrouped(const group_t* groups, index_t group_count,
+                                    const value_t* const* a,
+                                    const value_t* const* b, out_t* const* c,
+                                    index_t num_tiles)
+    : groups_(groups),
+      group_count_(group_count),
+      a_(a),
+      b_(b),
+      c_(c),
+      num_tiles_(num_tiles) {}
+
+template <typename value_t, typename out_t, typename element_t,
+          typename index_t, int ClSize, typename tile_type>
+ONEMATH_SYCL_BLAS_INLINE std::string
+GemmGrouped<value_t, out_t, element_t, index_t, ClSize,
+            tile_type>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "GemmGrouped <" << ClSize << ", " << tile_type::get_type_string()
+      << ", " << type_string<value_t>::get_value() << "_"
+      << type_string<element_t>::get_value() << ">";
+  return str.str();
+}
+
+/*!
+ * @brief The kernel is persistent, a few work groups per compute unit loop
+ * over the tiles of all the groups.
+ */
+template <typename value_t, typename out_t, typename element_t,
+          typename index_t, int ClSize, typename tile_type>
+ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
+GemmGrouped<value_t, out_t, element_t, index_t, ClSize,
+            tile_type>::get_nd_range(index_t compute_units) const noexcept {
+  constexpr index_t wg_per_compute_unit = 4;
+  const index_t num_wg =
+      std::min(num_tiles_, compute_units * wg_per_compute_unit);
+  return sycl::nd_range<1>(sycl::range<1>(num_wg * wg_size),
+                           sycl::range<1>(wg_size));
+}
+
+template <typename value_t, typename out_t, typename element_t,
+          typename index_t, int ClSize, typename tile_type>
+ONEMATH_SYCL_BLAS_INLINE bool
+GemmGrouped<value_t, out_t, element_t, index_t, ClSize,
+            tile_type>::valid_thread(const sycl::nd_item<1>&) const {
+  return true;
+}
+
+template <typename value_t, typename out_t, typename element_t,
+          typename index_t, int ClSize, typename tile_type>
+template <typename local_memory_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmGrouped<value_t, out_t, element_t, index_t, ClSize, tile_type>::eval(
+    local_memory_t scratch_acc, sycl::nd_item<1> id) noexcept {
+  auto scratch = scratch_acc.localAcc.get_pointer();
+  // The A block is stored with its rows contiguous and the B block with its
+  // depth contiguous, as they are read from non-transposed A and B
+  auto s_a = scratch;
+  auto s_b = scratch + block_rows * block_k;
+
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+  const index_t num_wg = id.get_group_range(0);
+
+  for (index_t tile = id.get_group(0); tile < num_tiles_; tile += num_wg) {
+    // The group of the tile is the last one starting at or before it, the
+    // groups without tiles start at the same tile as the next one
+    index_t lo = 0;
+    index_t hi = group_count_ - 1;
+    while (lo < hi) {
+      const index_t mid = (lo + hi + 1) / 2;
+      if (groups_[mid].first_tile <= tile) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    const group_t group = groups_[lo];
+    const index_t tiles_per_matrix = group.tiles_m * group.tiles_n;
+    const index_t tile_in_group = tile - group.first_tile;
+    const index_t matrix =
+        group.first_matrix + tile_in_group / tiles_per_matrix;
+    const index_t tile_in_matrix = tile_in_group % tiles_per_matrix;
+    const index_t row_start = (tile_in_matrix % group.tiles_m) * block_rows;
+    const index_t col_start = (tile_in_matrix / group.tiles_m) * block_cols;
+
+    const value_t* A = a_[matrix];
+    const value_t* B = b_[matrix];
+    out_t* C = c_[matrix];
+
+    element_t reg_res[item_rows * item_cols];
+#pragma unroll
+    for (index_t i = 0; i < item_rows * item_cols; ++i) {
+      reg_res[i] = element_t{0};
+    }
+
+    for (index_t k_start = 0; k_start < group.k; k_start += block_k) {
+      // Cooperative loads of the A and B blocks, zero-padded at the edges
+      for (index_t idx = item_id; idx < block_rows * block_k;
+           idx += wg_size) {
+        const index_t row = row_start + idx % block_rows;
+        const index_t k = k_start + idx / block_rows;
+        s_a[idx] = (row < group.m && k < group.k)
+                       ? A[group.trans_a ? row * group.lda + k
+                                         : k * group.lda + row]
+                       : value_t{0};
+      }
+      for (index_t idx = item_id; idx < block_k * block_cols;
+           idx += wg_size) {
+        const index_t k = k_start + idx % block_k;
+        const index_t col = col_start + idx / block_k;
+        s_b[idx] = (col < group.n && k < group.k)
+                       ? B[group.trans_b ? k * group.ldb + col
+                                         : col * group.ldb + k]
+                       : value_t{0};
+      }
+      sycl::group_barrier(id.get_group());
+
+#pragma unroll
+      for (index_t k = 0; k < block_k; ++k) {
+        value_t reg_a[item_rows];
+#pragma unroll
+        for (index_t i = 0; i < item_rows; ++i) {
+          reg_a[i] = s_a[k * block_rows + item_row + i * wg_rows];
+        }
+#pragma unroll
+        for (index_t j = 0; j < item_cols; ++j) {
+          const value_t b = s_b[(item_col + j * wg_cols) * block_k + k];
+#pragma unroll
+          for (index_t i = 0; i < item_rows; ++i) {
+            reg_res[j * item_rows + i] =
+                mul_add(reg_a[i], b, reg_res[j * item_rows + i]);
+          }
+        }
+      }
+      sycl::group_barrier(id.get_group());
+    }
+
+#pragma unroll
+    for (index_t j = 0; j < item_cols; ++j) {
+      const index_t col = col_start + item_col + j * wg_cols;
+#pragma unroll
+      for (index_t i = 0; i < item_rows; ++i) {
+        const index_t row = row_start + item_row + i * wg_rows;
+        if (row < group.m && col < group.n) {
+          out_t* out = C + col * group.ldc + row;
+          // C is not read when beta is zero, as for the other gemm kernels
+          *out = group.beta == element_t{0}
+                     ? group.alpha * reg_res[j * item_rows + i]
+                     : group.alpha * reg_res[j * item_rows + i] +
+                           group.beta * static_cast<element_t>(*out);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_GROUPED_HPP
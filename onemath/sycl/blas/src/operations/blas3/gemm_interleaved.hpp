@@ -24,6 +24,7 @@
 #define ONEMATH_SYCL_BLAS_BLAS3_GEMM_INTERLEAVED_HPP
 
 #include "gemm_common.hpp"
+#include "gemm_load_store.hpp"
 
 namespace blas {
 
@@ -63,7 +64,12 @@ ONEMATH_SYCL_BLAS_INLINE void store(T packet, PtrT ptr) {
 template <address_t Address = address_t::global_space, class T, int Dim,
           class PtrT>
 ONEMATH_SYCL_BLAS_INLINE void load(sycl::vec<T, Dim> &packet, PtrT ptr) {
-  packet.template load<Address>(0, sycl::multi_ptr<const T, Address>(ptr));
+  if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<PtrT>>,
+                               T>) {
+    packet.template load<Address>(0, sycl::multi_ptr<const T, Address>(ptr));
+  } else {
+    load_converted<Address>(packet, ptr);
+  }
 }
 
 /*!
@@ -72,7 +78,11 @@ ONEMATH_SYCL_BLAS_INLINE void load(sycl::vec<T, Dim> &packet, PtrT ptr) {
 template <address_t Address = address_t::global_space, class T, int Dim,
           class PtrT>
 ONEMATH_SYCL_BLAS_INLINE void store(const sycl::vec<T, Dim> &packet, PtrT ptr) {
-  packet.template store<Address>(0, sycl::multi_ptr<T, Address>(ptr));
+  if constexpr (std::is_same_v<std::remove_pointer_t<PtrT>, T>) {
+    packet.template store<Address>(0, sycl::multi_ptr<T, Address>(ptr));
+  } else {
+    store_converted<Address>(packet, ptr);
+  }
 }
 
 }  // namespace internal
@@ -147,6 +157,9 @@ class Gemm<input_t, output_t, /* DoubleBuffer = */ false, /* NbcA = */ false,
   static_assert(item_batchs % VectorSize == 0,
                 "Item batch must be divisible by vector size");
 
+  static_assert(VectorSize == 1 || is_sycl_scalar<value_t>::value,
+                "Interleaved GEMM only vectorizes sycl::vec element types");
+
 #ifdef BLAS_ENABLE_COMPLEX
   static_assert(!is_complex_sycl<value_t>::value,
                 "Interleaved GEMM is not supported for Complex Data types");
@@ -452,7 +465,9 @@ class Gemm<input_t, output_t, /* DoubleBuffer = */ false, /* NbcA = */ false,
               auto is_in = do_check<need_check_boundary>(
                   boundary_check(mb_start + (b * wg_batchs) + p, batch_size_));
               reinterpret_cast<element_t *>(reg_res)[p] =
-                  is_in ? element_t{output[b * wg_batchs + p] * beta_}
+                  is_in ? element_t{static_cast<element_t>(
+                                        output[b * wg_batchs + p]) *
+                                    beta_}
                         : element_t{0};
             }
             ++reg_res;
@@ -502,12 +517,21 @@ class Gemm<input_t, output_t, /* DoubleBuffer = */ false, /* NbcA = */ false,
             *reg_res =
                 sycl::mad(reg_a[j * (item_batchs / VectorSize) + b],
                           reg_b[i * (item_batchs / VectorSize) + b], *reg_res);
+          } else if constexpr (VectorSize == 1 &&
+                               !std::is_same_v<value_t, element_t>) {
+            *reg_res = mul_add(reg_a[j * (item_batchs / VectorSize) + b],
+                               reg_b[i * (item_batchs / VectorSize) + b],
+                               *reg_res);
           } else {
+            // The products are computed in element_t for mixed precision
 #pragma unroll
             for (int v = 0; v < VectorSize; ++v) {
-              (*reg_res)[v] = reg_a[j * (item_batchs / VectorSize) + b][v] *
-                                  reg_b[i * (item_batchs / VectorSize) + b][v] +
-                              (*reg_res)[v];
+              (*reg_res)[v] =
+                  static_cast<element_t>(
+                      reg_a[j * (item_batchs / VectorSize) + b][v]) *
+                      static_cast<element_t>(
+                          reg_b[i * (item_batchs / VectorSize) + b][v]) +
+                  (*reg_res)[v];
             }
           }
           ++reg_res;
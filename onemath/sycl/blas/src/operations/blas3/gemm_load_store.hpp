@@ -25,6 +25,79 @@
 
 namespace blas {
 
+/*! @brief Element type of the sycl::vec used to move packets of value_t.
+ * sycl::vec doesn't accept bfloat16, whose packets are moved as their 16-bit
+ * storage and reinterpreted element-wise.
+ */
+template <typename value_t>
+struct PacketValue {
+  using type = value_t;
+};
+
+#ifdef BLAS_ENABLE_BFLOAT16
+template <>
+struct PacketValue<bfloat16> {
+  using type = uint16_t;
+};
+#endif
+
+/*! @brief Wraps a pointer to value_t in the multi_ptr used by the
+ * sycl::vec::store of its packets.
+ */
+template <sycl::access::address_space address_space, typename value_t>
+ONEMATH_SYCL_BLAS_INLINE auto packet_ptr(value_t *ptr) {
+  using packet_value_t = typename PacketValue<value_t>::type;
+  return sycl::multi_ptr<packet_value_t, address_space>(
+      reinterpret_cast<packet_value_t *>(ptr));
+}
+
+/*! @brief Wraps a pointer to value_t in the multi_ptr used by the
+ * sycl::vec::load of its packets.
+ */
+template <sycl::access::address_space address_space, typename value_t>
+ONEMATH_SYCL_BLAS_INLINE auto const_packet_ptr(const value_t *ptr) {
+  using packet_value_t = const typename PacketValue<value_t>::type;
+  return sycl::multi_ptr<packet_value_t, address_space>(
+      reinterpret_cast<packet_value_t *>(ptr));
+}
+
+/*! @brief Loads packet_size elements of type in_t, converting them to the
+ * element type of the packet. Used when the output matrix of a mixed precision
+ * gemm has a different type than the accumulators, e.g. int8_t and int32_t.
+ */
+template <sycl::access::address_space address_space, typename packet_t,
+          typename in_t>
+ONEMATH_SYCL_BLAS_INLINE void load_converted(packet_t &packet, in_t *ptr) {
+  using in_packet_t = sycl::vec<
+      typename PacketValue<std::remove_const_t<in_t>>::type,
+      packet_t::size()>;
+  in_packet_t in_packet{};
+  in_packet.template load<address_space>(0,
+                                         const_packet_ptr<address_space>(ptr));
+#pragma unroll
+  for (int i = 0; i < packet_t::size(); ++i) {
+    packet[i] = static_cast<typename packet_t::element_type>(
+        reinterpret_cast<std::remove_const_t<in_t> *>(&in_packet)[i]);
+  }
+}
+
+/*! @brief Stores a packet converting its elements to out_t, see
+ * load_converted.
+ */
+template <sycl::access::address_space address_space, typename packet_t,
+          typename out_t>
+ONEMATH_SYCL_BLAS_INLINE void store_converted(const packet_t &packet,
+                                              out_t *ptr) {
+  using out_packet_t =
+      sycl::vec<typename PacketValue<out_t>::type, packet_t::size()>;
+  out_packet_t out_packet{};
+#pragma unroll
+  for (int i = 0; i < packet_t::size(); ++i) {
+    reinterpret_cast<out_t *>(&out_packet)[i] = static_cast<out_t>(packet[i]);
+  }
+  out_packet.template store<address_space>(0, packet_ptr<address_space>(ptr));
+}
+
 /*! @brief Contains static methods for loading and storing vector packets
 from/to non-vectorized memory as well as some constants for the vector type and
 packet size. SFINAE is used to select the appropriate method when called.
@@ -37,7 +110,8 @@ supported).
 template <int vector_size, typename value_t, typename index_t>
 struct Packetize {
 #ifdef GEMM_VECTORIZATION_SUPPORT
-  using PacketType = sycl::vec<value_t, vector_size>;
+  using PacketType =
+      sycl::vec<typename PacketValue<value_t>::type, vector_size>;
   static constexpr int packet_size = vector_size;
   template <index_t dimension>
   ONEMATH_SYCL_BLAS_INLINE static constexpr bool check_size() {
@@ -45,7 +119,7 @@ struct Packetize {
   }
 #else
   // In the case where vectorization is not enabled, always set to 1
-  using PacketType = sycl::vec<value_t, 1>;
+  using PacketType = sycl::vec<typename PacketValue<value_t>::type, 1>;
   static constexpr int packet_size = 1;
   template <index_t dimension>
   ONEMATH_SYCL_BLAS_INLINE static constexpr bool check_size() {
@@ -86,7 +160,7 @@ struct Packetize {
     if (in_range) {
       using address_t = sycl::access::address_space;
       packet.template load<address_t::global_space>(
-          0, sycl::multi_ptr<const value_t, address_t::global_space>(src));
+          0, const_packet_ptr<address_t::global_space>(src));
     } else {
 #pragma unroll
       for (index_t i = 0; i < packet_size; i++) {
@@ -119,7 +193,7 @@ struct Packetize {
       PacketType &packet, DestPointerType dest) {
     using address_t = sycl::access::address_space;
     packet.template store<address_t::local_space>(
-        0, sycl::multi_ptr<value_t, address_t::local_space>(dest));
+        0, packet_ptr<address_t::local_space>(dest));
   }
 };
 
@@ -68,20 +68,23 @@ namespace blas {
  * @tparam batch_type the type of batch strideded /interleaved
  * @tparam UseJointMatrix boolean parameter to decide whether to use
  * joint_matrix or not
+ * @tparam epilogue_t the epilogue applied to C before it is stored
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename TileType, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
-          int VectorSize>
+          int VectorSize, typename epilogue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
            TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::full), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided), false> {
+           static_cast<int>(gemm_batch_type_t::strided), false, epilogue_t> {
  public:
   using tile_type = TileType;
   using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  using out_value_t =
+      typename std::remove_const<typename output_t::value_t>::type;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using packetize_t = Packetize<VectorSize, value_t, index_t>;
   using packetize_out_t = Packetize<VectorSize, element_t, index_t>;
@@ -169,10 +172,12 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   index_t stridea_;
   index_t strideb_;
   index_t stridec_;
+  epilogue_t epilogue_;
 
   ONEMATH_SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
                        element_t beta, index_t batch_size, index_t stride_a,
-                       index_t stride_b, index_t stride_c)
+                       index_t stride_b, index_t stride_c,
+                       epilogue_t epilogue = epilogue_t())
       : a_(A),
         b_(B),
         c_(C),
@@ -181,7 +186,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
         batch_size_(batch_size),
         stridea_{stride_a},
         strideb_{stride_b},
-        stridec_{stride_c} {}
+        stridec_{stride_c},
+        epilogue_(epilogue) {}
 
   /*!
    * @brief Get the type of this GemmFactory as a human readable string.
@@ -341,14 +347,16 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 
     if (internal) {
       compute_panel_gemm<double_buffer, false, false>(
-          id, item_id, row_a, col_a, row_b, col_b, m, n, k, mc, nc, a_size,
-          b_size, c_size, ptr_A, lda, ptr_B, ldb, ptr_C, ldc, s1, s2, s3, s4,
-          reg_a, reg_b, out_of_range, batch_stride, wg_batch_id, batch_size_);
+          id, item_id, row_a, col_a, row_b, col_b, m, n, k, mc, nc, row_c,
+          col_c, a_size, b_size, c_size, ptr_A, lda, ptr_B, ldb, ptr_C, ldc, s1,
+          s2, s3, s4, reg_a, reg_b, out_of_range, batch_stride, wg_batch_id,
+          batch_size_);
     } else {
       compute_panel_gemm<double_buffer, true, true>(
-          id, item_id, row_a, col_a, row_b, col_b, m, n, k, mc, nc, a_size,
-          b_size, c_size, ptr_A, lda, ptr_B, ldb, ptr_C, ldc, s1, s2, s3, s4,
-          reg_a, reg_b, out_of_range, batch_stride, wg_batch_id, batch_size_);
+          id, item_id, row_a, col_a, row_b, col_b, m, n, k, mc, nc, row_c,
+          col_c, a_size, b_size, c_size, ptr_A, lda, ptr_B, ldb, ptr_C, ldc, s1,
+          s2, s3, s4, reg_a, reg_b, out_of_range, batch_stride, wg_batch_id,
+          batch_size_);
     }
   }
 
@@ -356,11 +364,13 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
   }
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
   }
   ONEMATH_SYCL_BLAS_INLINE bool valid_thread(const sycl::nd_item<1> &ndItem) const {
     return true;
@@ -426,14 +436,16 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       const sycl::nd_item<1> &id, const index_t &item_id, const index_t &row_a,
       const index_t &col_a, const index_t &row_b, const index_t &col_b,
       const index_t &m, const index_t &n, const index_t &orig_k,
-      const index_t &mc, const index_t &nc, const index_t &a_size,
-      const index_t &b_size, const index_t &c_size, InputPointerType orig_A,
+      const index_t &mc, const index_t &nc, const index_t &row_c,
+      const index_t &col_c, const index_t &a_size, const index_t &b_size,
+      const index_t &c_size, InputPointerType orig_A,
       const index_t &lda, InputPointerType orig_B, const index_t &ldb,
       OutputPointerType orig_C, const index_t &ldc, ScratchPointerType s1,
       ScratchPointerType s2, ScratchPointerType s3, ScratchPointerType s4,
       value_t *reg_a, value_t &reg_b, const bool out_of_range,
       index_t batch_stride, index_t wg_batch_id, index_t batch_size) noexcept {
     index_t ofs = 1;
+    index_t batch = wg_batch_id;
     do {
       auto A = orig_A;
       auto B = orig_B;
@@ -504,11 +516,12 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       }
 
       // store the output
-      store_output_block<check_m_limit, check_n_limit>(item_id, mc, nc, C, ldc,
-                                                       reg_res, out_of_range);
+      store_output_block<check_m_limit, check_n_limit>(
+          item_id, mc, nc, row_c, col_c, batch, C, ldc, reg_res, out_of_range);
       orig_A += (stridea_ * batch_stride);
       orig_B += (strideb_ * batch_stride);
       orig_C += (stridec_ * batch_stride);
+      batch += batch_stride;
       // batch_size_ must be signed as the negative value has meaning here.
       batch_size -= batch_stride;
     } while (batch_size > wg_batch_id);
@@ -518,7 +531,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
             typename OutputPointerType>
   ONEMATH_SYCL_BLAS_INLINE typename std::enable_if<!internal>::type store_packet(
       element_t *reg, OutputPointerType out_ptr) {
-    *out_ptr = alpha_ * (*reg);
+    *out_ptr = epilogue_t::is_identity ? alpha_ * (*reg) : *reg;
   }
 
   template <bool internal, index_t p_size = packetize_t::packet_size,
@@ -527,6 +540,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
       element_t *reg, OutputPointerType out_ptr) {
     vector_out_t out_vec{};
 
+    // Mixed precision: the accumulators are converted to the type of C
+    if constexpr (!std::is_same_v<element_t, out_value_t>) {
+#pragma unroll
+      for (index_t i = 0; i < p_size; ++i) {
+        out_vec[i] = epilogue_t::is_identity ? alpha_ * reg[i] : reg[i];
+      }
+      store_converted<address_t::global_space>(out_vec, out_ptr);
+    } else
 #ifdef BLAS_ENABLE_COMPLEX
     // This if-statement is necessary starting from late 2024 nightly, because
     // an update made casting raw pointers of sycl::complex to multi_ptr
@@ -539,7 +560,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
                       sycl::ext::oneapi::experimental::complex<double>>) {
       out_vec.template load<address_t::private_space,
                             sycl::access::decorated::legacy>(0, reg);
-      out_vec *= alpha_;
+      if constexpr (epilogue_t::is_identity) {
+        out_vec *= alpha_;
+      }
 
       out_vec.template store<address_t::global_space,
                              sycl::access::decorated::legacy>(0, out_ptr);
@@ -554,7 +577,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
                             sycl::access::decorated::legacy>(
 #endif
           0, sycl::multi_ptr<const element_t, address_t::private_space>(reg));
-      out_vec *= alpha_;
+      if constexpr (epilogue_t::is_identity) {
+        out_vec *= alpha_;
+      }
 
 #ifdef __ADAPTIVECPP__
       // AdaptiveCpp 24.10 doesn't support IsDecorated template parameter here
@@ -566,6 +591,20 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
           0, sycl::multi_ptr<element_t, address_t::global_space>(out_ptr));
     }
   }
+  /*!
+   * @brief Scales by alpha the p_size consecutive elements of C starting at
+   * (row, col) and applies the epilogue to them, in registers.
+   */
+  template <index_t p_size>
+  ONEMATH_SYCL_BLAS_INLINE void apply_epilogue(element_t *reg, index_t row,
+                                               index_t col,
+                                               index_t batch) const noexcept {
+#pragma unroll
+    for (index_t l = 0; l < p_size; ++l) {
+      reg[l] = epilogue_.eval(alpha_ * reg[l], row + l, col, batch);
+    }
+  }
+
   /*!
    * @brief Store the computed gemm result to the C matrix
    *
@@ -580,15 +619,18 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
    * @param beta  scaling factor of C
    * @param C  pointer to the first element of C
    * @param ldc  leading dimension of C
+   * @param row_c, col_c the position of the first element of C stored by the
+   * work item, used by the epilogue
+   * @param batch the batch index of C, used by the epilogue
    * @param reg_res  2D register array containing the partial resull of C
    * per thread
    */
 
   template <bool check_m_limit, bool check_n_limit, typename OutputPointerType>
-  ONEMATH_SYCL_BLAS_INLINE void store_output_block(index_t, index_t mc, index_t nc,
-                                          OutputPointerType C, index_t ldc,
-                                          element_t *reg_res,
-                                          const bool out_of_range) noexcept {
+  ONEMATH_SYCL_BLAS_INLINE void store_output_block(
+      index_t, index_t mc, index_t nc, index_t row_c, index_t col_c,
+      index_t batch, OutputPointerType C, index_t ldc, element_t *reg_res,
+      const bool out_of_range) noexcept {
     if (out_of_range) {
       return;
     }
@@ -601,6 +643,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
             do_check<check_n_limit>(i < nc);
 
         if (in_range) {
+          if constexpr (!epilogue_t::is_identity) {
+            apply_epilogue<offset>(reg_res, row_c + j * wg_rows * offset,
+                                   col_c + i, batch);
+          }
           store_packet<!check_m_limit && !check_n_limit>(
               reg_res, C + j * (wg_rows * offset));
         }
@@ -864,7 +910,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
                                    ? *(src + i)
                                    : *((src + i) + ((row + i) - curr_col) * ld +
                                        (curr_col - (row + i)))
-                             : value_t{0.0};
+                             : value_t{0};
       }
       packetize_t::template store<trans, lds>(packet, dest);
     }
@@ -54,19 +54,22 @@ namespace blas {
  * @tparam element_t  type of scalar alpha & beta
  * @tparam UseJointMatrix boolean parameter to decide whether to use
  * joint_matrix or not
+ * @tparam epilogue_t the epilogue applied to C before it is stored
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
-          int VectorSize>
+          int VectorSize, typename epilogue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::no_local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::partial), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided), false> {
+           static_cast<int>(gemm_batch_type_t::strided), false, epilogue_t> {
  public:
   using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  using out_value_t =
+      typename std::remove_const<typename output_t::value_t>::type;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using address_t = sycl::access::address_space;
   using packetize_t = Packetize<VectorSize, value_t, index_t>;
@@ -116,10 +119,12 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   index_t stridea_;
   index_t strideb_;
   index_t stridec_;
+  epilogue_t epilogue_;
 
   ONEMATH_SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
                        element_t beta, index_t batch_size, index_t stride_a,
-                       index_t stride_b, index_t stride_c)
+                       index_t stride_b, index_t stride_c,
+                       epilogue_t epilogue = epilogue_t())
       : a_(A),
         b_(B),
         c_(C),
@@ -128,7 +133,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
         batch_size_(batch_size),
         stridea_{stride_a},
         strideb_{stride_b},
-        stridec_{stride_c} {}
+        stridec_{stride_c},
+        epilogue_(epilogue) {}
 
   /*!
    * @brief Get the type of this NoLocalGemmFactory as a human readable string.
@@ -359,6 +365,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       value_t *reg_b, const bool out_of_range, const index_t &batch_stride,
       const index_t &wg_batch_id, index_t batch_size, const index_t &lda,
       const index_t &ldb, const index_t &ldc) noexcept {
+    index_t batch = wg_batch_id;
     do {
       auto A = orig_A;
       auto B = orig_B;
@@ -401,13 +408,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
        *  Storing the reg_res into C matrix
        */
       store<need_check_boundary, a_packet_size, b_packet_size>(
-          C, reg_res, dim_m_a_start, dim_n_b_start, boundary_check_c,
+          C, reg_res, dim_m_a_start, dim_n_b_start, batch, boundary_check_c,
           out_of_range, ldc);
 
       orig_A += (stridea_ * batch_stride);
       orig_B += (strideb_ * batch_stride);
       orig_C += (stridec_ * batch_stride);
       k = orig_k;
+      batch += batch_stride;
       // batch_size_ must be signed as the negative value has meaning here.
       batch_size -= batch_stride;
     } while (batch_size > wg_batch_id);
@@ -420,12 +428,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
   }
 
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
   }
 
  private:
@@ -471,10 +481,10 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       l_vector_t in_vec{0};
       if (in_range) {
         in_vec.template load<address_t::global_space>(
-            0, sycl::multi_ptr<const value_t, address_t::global_space>(ptr));
+            0, const_packet_ptr<address_t::global_space>(ptr));
       }
       in_vec.template store<address_t::private_space>(
-          0, sycl::multi_ptr<value_t, address_t::private_space>(reg));
+          0, packet_ptr<address_t::private_space>(reg));
 
       // Move pointers and update index for next load
       ptr += ld;
@@ -519,8 +529,12 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
         0, sycl::multi_ptr<const element_t, address_t::private_space>(reg));
     out_vec *= alpha_;
 
-    out_vec.template store<address_t::global_space>(
-        0, sycl::multi_ptr<element_t, address_t::global_space>(out_ptr));
+    if constexpr (std::is_same_v<element_t, out_value_t>) {
+      out_vec.template store<address_t::global_space>(
+          0, sycl::multi_ptr<element_t, address_t::global_space>(out_ptr));
+    } else {
+      store_converted<address_t::global_space>(out_vec, out_ptr);
+    }
   }
 
   /*!
@@ -538,12 +552,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
    * @param chk_boundary: an instance of the check_boundary function
    * @param ldc is the leading dimension of C
    * @param mc and nc are indices, used to check the boundary of C
+   * @param batch the batch index of C, used by the epilogue
    */
   template <bool check_block, index_t a_packet_size, index_t b_packet_size,
             typename PointerType, typename check_boundary>
   ONEMATH_SYCL_BLAS_INLINE void store(PointerType C, element_t *reg_res,
                              const index_t &dim_m_c_start,
                              const index_t &dim_n_c_start,
+                             const index_t &batch,
                              const check_boundary &chk_boundary,
                              const bool out_of_range,
                              const index_t &ldc) noexcept {
@@ -560,14 +576,29 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
               typename Packetize<a_packet_size, element_t, index_t>::PacketType;
           l_vector_t out_vec{0};
 
+          if constexpr (!epilogue_t::is_identity) {
+            apply_epilogue<a_packet_size>(
+                reg_res + i * item_rows + j * a_packet_size,
+                dim_m_c_start + j * wg_rows * a_packet_size,
+                dim_n_c_start + (i / b_packet_size) * wg_cols * b_packet_size +
+                    i % b_packet_size,
+                batch);
+          }
           out_vec.template load<address_t::private_space>(
               0, sycl::multi_ptr<const element_t, address_t::private_space>(
                      reg_res + i * item_rows + j * a_packet_size));
-          out_vec *= alpha_;
-
-          out_vec.template store<address_t::global_space>(
-              0, sycl::multi_ptr<element_t, address_t::global_space>(
-                     C + j * wg_rows * a_packet_size));
+          if constexpr (epilogue_t::is_identity) {
+            out_vec *= alpha_;
+          }
+
+          if constexpr (std::is_same_v<element_t, out_value_t>) {
+            out_vec.template store<address_t::global_space>(
+                0, sycl::multi_ptr<element_t, address_t::global_space>(
+                       C + j * wg_rows * a_packet_size));
+          } else {
+            store_converted<address_t::global_space>(
+                out_vec, C + j * wg_rows * a_packet_size);
+          }
         }
       }
       C += ((i + 1) % b_packet_size == 0
@@ -575,6 +606,20 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
                 : ldc);
     }
   }
+
+  /*!
+   * @brief Scales by alpha the p_size consecutive elements of C starting at
+   * (row, col) and applies the epilogue to them, in registers.
+   */
+  template <index_t p_size>
+  ONEMATH_SYCL_BLAS_INLINE void apply_epilogue(element_t *reg, index_t row,
+                                               index_t col,
+                                               index_t batch) const noexcept {
+#pragma unroll
+    for (index_t l = 0; l < p_size; ++l) {
+      reg[l] = epilogue_.eval(alpha_ * reg[l], row + l, col, batch);
+    }
+  }
 };  // end class Gemm
 
 }  // namespace blas
@@ -0,0 +1,305 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_PACKED_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_GEMM_PACKED_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+         element_t>::GemmPack(input_t src, output_t packed, element_t alpha,
+                              index_t outer, index_t k)
+    : src_(src),
+      packed_(packed),
+      alpha_(alpha),
+      outer_(outer),
+      k_(k),
+      ld_(src_.getSizeL()),
+      tiles_k_((k - 1) / block_k + 1),
+      size_(get_packed_size(outer, k)) {}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE
+    typename GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+                      element_t>::index_t
+    GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+             element_t>::get_packed_size(index_t outer, index_t k) noexcept {
+  return ((outer - 1) / block_outer + 1) * ((k - 1) / block_k + 1) *
+         block_size;
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE
+    typename GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+                      element_t>::index_t
+    GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+             element_t>::get_size() const {
+  return size_;
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE bool
+GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+         element_t>::valid_thread(const sycl::nd_item<1>& ndItem) const {
+  return static_cast<index_t>(ndItem.get_global_id(0)) < size_;
+}
+
+/*!
+ * @brief Each work item writes one element of the packed matrix, so the
+ * writes are contiguous.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans, element_t>::eval(
+    sycl::nd_item<1> id) noexcept {
+  const index_t idx = id.get_global_id(0);
+  const index_t block = idx / block_size;
+  const index_t in_block = idx % block_size;
+  // The rows of an op(A) block and the depth of an op(B) block are contiguous
+  const index_t outer = (block / tiles_k_) * block_outer +
+                        (PackB ? in_block / block_k : in_block % block_outer);
+  const index_t k = (block % tiles_k_) * block_k +
+                    (PackB ? in_block % block_k : in_block / block_outer);
+  // The outer dimension is contiguous in non-transposed A and transposed B
+  const index_t src_idx = Trans != PackB ? outer * ld_ + k : k * ld_ + outer;
+  packed_.template eval<true>(idx) =
+      (outer < outer_ && k < k_)
+          ? static_cast<value_t>(
+                alpha_ *
+                static_cast<element_t>(src_.template eval<true>(src_idx)))
+          : value_t{0};
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans, element_t>::bind(
+    sycl::handler& h) {
+  src_.bind(h);
+  packed_.bind(h);
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool PackB, bool Trans, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmPack<input_t, output_t, ClSize, tile_type, PackB, Trans,
+         element_t>::adjust_access_displacement() {
+  src_.adjust_access_displacement();
+  packed_.adjust_access_displacement();
+}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t,
+           is_beta_zero>::GemmPacked(input_a_t A, input_b_t B, output_t C,
+                                     element_t beta, index_t m, index_t n,
+                                     index_t k)
+    : a_(A),
+      b_(B),
+      c_(C),
+      beta_(beta),
+      m_(m),
+      n_(n),
+      k_(k),
+      lda_(a_.getSizeL()),
+      ldb_(b_.getSizeL()),
+      ldc_(c_.getSizeL()),
+      tiles_m_((m - 1) / block_rows + 1),
+      tiles_n_((n - 1) / block_cols + 1),
+      tiles_k_((k - 1) / block_k + 1) {}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE std::string
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t,
+           is_beta_zero>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "GemmPacked <" << ClSize << ", " << tile_type::get_type_string()
+      << ", " << type_string<value_t>::get_value() << "_"
+      << type_string<element_t>::get_value() << ", " << TransA << ", "
+      << TransB << ", " << PackedA << ", " << PackedB << ">";
+  return str.str();
+}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t, is_beta_zero>::get_nd_range()
+    const noexcept {
+  return sycl::nd_range<1>(sycl::range<1>(tiles_m_ * tiles_n_ * wg_size),
+                           sycl::range<1>(wg_size));
+}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE bool
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t,
+           is_beta_zero>::valid_thread(const sycl::nd_item<1>&) const {
+  return true;
+}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+template <typename local_memory_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t,
+           is_beta_zero>::eval(local_memory_t scratch_acc,
+                               sycl::nd_item<1> id) noexcept {
+  auto scratch = scratch_acc.localAcc.get_pointer();
+  // The A block is stored with its rows contiguous and the B block with its
+  // depth contiguous, which is also the layout of the packed blocks
+  auto s_a = scratch;
+  auto s_b = scratch + block_rows * block_k;
+
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+  const index_t tile_m = id.get_group(0) % tiles_m_;
+  const index_t tile_n = id.get_group(0) / tiles_m_;
+  const index_t row_start = tile_m * block_rows;
+  const index_t col_start = tile_n * block_cols;
+
+  element_t reg_res[item_rows * item_cols];
+#pragma unroll
+  for (index_t i = 0; i < item_rows * item_cols; ++i) {
+    reg_res[i] = element_t{0};
+  }
+
+  for (index_t tile_k = 0; tile_k < tiles_k_; ++tile_k) {
+    const index_t k_start = tile_k * block_k;
+    if constexpr (PackedA) {
+      const index_t offset =
+          (tile_m * tiles_k_ + tile_k) * block_rows * block_k;
+      for (index_t idx = item_id; idx < block_rows * block_k; idx += wg_size) {
+        s_a[idx] = a_.template eval<true>(offset + idx);
+      }
+    } else {
+      for (index_t idx = item_id; idx < block_rows * block_k; idx += wg_size) {
+        const index_t row = row_start + idx % block_rows;
+        const index_t k = k_start + idx / block_rows;
+        s_a[idx] = (row < m_ && k < k_)
+                       ? a_.template eval<true>(TransA ? row * lda_ + k
+                                                       : k * lda_ + row)
+                       : value_t{0};
+      }
+    }
+    if constexpr (PackedB) {
+      const index_t offset =
+          (tile_n * tiles_k_ + tile_k) * block_k * block_cols;
+      for (index_t idx = item_id; idx < block_k * block_cols; idx += wg_size) {
+        s_b[idx] = b_.template eval<true>(offset + idx);
+      }
+    } else {
+      for (index_t idx = item_id; idx < block_k * block_cols; idx += wg_size) {
+        const index_t k = k_start + idx % block_k;
+        const index_t col = col_start + idx / block_k;
+        s_b[idx] = (col < n_ && k < k_)
+                       ? b_.template eval<true>(TransB ? k * ldb_ + col
+                                                       : col * ldb_ + k)
+                       : value_t{0};
+      }
+    }
+    sycl::group_barrier(id.get_group());
+
+#pragma unroll
+    for (index_t k = 0; k < block_k; ++k) {
+      value_t reg_a[item_rows];
+#pragma unroll
+      for (index_t i = 0; i < item_rows; ++i) {
+        reg_a[i] = s_a[k * block_rows + item_row + i * wg_rows];
+      }
+#pragma unroll
+      for (index_t j = 0; j < item_cols; ++j) {
+        const value_t b = s_b[(item_col + j * wg_cols) * block_k + k];
+#pragma unroll
+        for (index_t i = 0; i < item_rows; ++i) {
+          reg_res[j * item_rows + i] =
+              mul_add(reg_a[i], b, reg_res[j * item_rows + i]);
+        }
+      }
+    }
+    sycl::group_barrier(id.get_group());
+  }
+
+#pragma unroll
+  for (index_t j = 0; j < item_cols; ++j) {
+    const index_t col = col_start + item_col + j * wg_cols;
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t row = row_start + item_row + i * wg_rows;
+      if (row < m_ && col < n_) {
+        const index_t idx = col * ldc_ + row;
+        // alpha has been applied to the packed operands
+        c_.template eval<true>(idx) =
+            is_beta_zero ? reg_res[j * item_rows + i]
+                         : reg_res[j * item_rows + i] +
+                               beta_ * static_cast<element_t>(
+                                           c_.template eval<true>(idx));
+      }
+    }
+  }
+}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t, is_beta_zero>::bind(sycl::handler& h) {
+  a_.bind(h);
+  b_.bind(h);
+  c_.bind(h);
+}
+
+template <typename input_a_t, typename input_b_t, typename output_t,
+          int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool PackedA, bool PackedB, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmPacked<input_a_t, input_b_t, output_t, ClSize, tile_type, TransA, TransB,
+           PackedA, PackedB, element_t,
+           is_beta_zero>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_PACKED_HPP
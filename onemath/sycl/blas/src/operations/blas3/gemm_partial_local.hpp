@@ -29,13 +29,27 @@ namespace blas {
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-          bool IsFinal, bool IsBetaZero, typename element_t>
+          int SplitK, bool IsBetaZero, typename element_t,
+          typename workspace_t, typename counter_t>
 class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
-                  tile_type, TransA, TransB, IsFinal, IsBetaZero, element_t,
-                  static_cast<int>(gemm_memory_t::local)> {
+                  tile_type, TransA, TransB, SplitK, IsBetaZero, element_t,
+                  static_cast<int>(gemm_memory_t::local), workspace_t,
+                  counter_t> {
  public:
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using value_t = typename std::remove_const<typename input_t::value_t>::type;
+  using out_value_t = typename output_t::value_t;
+
+  static constexpr bool is_split =
+      SplitK != static_cast<int>(gemm_split_k_t::none);
+  static constexpr bool is_atomic =
+      SplitK == static_cast<int>(gemm_split_k_t::atomic);
+  static constexpr bool is_fixup =
+      SplitK == static_cast<int>(gemm_split_k_t::fixup);
+  static_assert(!is_atomic || (std::is_same_v<out_value_t, element_t> &&
+                               (std::is_same_v<element_t, float> ||
+                                std::is_same_v<element_t, double>)),
+                "The atomic split-K requires a float or double C");
 
  private:
   /* This structure holds information about the block loading pattern */
@@ -55,7 +69,11 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
  public:
   input_t a_;
   input_t b_;
-  output_t cube_;
+  output_t c_;
+  /* Contributions of the slices of K (fixup split-K only) */
+  workspace_t workspace_;
+  /* Number of slices done for each tile of C (fixup split-K only) */
+  counter_t counters_;
 
   element_t alpha_;
   element_t beta_;
@@ -153,11 +171,14 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
   const index_t num_tiles;
 
   ONEMATH_SYCL_BLAS_INLINE
-  GemmPartial(input_t A, input_t B, output_t cube_buffer, element_t alpha,
-              element_t beta, index_t wg_count_k)
+  GemmPartial(input_t A, input_t B, output_t C, element_t alpha,
+              element_t beta, index_t wg_count_k, workspace_t workspace,
+              counter_t counters)
       : a_(A),
         b_(B),
-        cube_(cube_buffer),
+        c_(C),
+        workspace_(workspace),
+        counters_(counters),
         alpha_(alpha),
         beta_(beta),
         m_(a_.get_size_row()),
@@ -165,7 +186,7 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
         k_(a_.get_size_col()),
         lda_(a_.getSizeL()),
         ldb_(b_.getSizeL()),
-        ldc_(cube_.getSizeL()),
+        ldc_(c_.getSizeL()),
         group_count_m((m_ - 1) / tile_size_dim_m + 1),
         group_count_n((n_ - 1) / tile_size_dim_n + 1),
         group_count_k(wg_count_k),
@@ -174,26 +195,46 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
   void bind(sycl::handler& h) {
     a_.bind(h);
     b_.bind(h);
-    cube_.bind(h);
+    c_.bind(h);
+    if constexpr (is_fixup) {
+      workspace_.bind(h);
+      counters_.bind(h);
+    }
   }
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
-    cube_.adjust_access_displacement();
+    c_.adjust_access_displacement();
+    if constexpr (is_fixup) {
+      workspace_.adjust_access_displacement();
+      counters_.adjust_access_displacement();
+    }
+  }
+
+  /*!
+   * @brief Number of tiles of C, which is also the number of counters of the
+   * fixup split-K.
+   */
+  static ONEMATH_SYCL_BLAS_INLINE index_t get_num_tiles_mn(index_t m,
+                                                           index_t n) noexcept {
+    return ((m - 1) / tile_size_dim_m + 1) * ((n - 1) / tile_size_dim_n + 1);
   }
 
   /*!
-   * @brief This function returns the depth of the cube buffer that should give
-   * the best performance.
+   * @brief This function returns the number of slices K should be split into
+   * to give the best performance.
    */
-  static ONEMATH_SYCL_BLAS_INLINE index_t get_ideal_cube_depth(index_t compute_units,
-                                                      index_t m, index_t n,
-                                                      index_t k) noexcept {
-    const index_t group_count_mn =
-        ((m - 1) / tile_size_dim_m + 1) * ((n - 1) / tile_size_dim_n + 1);
-    /* The depth of the cube buffer is calculated so that each compute unit
-     * will compute 4 work groups. This value is empirical */
-    return (4 * compute_units - 1) / group_count_mn + 1;
+  static ONEMATH_SYCL_BLAS_INLINE index_t get_split_k_factor(
+      index_t compute_units, index_t m, index_t n, index_t k) noexcept {
+    /* The split factor is calculated so that each compute unit will compute 4
+     * work groups. This value is empirical */
+    const index_t split = (4 * compute_units - 1) / get_num_tiles_mn(m, n) + 1;
+    /* Each slice must still loop over a few tiles of K to hide the cost of
+     * storing its contribution */
+    constexpr index_t min_tiles_per_slice = 8;
+    const index_t max_split =
+        (k - 1) / (min_tiles_per_slice * tile_size_dim_k) + 1;
+    return std::min(split, max_split);
   }
 
   /*!
@@ -238,9 +279,9 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
 
     /* Workgroup id m, k and n */
     const index_t group_count_mn = group_count_m * group_count_n;
-    const index_t kgroup_id = IsFinal ? 0 : (group_id / group_count_mn);
+    const index_t kgroup_id = is_split ? (group_id / group_count_mn) : 0;
     const index_t mn_group_id =
-        IsFinal ? group_id : (group_id - kgroup_id * group_count_mn);
+        is_split ? (group_id - kgroup_id * group_count_mn) : group_id;
     const index_t ngroup_id = mn_group_id / group_count_m;
     const index_t mgroup_id = mn_group_id - ngroup_id * group_count_m;
 
@@ -248,7 +289,7 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
     const index_t global_m_offset = mgroup_id * tile_size_dim_m;
     const index_t global_n_offset = ngroup_id * tile_size_dim_n;
     const index_t global_k_offset =
-        IsFinal ? 0 : (kgroup_id * tile_size_dim_k * num_tiles);
+        is_split ? (kgroup_id * tile_size_dim_k * num_tiles) : 0;
 
     /* Find out whether we need to check the limits when loading the tiles */
     const bool check_m_limit = global_m_offset + tile_size_dim_m > m_;
@@ -320,36 +361,96 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
       }
     }
 
-    // Store the final results in the cube buffer
-    index_t slice_col = (ngroup_id * tile_size_dim_n) + (n_local_id);
-    const index_t slice_row_offset =
-        (mgroup_id * tile_size_dim_m) + (m_local_id);
-    const index_t cube_depth_offset = IsFinal ? 0 : (kgroup_id * ldc_ * n_);
-    index_t cube_index = slice_col * ldc_;
-    index_t private_index_offset = 0;
-    const index_t cube_index_inc = tile_type::wg_cols * ldc_;
+    // Store the results of the slice of K
+    const index_t col_offset = (ngroup_id * tile_size_dim_n) + (n_local_id);
+    const index_t row_offset = (mgroup_id * tile_size_dim_m) + (m_local_id);
+    const index_t slice_offset = kgroup_id * m_ * n_;
 
 #pragma unroll
     for (index_t wLPTN = 0; wLPTN < tile_type::item_cols; wLPTN++) {
-      index_t private_index = private_index_offset;
-
-      index_t slice_row = slice_row_offset;
+      const index_t col = col_offset + wLPTN * tile_type::wg_cols;
 #pragma unroll
       for (index_t wLPTM = 0; wLPTM < tile_type::item_rows; wLPTM++) {
-        if (slice_row < m_ && slice_col < n_) {
-          const index_t write_idx = cube_index + slice_row + cube_depth_offset;
-          cube_.template eval<true>(write_idx) =
-              IsBetaZero ? (alpha_ * private_res[wLPTM + private_index])
-                         : (alpha_ * private_res[wLPTM + private_index] +
-                            beta_ * cube_.template eval<true>(write_idx));
+        const index_t row = row_offset + wLPTM * tile_type::wg_rows;
+        const element_t res = private_res[wLPTN * tile_type::item_rows + wLPTM];
+        if (row < m_ && col < n_) {
+          if constexpr (is_fixup) {
+            workspace_.template eval<true>(slice_offset + col * m_ + row) =
+                res;
+          } else if constexpr (is_atomic) {
+            sycl::atomic_ref<element_t, sycl::memory_order::relaxed,
+                             sycl::memory_scope::device,
+                             sycl::access::address_space::global_space>(
+                c_.template eval<true>(col * ldc_ + row))
+                .fetch_add(alpha_ * res);
+          } else {
+            const index_t write_idx = col * ldc_ + row;
+            c_.template eval<true>(write_idx) =
+                IsBetaZero
+                    ? (alpha_ * res)
+                    : (alpha_ * res +
+                       beta_ * static_cast<element_t>(
+                                   c_.template eval<true>(write_idx)));
+          }
         }
-        slice_row += tile_type::wg_rows;
       }
-      private_index += tile_type::item_rows;
+    }
+
+    if constexpr (is_fixup) {
+      fixup(id, mn_group_id, row_offset, col_offset);
+    }
+  }
 
-      slice_col += tile_type::wg_cols;
-      cube_index += cube_index_inc;
-      private_index_offset += tile_type::item_rows;
+  /*!
+   * @brief Counts the slices of K done for the tile of C of the work group,
+   * the last one to finish sums the contributions of all the slices in order
+   * and stores the result to C.
+   */
+  ONEMATH_SYCL_BLAS_INLINE void fixup(sycl::nd_item<1> id,
+                                      index_t mn_group_id, index_t row_offset,
+                                      index_t col_offset) noexcept {
+    // Releases the contribution of each work item before counting the slice
+    sycl::atomic_fence(sycl::memory_order::release,
+                       sycl::memory_scope::device);
+    sycl::group_barrier(id.get_group());
+    bool is_last = false;
+    if (id.get_local_id(0) == 0) {
+      auto counter =
+          sycl::atomic_ref<uint32_t, sycl::memory_order::acq_rel,
+                           sycl::memory_scope::device,
+                           sycl::access::address_space::global_space>(
+              counters_.get_data()[mn_group_id]);
+      is_last = counter.fetch_add(1u) ==
+                static_cast<uint32_t>(group_count_k - 1);
+    }
+    is_last = sycl::group_broadcast(id.get_group(), is_last);
+    if (!is_last) {
+      return;
+    }
+
+    sycl::atomic_fence(sycl::memory_order::acquire,
+                       sycl::memory_scope::device);
+    const index_t slice_size = m_ * n_;
+#pragma unroll
+    for (index_t wLPTN = 0; wLPTN < tile_type::item_cols; wLPTN++) {
+      const index_t col = col_offset + wLPTN * tile_type::wg_cols;
+#pragma unroll
+      for (index_t wLPTM = 0; wLPTM < tile_type::item_rows; wLPTM++) {
+        const index_t row = row_offset + wLPTM * tile_type::wg_rows;
+        if (row < m_ && col < n_) {
+          element_t sum{0};
+          for (index_t slice = 0; slice < group_count_k; slice++) {
+            sum += workspace_.template eval<true>(slice * slice_size +
+                                                  col * m_ + row);
+          }
+          const index_t write_idx = col * ldc_ + row;
+          c_.template eval<true>(write_idx) =
+              IsBetaZero ? (alpha_ * sum)
+                         : (alpha_ * sum +
+                            beta_ * static_cast<element_t>(
+                                        c_.template eval<true>(write_idx)));
+        }
+      }
     }
   }
 
@@ -361,8 +462,8 @@ class GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
       const index_t& global_n_offset, const index_t& global_k_offset,
       bool check_m_limit, bool check_n_limit) {
     const bool check_k_limit =
-        IsFinal ? ((tile_idx + 1) * tile_size_dim_k > k_)
-                : (global_k_offset + (tile_idx + 1) * tile_size_dim_k > k_);
+        is_split ? (global_k_offset + (tile_idx + 1) * tile_size_dim_k > k_)
+                 : ((tile_idx + 1) * tile_size_dim_k > k_);
     const bool check_limits = check_m_limit || check_n_limit || check_k_limit;
     if (check_limits)
       load_blocks<true, true, true>(
@@ -46,14 +46,17 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
-     GemmAlgorithm, GemmVectorization, VectorSize, BatchType, UseJointMatrix>::
+     GemmAlgorithm, GemmVectorization, VectorSize, BatchType, UseJointMatrix,
+     epilogue_t>::
     Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
          typename std::make_signed<typename input_t::index_t>::type batch_size,
-         index_t stride_a, index_t stride_b, index_t stride_c)
+         index_t stride_a, index_t stride_b, index_t stride_c,
+         epilogue_t epilogue)
     : a_(A),
       b_(B),
       c_(C),
@@ -68,17 +71,19 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
       batch_size_(batch_size),
       stridea_{stride_a},
       strideb_{stride_b},
-      stridec_{stride_c} {}
+      stridec_{stride_c},
+      epilogue_(epilogue) {}
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE std::string
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::get_type_string() noexcept {
+     UseJointMatrix, epilogue_t>::get_type_string() noexcept {
   std::ostringstream str{};
   str << "ReferenceGemmFactory<" << wg_size << ", "
       << type_string<value_t>::get_value() << ">";
@@ -93,16 +98,17 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE typename Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB,
                               ClSize, tile_type, TransA, TransB, SymmA, SymmB,
                               element_t, is_beta_zero, GemmMemoryType,
                               GemmAlgorithm, GemmVectorization, VectorSize,
-                              BatchType, UseJointMatrix>::index_t
+                              BatchType, UseJointMatrix, epilogue_t>::index_t
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::get_workgroup_cluster() const noexcept {
+     UseJointMatrix, epilogue_t>::get_workgroup_cluster() const noexcept {
   return ((m_ * n_ - 1) / wg_size + 1);
 }
 /*!
@@ -116,24 +122,26 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE typename Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB,
                               ClSize, tile_type, TransA, TransB, SymmA, SymmB,
                               element_t, is_beta_zero, GemmMemoryType,
                               GemmAlgorithm, GemmVectorization, VectorSize,
-                              BatchType, UseJointMatrix>::index_t
+                              BatchType, UseJointMatrix, epilogue_t>::index_t
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::get_num_workgroup_cluster(index_t compute_units)
-    const noexcept {
+     UseJointMatrix,
+     epilogue_t>::get_num_workgroup_cluster(index_t compute_units) const
+    noexcept {
   constexpr index_t num_gemm_per_compute_units = 4;
   return (
       (num_gemm_per_compute_units * compute_units - 1) /
           Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
                TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
                GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-               BatchType, UseJointMatrix>::get_workgroup_cluster() +
+               BatchType, UseJointMatrix, epilogue_t>::get_workgroup_cluster() +
       1);
 }
 
@@ -141,22 +149,25 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::get_nd_range(index_t compute_units) const noexcept {
+     UseJointMatrix,
+     epilogue_t>::get_nd_range(index_t compute_units) const noexcept {
   const sycl::range<1> nwg(
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
            GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
-           BatchType, UseJointMatrix>::get_workgroup_cluster() *
+           BatchType, UseJointMatrix, epilogue_t>::get_workgroup_cluster() *
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, SymmA, SymmB, element_t, is_beta_zero,
            GemmMemoryType, GemmAlgorithm, GemmVectorization, VectorSize,
            BatchType,
-           UseJointMatrix>::get_num_workgroup_cluster(compute_units));
+           UseJointMatrix,
+           epilogue_t>::get_num_workgroup_cluster(compute_units));
   const sycl::range<1> wgs(wg_size);
   return sycl::nd_range<1>(nwg * wgs, wgs);
 }
@@ -164,16 +175,17 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE typename Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB,
                               ClSize, tile_type, TransA, TransB, SymmA, SymmB,
                               element_t, is_beta_zero, GemmMemoryType,
                               GemmAlgorithm, GemmVectorization, VectorSize,
-                              BatchType, UseJointMatrix>::index_t
+                              BatchType, UseJointMatrix, epilogue_t>::index_t
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::get_size() const {
+     UseJointMatrix, epilogue_t>::get_size() const {
   return m_ * n_;
 }
 
@@ -181,12 +193,14 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE bool
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::valid_thread(const sycl::nd_item<1>& ndItem) const {
+     UseJointMatrix,
+     epilogue_t>::valid_thread(const sycl::nd_item<1>& ndItem) const {
   return true;
 }
 
@@ -194,12 +208,13 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::eval(sycl::nd_item<1> id) noexcept {
+     UseJointMatrix, epilogue_t>::eval(sycl::nd_item<1> id) noexcept {
   const index_t wg_batch_id = id.get_group(0) / get_workgroup_cluster();
   // This will disable all workgroups that dont have any batch to work on
   if (wg_batch_id >= batch_size_) {
@@ -229,6 +244,7 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
   orig_B = orig_B + col * (trans_b ? 1 : ldb_);
   orig_C = orig_C + row + col * ldc_;
 
+  index_t batch = wg_batch_id;
   do {
     auto A = orig_A;
     auto B = orig_B;
@@ -242,16 +258,17 @@ Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
     }
     // when C is uninitialized the element of the C can be NaN, and Nan*0
     // will be NaN
-    if (is_beta_zero) {
-      C[0] = alpha_ * reg_res;
-    } else {
-      C[0] = alpha_ * reg_res + beta_ * C[0];
+    element_t res = alpha_ * reg_res;
+    if (!is_beta_zero) {
+      res += beta_ * C[0];
     }
+    C[0] = epilogue_.eval(res, row, col, batch);
 
     orig_A += (stridea_ * batch_stride);
     orig_B += (strideb_ * batch_stride);
     orig_C += (stridec_ * batch_stride);
     k_ = a_.get_size_col();
+    batch += batch_stride;
     // batch_size_ must be signed as the negative value has meaning here.
     batch_size_ -= batch_stride;
   } while (batch_size_ > wg_batch_id);
@@ -261,30 +278,34 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::bind(sycl::handler& h) {
+     UseJointMatrix, epilogue_t>::bind(sycl::handler& h) {
   a_.bind(h);
   b_.bind(h);
   c_.bind(h);
+  epilogue_.bind(h);
 }
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 ONEMATH_SYCL_BLAS_INLINE void
 Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
      TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
      GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-     UseJointMatrix>::adjust_access_displacement() {
+     UseJointMatrix, epilogue_t>::adjust_access_displacement() {
   a_.adjust_access_displacement();
   b_.adjust_access_displacement();
   c_.adjust_access_displacement();
+  epilogue_.adjust_access_displacement();
 }
 
 }  // namespace blas
@@ -0,0 +1,378 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_STREAM_K_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_GEMM_STREAM_K_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::
+    GemmStreamK(input_t A, input_t B, output_t C, element_t alpha,
+                element_t beta, index_t num_wg, workspace_t workspace,
+                counter_t counters)
+    : a_(A),
+      b_(B),
+      c_(C),
+      workspace_(workspace),
+      counters_(counters),
+      alpha_(alpha),
+      beta_(beta),
+      m_(a_.get_size_row()),
+      n_(b_.get_size_col()),
+      k_(a_.get_size_col()),
+      lda_(a_.getSizeL()),
+      ldb_(b_.getSizeL()),
+      ldc_(c_.getSizeL()),
+      tiles_m_((m_ - 1) / block_rows + 1),
+      iters_per_tile_((k_ - 1) / block_k + 1),
+      num_iters_(get_num_tiles(m_, n_) * iters_per_tile_),
+      num_wg_(num_wg),
+      iters_per_wg_((num_iters_ - 1) / num_wg + 1) {}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE std::string
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "GemmStreamK <" << ClSize << ", " << tile_type::get_type_string()
+      << ", " << type_string<value_t>::get_value() << "_"
+      << type_string<element_t>::get_value() << ", " << TransA << ", "
+      << TransB << ">";
+  return str.str();
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE typename GemmStreamK<
+    input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+    is_beta_zero, workspace_t, counter_t>::index_t
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::get_num_tiles(index_t m,
+                                                                 index_t n)
+    noexcept {
+  return ((m - 1) / block_rows + 1) * ((n - 1) / block_cols + 1);
+}
+
+/*!
+ * @brief One work group per compute unit, unless there are fewer iterations.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE typename GemmStreamK<
+    input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+    is_beta_zero, workspace_t, counter_t>::index_t
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::
+    get_num_work_groups(index_t compute_units, index_t m, index_t n,
+                        index_t k) noexcept {
+  const index_t num_iters = get_num_tiles(m, n) * ((k - 1) / block_k + 1);
+  return std::max(index_t(1), std::min(compute_units, num_iters));
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::get_nd_range()
+    const noexcept {
+  return sycl::nd_range<1>(sycl::range<1>(num_wg_ * wg_size),
+                           sycl::range<1>(wg_size));
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE bool
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t,
+            counter_t>::valid_thread(const sycl::nd_item<1>&) const {
+  return true;
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+template <typename local_memory_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::eval(local_memory_t
+                                                            scratch_acc,
+                                                        sycl::nd_item<1>
+                                                            id) noexcept {
+  auto scratch = scratch_acc.localAcc.get_pointer();
+  const index_t wg_id = id.get_group(0);
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+
+  const index_t wg_iter_begin = wg_id * iters_per_wg_;
+  const index_t wg_iter_end = std::min(wg_iter_begin + iters_per_wg_,
+                                       num_iters_);
+  element_t reg_res[item_rows * item_cols];
+
+  // Each segment of the iterations of the work group is in a single tile
+  for (index_t iter = wg_iter_begin; iter < wg_iter_end;) {
+    const index_t tile = iter / iters_per_tile_;
+    const index_t tile_iter_begin = tile * iters_per_tile_;
+    const index_t tile_iter_end = tile_iter_begin + iters_per_tile_;
+    const index_t segment_end = std::min(wg_iter_end, tile_iter_end);
+    const index_t row_start = (tile % tiles_m_) * block_rows;
+    const index_t col_start = (tile / tiles_m_) * block_cols;
+
+    accumulate(scratch, id, row_start, col_start, iter - tile_iter_begin,
+               segment_end - tile_iter_begin, reg_res);
+
+    if (iter == tile_iter_begin && segment_end == tile_iter_end) {
+      store(row_start, col_start, item_row, item_col, reg_res);
+    } else {
+      // The first segment of a work group is in its first slot of the
+      // workspace, the last one in the second
+      const index_t slot = iter == wg_iter_begin ? 0 : 1;
+      fixup(id, tile, slot, segment_end - iter, row_start, col_start,
+            reg_res);
+    }
+    iter = segment_end;
+  }
+}
+
+/*!
+ * @brief Accumulates the product of the blocks of K from iter_begin to
+ * iter_end of the tile starting at (row_start, col_start) in reg_res.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+template <typename local_ptr_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::
+    accumulate(local_ptr_t scratch, sycl::nd_item<1> id, index_t row_start,
+               index_t col_start, index_t iter_begin, index_t iter_end,
+               element_t* reg_res) noexcept {
+  // The A block is stored with its rows contiguous and the B block with its
+  // depth contiguous
+  auto s_a = scratch;
+  auto s_b = scratch + block_rows * block_k;
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+
+#pragma unroll
+  for (index_t i = 0; i < item_rows * item_cols; ++i) {
+    reg_res[i] = element_t{0};
+  }
+
+  for (index_t iter = iter_begin; iter < iter_end; ++iter) {
+    const index_t k_start = iter * block_k;
+    // Cooperative loads of the A and B blocks, zero-padded at the edges
+    for (index_t idx = item_id; idx < block_rows * block_k; idx += wg_size) {
+      const index_t row = row_start + idx % block_rows;
+      const index_t k = k_start + idx / block_rows;
+      s_a[idx] = (row < m_ && k < k_)
+                     ? a_.template eval<true>(TransA ? row * lda_ + k
+                                                     : k * lda_ + row)
+                     : value_t{0};
+    }
+    for (index_t idx = item_id; idx < block_k * block_cols; idx += wg_size) {
+      const index_t k = k_start + idx % block_k;
+      const index_t col = col_start + idx / block_k;
+      s_b[idx] = (col < n_ && k < k_)
+                     ? b_.template eval<true>(TransB ? k * ldb_ + col
+                                                     : col * ldb_ + k)
+                     : value_t{0};
+    }
+    sycl::group_barrier(id.get_group());
+
+#pragma unroll
+    for (index_t k = 0; k < block_k; ++k) {
+      value_t reg_a[item_rows];
+#pragma unroll
+      for (index_t i = 0; i < item_rows; ++i) {
+        reg_a[i] = s_a[k * block_rows + item_row + i * wg_rows];
+      }
+#pragma unroll
+      for (index_t j = 0; j < item_cols; ++j) {
+        const value_t b = s_b[(item_col + j * wg_cols) * block_k + k];
+#pragma unroll
+        for (index_t i = 0; i < item_rows; ++i) {
+          reg_res[j * item_rows + i] =
+              mul_add(reg_a[i], b, reg_res[j * item_rows + i]);
+        }
+      }
+    }
+    sycl::group_barrier(id.get_group());
+  }
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t,
+            counter_t>::store(index_t row_start, index_t col_start,
+                              index_t item_row, index_t item_col,
+                              const element_t* reg_res) noexcept {
+#pragma unroll
+  for (index_t j = 0; j < item_cols; ++j) {
+    const index_t col = col_start + item_col + j * wg_cols;
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t row = row_start + item_row + i * wg_rows;
+      if (row < m_ && col < n_) {
+        const index_t idx = col * ldc_ + row;
+        c_.template eval<true>(idx) =
+            is_beta_zero
+                ? alpha_ * reg_res[j * item_rows + i]
+                : alpha_ * reg_res[j * item_rows + i] +
+                      beta_ * static_cast<element_t>(
+                                  c_.template eval<true>(idx));
+      }
+    }
+  }
+}
+
+/*!
+ * @brief Stores the partial tile of the work group to its slot of the
+ * workspace and counts its iterations. The last work group to finish its part
+ * of the tile sums the partial tiles of all the work groups sharing it, in
+ * order, and stores the result to C.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::
+    fixup(sycl::nd_item<1> id, index_t tile, index_t slot, index_t num_iters,
+          index_t row_start, index_t col_start,
+          const element_t* reg_res) noexcept {
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+  const index_t wg_id = id.get_group(0);
+
+  const index_t partial_offset = (2 * wg_id + slot) * partial_tile_size;
+#pragma unroll
+  for (index_t j = 0; j < item_cols; ++j) {
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t idx =
+          (item_col + j * wg_cols) * block_rows + item_row + i * wg_rows;
+      workspace_.template eval<true>(partial_offset + idx) =
+          reg_res[j * item_rows + i];
+    }
+  }
+
+  // Releases the partial tile of each work item before counting the
+  // iterations of the work group
+  sycl::atomic_fence(sycl::memory_order::release, sycl::memory_scope::device);
+  sycl::group_barrier(id.get_group());
+  bool is_last = false;
+  if (item_id == 0) {
+    auto counter = sycl::atomic_ref<uint32_t, sycl::memory_order::acq_rel,
+                                    sycl::memory_scope::device,
+                                    sycl::access::address_space::global_space>(
+        counters_.get_data()[tile]);
+    is_last = counter.fetch_add(static_cast<uint32_t>(num_iters)) +
+                  static_cast<uint32_t>(num_iters) ==
+              static_cast<uint32_t>(iters_per_tile_);
+  }
+  is_last = sycl::group_broadcast(id.get_group(), is_last);
+  if (!is_last) {
+    return;
+  }
+
+  sycl::atomic_fence(sycl::memory_order::acquire, sycl::memory_scope::device);
+  const index_t tile_iter_begin = tile * iters_per_tile_;
+  const index_t first_wg = tile_iter_begin / iters_per_wg_;
+  const index_t last_wg = (tile_iter_begin + iters_per_tile_ - 1) /
+                          iters_per_wg_;
+#pragma unroll
+  for (index_t j = 0; j < item_cols; ++j) {
+    const index_t col = col_start + item_col + j * wg_cols;
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t row = row_start + item_row + i * wg_rows;
+      const index_t idx =
+          (item_col + j * wg_cols) * block_rows + item_row + i * wg_rows;
+      element_t sum{0};
+      for (index_t wg = first_wg; wg <= last_wg; ++wg) {
+        // The tile is the first one of the work groups starting in it
+        const index_t wg_slot =
+            (wg * iters_per_wg_) / iters_per_tile_ == tile ? 0 : 1;
+        sum += workspace_.template eval<true>(
+            (2 * wg + wg_slot) * partial_tile_size + idx);
+      }
+      if (row < m_ && col < n_) {
+        const index_t c_idx = col * ldc_ + row;
+        c_.template eval<true>(c_idx) =
+            is_beta_zero ? alpha_ * sum
+                         : alpha_ * sum + beta_ * static_cast<element_t>(
+                                                      c_.template eval<true>(
+                                                          c_idx));
+      }
+    }
+  }
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t, counter_t>::bind(sycl::handler& h) {
+  a_.bind(h);
+  b_.bind(h);
+  c_.bind(h);
+  workspace_.bind(h);
+  counters_.bind(h);
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransA, bool TransB, typename element_t, bool is_beta_zero,
+          typename workspace_t, typename counter_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB, element_t,
+            is_beta_zero, workspace_t,
+            counter_t>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+  workspace_.adjust_access_displacement();
+  counters_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_STREAM_K_HPP
@@ -0,0 +1,277 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_GEMM_TRIANGULAR_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_GEMM_TRIANGULAR_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t, is_beta_zero>::
+    GemmTriangular(input_t A, input_t B, output_t C, element_t alpha,
+                   element_t alpha2, element_t beta, index_t n, index_t k)
+    : a_(A),
+      b_(B),
+      c_(C),
+      alpha_(alpha),
+      alpha2_(alpha2),
+      beta_(beta),
+      n_(n),
+      k_(k),
+      lda_(a_.getSizeL()),
+      ldb_(b_.getSizeL()),
+      ldc_(c_.getSizeL()) {}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE std::string
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "GemmTriangular <" << ClSize << ", " << tile_type::get_type_string()
+      << ", " << type_string<value_t>::get_value() << "_"
+      << type_string<element_t>::get_value() << ", " << TransX << ", "
+      << TransY << ", " << IsUpper << ", " << Rank2 << ">";
+  return str.str();
+}
+
+/*!
+ * @brief Number of tiles intersecting a triangle of an n x n matrix.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE typename GemmTriangular<
+    input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX, ConjY,
+    IsUpper, Rank2, Hermitian, element_t, is_beta_zero>::index_t
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::get_num_tiles(index_t n) noexcept {
+  const index_t tiles = (n - 1) / block_size + 1;
+  return tiles * (tiles + 1) / 2;
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::get_nd_range() const noexcept {
+  return sycl::nd_range<1>(sycl::range<1>(get_num_tiles(n_) * wg_size),
+                           sycl::range<1>(wg_size));
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE bool
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::valid_thread(const sycl::nd_item<1>&) const {
+  return true;
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+template <typename local_memory_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::eval(local_memory_t scratch_acc,
+                                   sycl::nd_item<1> id) noexcept {
+  auto scratch = scratch_acc.localAcc.get_pointer();
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+
+  // The work groups are numbered along the tiles of the lower triangle, row
+  // after row, the upper triangle being its transpose. The float estimate of
+  // the row is corrected for the large triangles.
+  const index_t wg_id = id.get_group(0);
+  index_t outer = static_cast<index_t>(
+      (sycl::sqrt(8.f * static_cast<float>(wg_id) + 1.f) - 1.f) / 2.f);
+  while (outer * (outer + 1) / 2 > wg_id) {
+    --outer;
+  }
+  while ((outer + 1) * (outer + 2) / 2 <= wg_id) {
+    ++outer;
+  }
+  const index_t inner = wg_id - outer * (outer + 1) / 2;
+  const index_t row_start = (IsUpper ? inner : outer) * block_size;
+  const index_t col_start = (IsUpper ? outer : inner) * block_size;
+
+  element_t reg_res[item_rows * item_cols];
+#pragma unroll
+  for (index_t i = 0; i < item_rows * item_cols; ++i) {
+    reg_res[i] = element_t{0};
+  }
+  accumulate<false>(scratch, id, row_start, col_start, alpha_, reg_res);
+  if constexpr (Rank2) {
+    accumulate<true>(scratch, id, row_start, col_start, alpha2_, reg_res);
+  }
+
+#pragma unroll
+  for (index_t j = 0; j < item_cols; ++j) {
+    const index_t col = col_start + item_col + j * wg_cols;
+#pragma unroll
+    for (index_t i = 0; i < item_rows; ++i) {
+      const index_t row = row_start + item_row + i * wg_rows;
+      // Masks the elements of the diagonal tiles outside of the triangle
+      if (row < n_ && col < n_ && (IsUpper ? row <= col : row >= col)) {
+        const index_t idx = col * ldc_ + row;
+        element_t res = is_beta_zero
+                            ? reg_res[j * item_rows + i]
+                            : reg_res[j * item_rows + i] +
+                                  beta_ * static_cast<element_t>(
+                                              c_.template eval<true>(idx));
+        if constexpr (Hermitian) {
+          if (row == col) {
+            res = element_t(res.real(), 0);
+          }
+        }
+        c_.template eval<true>(idx) = res;
+      }
+    }
+  }
+}
+
+/*!
+ * @brief Accumulates scale * X * Y^T to reg_res, X being read from B and Y
+ * from A when FromB.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+template <bool FromB, typename local_ptr_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t, is_beta_zero>::
+    accumulate(local_ptr_t scratch, sycl::nd_item<1> id, index_t row_start,
+               index_t col_start, element_t scale,
+               element_t* reg_res) noexcept {
+  // Both blocks are stored with their rows contiguous
+  auto s_x = scratch;
+  auto s_y = scratch + block_size * block_k;
+  const index_t item_id = id.get_local_id(0);
+  const index_t item_row = item_id % wg_rows;
+  const index_t item_col = item_id / wg_rows;
+
+  for (index_t k_start = 0; k_start < k_; k_start += block_k) {
+    load_block<FromB, TransX, ConjX>(s_x, row_start, k_start, scale, item_id);
+    load_block<!FromB, TransY, ConjY>(s_y, col_start, k_start, element_t{1},
+                                      item_id);
+    sycl::group_barrier(id.get_group());
+
+#pragma unroll
+    for (index_t l = 0; l < block_k; ++l) {
+      value_t reg_x[item_rows];
+#pragma unroll
+      for (index_t i = 0; i < item_rows; ++i) {
+        reg_x[i] = s_x[l * block_size + item_row + i * wg_rows];
+      }
+#pragma unroll
+      for (index_t j = 0; j < item_cols; ++j) {
+        const value_t y = s_y[l * block_size + item_col + j * wg_cols];
+#pragma unroll
+        for (index_t i = 0; i < item_rows; ++i) {
+          reg_res[j * item_rows + i] =
+              mul_add(reg_x[i], y, reg_res[j * item_rows + i]);
+        }
+      }
+    }
+    sycl::group_barrier(id.get_group());
+  }
+}
+
+/*!
+ * @brief Loads the block_size x block_k block of X or Y starting at row
+ * start, zero-padded at the edges.
+ */
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+template <bool FromB, bool Trans, bool Conj, typename local_ptr_t>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t, is_beta_zero>::
+    load_block(local_ptr_t s, index_t start, index_t k_start, element_t scale,
+               index_t item_id) noexcept {
+  const index_t ld = FromB ? ldb_ : lda_;
+  for (index_t idx = item_id; idx < block_size * block_k; idx += wg_size) {
+    const index_t row = start + idx % block_size;
+    const index_t l = k_start + idx / block_size;
+    value_t val{0};
+    if (row < n_ && l < k_) {
+      const index_t src_idx = Trans ? row * ld + l : l * ld + row;
+      if constexpr (FromB) {
+        val = b_.template eval<true>(src_idx);
+      } else {
+        val = a_.template eval<true>(src_idx);
+      }
+#ifdef BLAS_ENABLE_COMPLEX
+      // The conjugate transpose of a real matrix is its transpose
+      if constexpr (Conj && is_complex_sycl<value_t>::value) {
+        val = sycl::ext::oneapi::experimental::conj(val);
+      }
+#endif
+      val = static_cast<value_t>(scale * static_cast<element_t>(val));
+    }
+    s[idx] = val;
+  }
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::bind(sycl::handler& h) {
+  a_.bind(h);
+  b_.bind(h);
+  c_.bind(h);
+}
+
+template <typename input_t, typename output_t, int ClSize, typename tile_type,
+          bool TransX, bool TransY, bool ConjX, bool ConjY, bool IsUpper,
+          bool Rank2, bool Hermitian, typename element_t, bool is_beta_zero>
+ONEMATH_SYCL_BLAS_INLINE void
+GemmTriangular<input_t, output_t, ClSize, tile_type, TransX, TransY, ConjX,
+               ConjY, IsUpper, Rank2, Hermitian, element_t,
+               is_beta_zero>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_GEMM_TRIANGULAR_HPP
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_BLAS3_TRMM_HPP
+#define ONEMATH_SYCL_BLAS_BLAS3_TRMM_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view.h"
+
+#include <sycl/sycl.hpp>
+
+namespace blas {
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize, lhs_t,
+                          rhs_t, element_t>::
+    TriangularBlockMultiplier(rhs_t A, lhs_t B, element_t alpha, index_t n,
+                              index_t m, index_t max_wg_size)
+    : A_(A),
+      B_(B),
+      alpha_(alpha),
+      n_(n),
+      m_(m),
+      lda_(A_.getSizeL()),
+      ldb_(B_.getSizeL()),
+      wg_cols_(std::max<index_t>(
+          1, std::min<index_t>(BlockSize / item_cols,
+                               max_wg_size / BlockSize))) {}
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE sycl::nd_range<1>
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize, lhs_t,
+                          rhs_t, element_t>::get_nd_range() const noexcept {
+  const index_t num_panels = (m_ - 1) / BlockSize + 1;
+  const index_t wg_size = BlockSize * wg_cols_;
+  return sycl::nd_range<1>(sycl::range<1>(num_panels * wg_size),
+                           sycl::range<1>(wg_size));
+}
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE bool
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize, lhs_t,
+                          rhs_t, element_t>::valid_thread(sycl::nd_item<1>)
+    const {
+  return true;
+}
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE void
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize, lhs_t,
+                          rhs_t, element_t>::bind(sycl::handler& cgh) {
+  A_.bind(cgh);
+  B_.bind(cgh);
+}
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+ONEMATH_SYCL_BLAS_INLINE void
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize, lhs_t,
+                          rhs_t, element_t>::adjust_access_displacement() {
+  A_.adjust_access_displacement();
+  B_.adjust_access_displacement();
+}
+
+template <bool Left, bool Upper, bool Trans, bool Conj, bool UnitDiag,
+          int BlockSize, typename lhs_t, typename rhs_t, typename element_t>
+template <typename local_memory_t>
+ONEMATH_SYCL_BLAS_INLINE void
+TriangularBlockMultiplier<Left, Upper, Trans, Conj, UnitDiag, BlockSize, lhs_t,
+                          rhs_t, element_t>::
+    eval(local_memory_t localMem, sycl::nd_item<1> id) noexcept {
+  value_t* local = localMem.localAcc.get_pointer();
+  value_t* s_a = local;
+  value_t* s_b = local + BlockSize * BlockSize;
+  const index_t item_id = id.get_local_id(0);
+  const index_t panel_start = id.get_group(0) * BlockSize;
+  const index_t wg_size = BlockSize * wg_cols_;
+
+  // Both blocks are stored column-major, op(A) densely
+  for (index_t idx = item_id; idx < BlockSize * BlockSize; idx += wg_size) {
+    const index_t row = idx % BlockSize;
+    const index_t col = idx / BlockSize;
+    // A(i, j) holds op(A)(row, col)
+    const index_t i = Trans ? col : row;
+    const index_t j = Trans ? row : col;
+    value_t val{0};
+    if (i < n_ && j < n_) {
+      if (UnitDiag && i == j) {
+        val = value_t{1};
+      } else if (Upper ? i <= j : i >= j) {
+        val = A_.template eval<true>(j * lda_ + i);
+#ifdef BLAS_ENABLE_COMPLEX
+        // The conjugate transpose of a real matrix is its transpose
+        if constexpr (Conj && is_complex_sycl<value_t>::value) {
+          val = sycl::ext::oneapi::experimental::conj(val);
+        }
+#endif
+      }
+    }
+    s_a[idx] = val;
+
+    const index_t b_row = Left ? row : panel_start + row;
+    const index_t b_col = Left ? panel_start + col : col;
+    const bool in_b =
+        Left ? (row < n_ && b_col < m_) : (b_row < m_ && col < n_);
+    s_b[idx] = in_b ? B_.template eval<true>(b_col * ldb_ + b_row) : value_t{0};
+  }
+  sycl::group_barrier(id.get_group());
+
+  const index_t row = item_id % BlockSize;
+  for (index_t col = item_id / BlockSize; col < BlockSize; col += wg_cols_) {
+    element_t res{0};
+#pragma unroll
+    for (index_t l = 0; l < BlockSize; ++l) {
+      res += Left ? static_cast<element_t>(s_a[l * BlockSize + row]) *
+                        static_cast<element_t>(s_b[col * BlockSize + l])
+                  : static_cast<element_t>(s_b[l * BlockSize + row]) *
+                        static_cast<element_t>(s_a[col * BlockSize + l]);
+    }
+
+    const index_t b_row = Left ? row : panel_start + row;
+    const index_t b_col = Left ? panel_start + col : col;
+    const bool in_b =
+        Left ? (row < n_ && b_col < m_) : (b_row < m_ && col < n_);
+    if (in_b) {
+      B_.template eval<true>(b_col * ldb_ + b_row) =
+          static_cast<value_t>(alpha_ * res);
+    }
+  }
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_BLAS3_TRMM_HPP
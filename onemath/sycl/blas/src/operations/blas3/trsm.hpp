@@ -90,7 +90,8 @@ DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, lhs_t, rhs_t>::eval(
   const index_t destBlockOffset = offsetPart1 + offsetPart2;
 
   // Loads the source lower triangle into local memory. Any values in the upper
-  // triangle or outside of the matrix are set to zero
+  // triangle or outside of the matrix are set to zero, except the diagonal
+  // outside of the matrix which is set to one so that its inverse is finite
   for (index_t j = 0; j < internalBlockSize; ++j) {
     bool isInRange = false;
     bool onUnitDiag = UnitDiag && i == j;
@@ -99,7 +100,7 @@ DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, lhs_t, rhs_t>::eval(
     local[j + i * internalBlockSize] =
         (isInRange)
             ? (onUnitDiag ? value_t{1} : A[j * lda_ + i + srcBlockOffset])
-            : value_t{0};
+            : (i == j ? value_t{1} : value_t{0});
   }
   item.barrier(sycl::access::fence_space::local_space);
 
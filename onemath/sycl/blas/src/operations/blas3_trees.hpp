@@ -23,12 +23,18 @@
 #ifndef ONEMATH_SYCL_BLAS_BLAS3_TREES_HPP
 #define ONEMATH_SYCL_BLAS_BLAS3_TREES_HPP
 
+#include "blas3/gemm_cpu.hpp"
+#include "blas3/gemm_grouped.hpp"
 #include "blas3/gemm_interleaved.hpp"
 #include "blas3/gemm_local.hpp"
 #include "blas3/gemm_local_joint_matrix.hpp"
 #include "blas3/gemm_no_local_full_vec.hpp"
 #include "blas3/gemm_no_local_partial_vec.hpp"
+#include "blas3/gemm_packed.hpp"
 #include "blas3/gemm_partial_local.hpp"
 #include "blas3/gemm_ref.hpp"
+#include "blas3/gemm_stream_k.hpp"
+#include "blas3/gemm_triangular.hpp"
+#include "blas3/trmm.hpp"
 #include "blas3/trsm.hpp"
 #endif  // ONEMATH_SYCL_BLAS_BLAS3_TREES_HPP
@@ -72,6 +72,13 @@ struct AbsoluteValue {
        typename std::enable_if<is_floating_point<value_t>::value>::type * = 0) {
     return sycl::fabs(val);
   }
+
+#ifdef BLAS_ENABLE_BFLOAT16
+  // sycl::fabs doesn't accept bfloat16, the value is computed in float
+  static ONEMATH_SYCL_BLAS_INLINE bfloat16 eval(const bfloat16 &val) {
+    return bfloat16(sycl::fabs(static_cast<float>(val)));
+  }
+#endif  // BLAS_ENABLE_BFLOAT16
 };
 
 /*!
@@ -140,6 +147,14 @@ struct SquareOperator : public Operators {
   }
 };
 
+template <typename value_t>
+struct CastOperator : public Operators {
+  template <typename rhs_t>
+  static ONEMATH_SYCL_BLAS_INLINE value_t eval(const rhs_t r) {
+    return static_cast<value_t>(r);
+  }
+};
+
 /*!
  Definitions of binary operators
 */
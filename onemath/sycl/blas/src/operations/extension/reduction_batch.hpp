@@ -0,0 +1,156 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_EXTENSION_REDUCTION_BATCH_HPP
+#define ONEMATH_SYCL_BLAS_EXTENSION_REDUCTION_BATCH_HPP
+
+#include "blas_meta.h"
+#include "operations/blas_operators.hpp"
+#include "operations/extension/reduction_batch.h"
+
+namespace blas {
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>::Reduction_batch(
+    lhs_t _lhs, rhs_1_t _rhs_1, rhs_2_t _rhs_2, typename rhs_1_t::index_t _N,
+    typename rhs_1_t::index_t _inc_1, typename rhs_1_t::index_t _stride_1,
+    typename rhs_1_t::index_t _inc_2, typename rhs_1_t::index_t _stride_2,
+    typename rhs_1_t::index_t _batch_size)
+    : lhs_(_lhs),
+      rhs_1_(_rhs_1),
+      rhs_2_(_rhs_2),
+      n_(_N),
+      inc_1_(_inc_1),
+      stride_1_(_stride_1),
+      inc_2_(_inc_2),
+      stride_2_(_stride_2),
+      batch_size_(_batch_size){};
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+template <typename sharedT>
+ONEMATH_SYCL_BLAS_INLINE
+typename Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>::value_t
+Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>::eval(
+    sharedT scratch, sycl::nd_item<1> ndItem) {
+  const index_t n{n_};
+  const index_t inc_1{inc_1_};
+  const index_t inc_2{inc_2_};
+  const auto vx = rhs_1_.get_data();
+  const auto vy = rhs_2_.get_data();
+  const auto vr = lhs_.get_data();
+  auto sg = ndItem.get_sub_group();
+  const index_t local_id = static_cast<index_t>(ndItem.get_local_id(0));
+  const index_t sg_local_id = static_cast<index_t>(sg.get_local_id()[0]);
+  const index_t sg_size = static_cast<index_t>(sg.get_local_range()[0]);
+  const index_t num_sg = static_cast<index_t>(sg.get_group_linear_range());
+
+  // With a negative increment the first element of a vector is the last one
+  // in memory
+  const index_t offset_1 = inc_1 < 0 ? (1 - n) * inc_1 : 0;
+  const index_t offset_2 = inc_2 < 0 ? (1 - n) * inc_2 : 0;
+
+  const index_t num_groups = static_cast<index_t>(ndItem.get_group_range(0));
+  for (index_t batch = static_cast<index_t>(ndItem.get_group(0));
+       batch < batch_size_; batch += num_groups) {
+    const index_t base_1 = batch * stride_1_ + offset_1;
+    const index_t base_2 = batch * stride_2_ + offset_2;
+    value_t val{0};
+    for (index_t i = local_id; i < n; i += localSize) {
+      // The inputs are converted before the products, which would overflow
+      // or be rounded in 16 bits
+      const value_t x = static_cast<value_t>(vx[base_1 + i * inc_1]);
+      if constexpr (op == batch_reduction_t::dot) {
+        val += x * static_cast<value_t>(vy[base_2 + i * inc_2]);
+      } else if constexpr (op == batch_reduction_t::asum) {
+        val += AbsoluteValue::eval(x);
+      } else {
+        val += x * x;
+      }
+    }
+
+    val = sycl::reduce_over_group(sg, val, sycl::plus<value_t>());
+    if (sg_local_id == 0) {
+      scratch[sg.get_group_linear_id()] = val;
+    }
+    ndItem.barrier(sycl::access::fence_space::local_space);
+
+    if (sg.get_group_linear_id() == 0) {
+      val = value_t{0};
+      for (index_t j = sg_local_id; j < num_sg; j += sg_size) {
+        val += scratch[j];
+      }
+      val = sycl::reduce_over_group(sg, val, sycl::plus<value_t>());
+      if (sg_local_id == 0) {
+        if constexpr (op == batch_reduction_t::nrm2) {
+          vr[batch] = static_cast<typename lhs_t::value_t>(sycl::sqrt(val));
+        } else {
+          vr[batch] = static_cast<typename lhs_t::value_t>(val);
+        }
+      }
+    }
+    // The scratch memory is reused by the next batch entry
+    ndItem.barrier(sycl::access::fence_space::local_space);
+  }
+
+  return {};
+}
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+ONEMATH_SYCL_BLAS_INLINE void
+Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>::bind(
+    sycl::handler& h) {
+  lhs_.bind(h);
+  rhs_1_.bind(h);
+  rhs_2_.bind(h);
+}
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+ONEMATH_SYCL_BLAS_INLINE void
+Reduction_batch<op, localSize, lhs_t, rhs_1_t,
+                rhs_2_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_1_.adjust_access_displacement();
+  rhs_2_.adjust_access_displacement();
+}
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+ONEMATH_SYCL_BLAS_INLINE typename rhs_1_t::index_t
+Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>::get_size() const {
+  return n_ * batch_size_;
+}
+
+template <batch_reduction_t op, int localSize, typename lhs_t,
+          typename rhs_1_t, typename rhs_2_t>
+ONEMATH_SYCL_BLAS_INLINE bool
+Reduction_batch<op, localSize, lhs_t, rhs_1_t, rhs_2_t>::valid_thread(
+    sycl::nd_item<1> ndItem) const {
+  return true;
+}
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_EXTENSION_REDUCTION_BATCH_HPP
@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE_HPP
+#define ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE_HPP
+
+#include <cstdlib>
+#include <fstream>
+
+#include "sb_handle/gemm_tuning_cache.h"
+
+namespace blas {
+
+inline Gemm_Tuning_Cache::Gemm_Tuning_Cache(const std::string& path)
+    : path_(path) {
+  load();
+}
+
+inline std::string Gemm_Tuning_Cache::default_path() {
+  const char* path = std::getenv("ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE");
+  if (path != nullptr && path[0] != '\0') {
+    return path;
+  }
+  const char* home = std::getenv("HOME");
+  const std::string file_name = "onemath_sycl_blas_gemm_tuning.txt";
+  return (home != nullptr && home[0] != '\0')
+             ? std::string(home) + "/." + file_name
+             : file_name;
+}
+
+inline std::string Gemm_Tuning_Cache::device_key(const sycl::queue& q) {
+  const auto dev = q.get_device();
+  std::string key = dev.get_info<sycl::info::device::name>() + "|" +
+                    dev.get_info<sycl::info::device::driver_version>();
+  // Tabs and new lines are the separators of the file
+  for (auto& c : key) {
+    if (c == '\t' || c == '\n' || c == '\r') {
+      c = ' ';
+    }
+  }
+  return key;
+}
+
+inline bool Gemm_Tuning_Cache::lookup(const std::string& key,
+                                      std::string& variant) const {
+  std::lock_guard<std::mutex> lock(entries_mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return false;
+  }
+  variant = it->second;
+  return true;
+}
+
+inline void Gemm_Tuning_Cache::store(const std::string& key,
+                                     const std::string& variant) {
+  std::lock_guard<std::mutex> lock(entries_mutex_);
+  entries_[key] = variant;
+  std::ofstream file(path_, std::ios::app);
+  // The entry is still used for the lifetime of the cache if the file cannot
+  // be written
+  if (file) {
+    file << key << '\t' << variant << '\n';
+  }
+}
+
+inline size_t Gemm_Tuning_Cache::size() const {
+  std::lock_guard<std::mutex> lock(entries_mutex_);
+  return entries_.size();
+}
+
+inline void Gemm_Tuning_Cache::load() {
+  std::ifstream file(path_);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const auto sep = line.rfind('\t');
+    if (sep == std::string::npos || sep == 0 || sep + 1 == line.size()) {
+      continue;
+    }
+    entries_[line.substr(0, sep)] = line.substr(sep + 1);
+  }
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_GEMM_TUNING_CACHE_HPP
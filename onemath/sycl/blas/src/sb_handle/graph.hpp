@@ -0,0 +1,103 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_GRAPH_HPP
+#define ONEMATH_SYCL_BLAS_GRAPH_HPP
+
+#include <iostream>
+#include <stdexcept>
+
+#include "sb_handle/graph.h"
+
+namespace blas {
+
+inline SB_Graph::SB_Graph(sycl::queue q) : q_(q) {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+  // The extension can be compiled in for devices without graph support,
+  // which fall back to the list of launches
+  use_command_graph_ = q_.get_device().has(sycl::aspect::ext_oneapi_graph);
+  if (use_command_graph_) {
+    namespace syclex = sycl::ext::oneapi::experimental;
+    // The operators can be given buffers, which outlive the graph as long as
+    // the user keeps them alive during the replays
+    graph_.emplace(
+        q_.get_context(), q_.get_device(),
+        sycl::property_list{
+            syclex::property::graph::assume_buffer_outlives_graph{}});
+    graph_->begin_recording(q_);
+  }
+#endif
+}
+
+inline SB_Graph::~SB_Graph() {
+  try {
+    sycl::event::wait(last_events_);
+  } catch (sycl::exception& e) {
+    std::cerr << e.what() << std::endl;
+  }
+  for (auto& release : releases_) {
+    release();
+  }
+}
+
+inline void SB_Graph::end_recording() {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+  if (use_command_graph_) {
+    graph_->end_recording(q_);
+    executable_.emplace(graph_->finalize());
+  }
+#endif
+}
+
+inline bool SB_Graph::uses_command_graph() const {
+  return use_command_graph_;
+}
+
+inline typename SB_Graph::event_t SB_Graph::replay(
+    const typename SB_Graph::event_t& dependencies) {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+  if (use_command_graph_) {
+    if (!executable_) {
+      throw std::runtime_error("The graph is still being recorded");
+    }
+    last_events_ = {q_.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+      cgh.ext_oneapi_graph(*executable_);
+    })};
+    return last_events_;
+  }
+#endif
+  // Each kernel depends on the previous one, which an in-order queue already
+  // guarantees after the first kernel
+  const bool in_order = q_.is_in_order();
+  event_t events = dependencies;
+  for (size_t i = 0; i < launches_.size(); ++i) {
+    events = {launches_[i](in_order && i > 0 ? event_t{} : events)};
+  }
+  last_events_ = events;
+  return last_events_;
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_GRAPH_HPP
@@ -25,6 +25,7 @@
 #define ONEMATH_SYCL_BLAS_HANDLE_HPP
 
 #include <algorithm>
+#include <iostream>
 
 #include "blas_meta.h"
 #include "operations/blas1_trees.hpp"
@@ -33,6 +34,10 @@
 #include "helper.h"
 #include "sb_handle/kernel_constructor.h"
 #include "sb_handle/handle.h"
+#include "sb_handle/gemm_tuning_cache.hpp"
+#include "sb_handle/graph.hpp"
+#include "sb_handle/profiler.hpp"
+#include "sb_handle/scalar_result.hpp"
 #include "sb_handle/temp_memory_pool.hpp"
 #include "views/view.h"
 namespace blas {
@@ -59,11 +64,22 @@ typename std::enable_if<
 SB_Handle::release_temp_mem(const typename SB_Handle::event_t& dependencies,
                             const container_t& mem) {
 #ifndef __ADAPTIVECPP__
+  if (recording_ != nullptr) {
+    // The recorded kernels use the memory on every replay
+    recording_->retain([pool = tempMemPool_, mem]() {
+      if (pool != nullptr) pool->release_buff_mem({}, mem);
+    });
+    return {};
+  }
   if (tempMemPool_ != nullptr)
     return tempMemPool_->release_buff_mem(dependencies, mem);
-  else
+#else
+  if (recording_ != nullptr) {
+    // The recorded kernels use the buffer on every replay
+    recording_->retain([mem]() {});
+  }
 #endif
-    return {};
+  return {};
 }
 
 #ifdef SB_ENABLE_USM
@@ -86,6 +102,18 @@ typename std::enable_if<
     typename SB_Handle::event_t>::type
 SB_Handle::release_temp_mem(const typename SB_Handle::event_t& dependencies,
                             const container_t& mem) {
+  if (recording_ != nullptr) {
+    // The recorded kernels use the memory on every replay
+    sycl::context context = q_.get_context();
+    recording_->retain([pool = tempMemPool_, mem, context]() {
+      if (pool != nullptr) {
+        pool->release_usm_mem({}, mem);
+      } else {
+        sycl::free(mem, context);
+      }
+    });
+    return {};
+  }
   if (tempMemPool_ != nullptr)
     return tempMemPool_->release_usm_mem(dependencies, mem);
   else {
@@ -98,6 +126,223 @@ SB_Handle::release_temp_mem(const typename SB_Handle::event_t& dependencies,
 }
 #endif
 
+inline void SB_Handle::enable_profiling() {
+  if (!q_.has_property<sycl::property::queue::enable_profiling>()) {
+    throw std::invalid_argument(
+        "Profiling requires a queue created with the enable_profiling "
+        "property");
+  }
+  if (profiler_ == nullptr) {
+    profiler_ = std::make_shared<Kernel_Profiler>();
+  }
+}
+
+inline void SB_Handle::set_gemm_tuning(gemm_tuning_mode_t mode,
+                                       const std::string& cache_path) {
+#ifndef BLAS_ENABLE_GEMM_AUTOTUNER
+  if (mode != gemm_tuning_mode_t::disabled) {
+    throw std::runtime_error(
+        "Gemm tuning requires building with BLAS_ENABLE_GEMM_AUTOTUNER");
+  }
+#endif
+  gemmTuningMode_ = mode;
+  if (mode == gemm_tuning_mode_t::disabled) {
+    return;
+  }
+  const std::string path =
+      cache_path.empty() ? Gemm_Tuning_Cache::default_path() : cache_path;
+  if (gemmTuningCache_ == nullptr || gemmTuningCache_->get_path() != path) {
+    gemmTuningCache_ = std::make_shared<Gemm_Tuning_Cache>(path);
+  }
+}
+
+inline void SB_Handle::set_in_order_fast_path(bool enable) {
+  if (enable && !q_.is_in_order()) {
+    throw std::invalid_argument(
+        "The in-order fast path requires a queue created with the in_order "
+        "property");
+  }
+  inOrderFastPath_ = enable;
+  submittedEvents_.clear();
+  nextSubmittedEvent_ = 0;
+}
+
+inline typename SB_Handle::event_t SB_Handle::submit_barrier(
+    const typename SB_Handle::event_t& dependencies) {
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+  return {q_.ext_oneapi_submit_barrier(dependencies)};
+#else
+  return {q_.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(dependencies);
+    cgh.host_task([]() {});
+  })};
+#endif
+}
+
+inline bool SB_Handle::is_submitted_event(const sycl::event& ev) const {
+  return std::find(submittedEvents_.begin(), submittedEvents_.end(), ev) !=
+         submittedEvents_.end();
+}
+
+inline typename SB_Handle::event_t SB_Handle::external_dependencies(
+    const typename SB_Handle::event_t& dependencies) const {
+  typename SB_Handle::event_t external;
+  for (const auto& ev : dependencies) {
+    if (!is_submitted_event(ev)) {
+      external.push_back(ev);
+    }
+  }
+  return external;
+}
+
+inline void SB_Handle::append_event(typename SB_Handle::event_t& events,
+                                    const sycl::event& ev) const {
+  if (inOrderFastPath_ && is_submitted_event(ev)) {
+    // The kernel runs after the previous kernels of the handle
+    events.erase(std::remove_if(events.begin(), events.end(),
+                                [this](const sycl::event& e) {
+                                  return is_submitted_event(e);
+                                }),
+                 events.end());
+  }
+  events.push_back(ev);
+}
+
+inline void SB_Handle::append_events(
+    typename SB_Handle::event_t& events,
+    const typename SB_Handle::event_t& new_events) const {
+  if (inOrderFastPath_) {
+    for (const auto& ev : new_events) {
+      append_event(events, ev);
+    }
+  } else {
+    append_vector(events, new_events);
+  }
+}
+
+inline void SB_Handle::begin_recording() {
+  if (recording_ != nullptr) {
+    throw std::runtime_error("The SB_Handle is already recording");
+  }
+  recording_ = std::shared_ptr<SB_Graph>(new SB_Graph(q_));
+}
+
+inline std::shared_ptr<SB_Graph> SB_Handle::end_recording() {
+  if (recording_ == nullptr) {
+    throw std::runtime_error("The SB_Handle is not recording");
+  }
+  recording_->end_recording();
+  return std::move(recording_);
+}
+
+inline Pending_Host_Data::~Pending_Host_Data() {
+  for (auto& pending : pending_) {
+    try {
+      pending.first.wait();
+    } catch (sycl::exception& e) {
+      std::cerr << e.what() << std::endl;
+    }
+  }
+}
+
+inline void Pending_Host_Data::keep(const sycl::event& ev,
+                                    std::shared_ptr<const void> data) {
+  using status_t = sycl::info::event::command_execution_status;
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < pending_.size();) {
+    if (pending_[i].first.get_info<status_t>() ==
+        sycl::info::event_command_status::complete) {
+      pending_[i] = std::move(pending_.back());
+      pending_.pop_back();
+    } else {
+      i++;
+    }
+  }
+  pending_.emplace_back(ev, std::move(data));
+}
+
+template <typename submit_t>
+inline sycl::event SB_Handle::submit_command(
+    submit_t submit, const typename SB_Handle::event_t& dependencies) {
+  if (recording_ != nullptr && !recording_->uses_command_graph()) {
+    // Replayed in the recording order, the dependencies are not needed
+    recording_->add_launch(
+        [q = q_, submit](const typename SB_Handle::event_t& deps) {
+          return submit(q, deps);
+        });
+    return sycl::event();
+  }
+  // The in-order queue already orders the commands of the handle, skip their
+  // events
+  auto ev = submit(q_, inOrderFastPath_ ? external_dependencies(dependencies)
+                                        : dependencies);
+  if (inOrderFastPath_ && recording_ == nullptr) {
+    if (submittedEvents_.size() < maxSubmittedEvents_) {
+      submittedEvents_.push_back(ev);
+    } else {
+      submittedEvents_[nextSubmittedEvent_] = ev;
+    }
+    nextSubmittedEvent_ = (nextSubmittedEvent_ + 1) % maxSubmittedEvents_;
+  }
+  return ev;
+}
+
+template <typename container_t>
+inline typename SB_Handle::event_t SB_Handle::fill(
+    container_t mem, typename ValueType<container_t>::type value, size_t size,
+    const typename SB_Handle::event_t& dependencies) {
+  using element_t = typename ValueType<container_t>::type;
+  return {submit_command(
+      [=](sycl::queue q, const typename SB_Handle::event_t& deps) {
+        return helper::fill<element_t>(q, mem, value, size, deps);
+      },
+      dependencies)};
+}
+
+template <typename container_t>
+inline typename SB_Handle::event_t SB_Handle::copy_to_device(
+    const typename ValueType<container_t>::type* src, container_t mem,
+    size_t size, const typename SB_Handle::event_t& dependencies) {
+  using element_t = typename ValueType<container_t>::type;
+  // The copy reads the host data after the call, and on every replay
+  auto host = std::make_shared<const std::vector<element_t>>(src, src + size);
+  auto ev = submit_command(
+      [=](sycl::queue q, const typename SB_Handle::event_t& deps) {
+        return helper::copy_to_device<element_t>(q, host->data(), mem, size,
+                                                 deps);
+      },
+      dependencies);
+  if (recording_ != nullptr) {
+    recording_->retain([host]() {});
+  } else {
+    pendingHostData_->keep(ev, host);
+  }
+  return {ev};
+}
+
+template <int using_local_memory, typename expression_tree_t>
+inline sycl::event SB_Handle::launch(
+    expression_tree_t t, size_t localSize, size_t globalSize, size_t shMem,
+    const typename SB_Handle::event_t& dependencies) {
+  auto ev = submit_command(
+      [t, localSize, globalSize, shMem](
+          sycl::queue q, const typename SB_Handle::event_t& deps) {
+        return execute_tree<using_local_memory>(q, t, localSize, globalSize,
+                                                shMem, deps);
+      },
+      dependencies);
+  if (profiler_ != nullptr && recording_ == nullptr) {
+    using value_t =
+        typename LocalMemoryType<using_local_memory, expression_tree_t>::type;
+    size_t local_memory_bytes = 0;
+    if constexpr (!std::is_void<value_t>::value) {
+      local_memory_bytes = shMem * sizeof(value_t);
+    }
+    profiler_->record(t, ev, localSize, globalSize, local_memory_bytes);
+  }
+  return ev;
+}
+
 /*!
  * @brief Executes the tree without defining required shared memory.
  */
@@ -109,8 +354,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
 
-  return {execute_tree<using_local_memory::disabled>(
-      get_queue(), t, localSize, globalSize, 0, dependencies)};
+  return {launch<using_local_memory::disabled>(t, localSize, globalSize, 0,
+                                               dependencies)};
 };
 
 /*!
@@ -124,8 +369,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
   auto _N = t.get_size();
   auto nWG = (_N + localSize - 1) / localSize;
   auto globalSize = nWG * localSize;
-  return {execute_tree<using_local_memory::disabled>(
-      q_, t, localSize, globalSize, 0, dependencies)};
+  return {launch<using_local_memory::disabled>(t, localSize, globalSize, 0,
+                                               dependencies)};
 };
 
 /*!
@@ -136,8 +381,8 @@ template <typename expression_tree_t, typename index_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     expression_tree_t t, index_t localSize, index_t globalSize,
     const typename SB_Handle::event_t& dependencies) {
-  return {execute_tree<using_local_memory::disabled>(
-      q_, t, localSize, globalSize, 0, dependencies)};
+  return {launch<using_local_memory::disabled>(t, localSize, globalSize, 0,
+                                               dependencies)};
 }
 
 /*!
@@ -148,146 +393,105 @@ template <typename expression_tree_t, typename index_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     expression_tree_t t, index_t localSize, index_t globalSize, index_t shMem,
     const typename SB_Handle::event_t& dependencies) {
-  return {execute_tree<using_local_memory::enabled>(
-      q_, t, localSize, globalSize, shMem, dependencies)};
+  return {launch<using_local_memory::enabled>(t, localSize, globalSize, shMem,
+                                              dependencies)};
+}
+
+inline BufferIterator<uint32_t> SB_Handle::acquire_counters(
+    size_t count, typename SB_Handle::event_t& zeroed) {
+  auto counters =
+      acquire_temp_mem<helper::AllocType::buffer, uint32_t>(count);
+  zeroed = fill(counters, uint32_t{0}, count);
+  return counters;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename partials_t, typename index_t>
+inline sycl::event SB_Handle::launch_single_pass_reduction(
+    lhs_t lhs, rhs_t rhs, partials_t partials, index_t localSize, index_t nWG,
+    const typename SB_Handle::event_t& dependencies) {
+  typename SB_Handle::event_t zeroed;
+  auto counterMem = acquire_counters(1, zeroed);
+  auto counter = make_vector_view(counterMem, 1, 1);
+  auto reduction =
+      make_single_pass_reduction<operator_t>(lhs, rhs, partials, counter);
+  auto event = launch<using_local_memory::enabled>(
+      reduction, localSize, nWG * localSize, localSize,
+      concatenate_vectors(dependencies, zeroed));
+  release_temp_mem({event}, counterMem);
+  return event;
 }
 
 /*!
- * @brief Applies a reduction to a tree.
+ * @brief Applies a reduction to a tree, in a single kernel (see
+ * SinglePassReduction).
  */
 template <typename operator_t, typename lhs_t, typename rhs_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     AssignReduction<operator_t, lhs_t, rhs_t> t,
     const typename SB_Handle::event_t& dependencies) {
-  using expression_tree_t = AssignReduction<operator_t, lhs_t, rhs_t>;
-  auto _N = t.get_size();
-  auto localSize = t.local_num_thread_;
-  // IF THERE ARE ENOUGH ELEMENTS, EACH BLOCK PROCESS TWO BLOCKS OF
-  // ELEMENTS THEREFORE, 2*GLOBALSIZE ELEMENTS ARE PROCESSED IN A STEP
-  // MOREOVER, A LOOP ALLOWS TO REPEAT THE PROCESS UNTIL
-  // ALL THE ELEMENTS ARE PROCESSED
-  auto nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
-  auto lhs = t.lhs_;
-  auto rhs = t.rhs_;
-
-  // Two accessors to local memory
-  auto sharedSize = ((nWG < localSize) ? localSize : nWG);
+  using index_t = typename AssignReduction<operator_t, lhs_t, rhs_t>::index_t;
+  const index_t localSize = t.local_num_thread_;
+  const index_t nWG =
+      std::max<index_t>(1, (t.global_num_thread_ + localSize - 1) / localSize);
+
+  // One partial result per work group
   constexpr bool is_usm = std::is_pointer<typename lhs_t::container_t>::value;
-  auto shMem1 = acquire_temp_mem < is_usm ? helper::AllocType::usm
-                                          : helper::AllocType::buffer,
-       typename lhs_t::value_t > (sharedSize);
-  auto shMem2 = acquire_temp_mem < is_usm ? helper::AllocType::usm
-                                          : helper::AllocType::buffer,
-       typename lhs_t::value_t > (sharedSize);
-
-  auto opShMem1 =
-      make_vector_view(shMem1, typename lhs_t::increment_t(1), sharedSize);
-  auto opShMem2 =
-      make_vector_view(shMem2, typename lhs_t::increment_t(1), sharedSize);
-  typename SB_Handle::event_t event;
-  bool frst = true;
-  bool even = false;
-  do {
-    auto globalSize = nWG * localSize;
-    if (frst) {
-      // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
-      auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
-                                         localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, dependencies));
-    } else {
-      // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
-      auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
-          ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
-          (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, event));
-    }
-    _N = nWG;
-    nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
-    frst = false;
-    even = !even;
-  } while (_N > 1);
+  auto partialsMem = acquire_temp_mem < is_usm ? helper::AllocType::usm
+                                               : helper::AllocType::buffer,
+       typename lhs_t::value_t > (nWG);
+  auto partials = make_vector_view(partialsMem, unit_stride_t{}, nWG);
 
-  release_temp_mem({*event.rbegin()}, shMem1);
+  typename SB_Handle::event_t event{launch_single_pass_reduction<operator_t>(
+      t.lhs_, t.rhs_, partials, localSize, nWG, dependencies)};
 
-  release_temp_mem({*event.rbegin()}, shMem2);
+  release_temp_mem(event, partialsMem);
 
   return event;
 }
 
 /*!
- * @brief Applies a reduction to a tree, receiving a scratch
- * BufferIterator.
+ * @brief Applies a reduction to a tree in a single kernel, receiving a
+ * scratch BufferIterator for the partial results of the work groups.
  */
 template <typename operator_t, typename lhs_t, typename rhs_t,
           typename local_memory_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     AssignReduction<operator_t, lhs_t, rhs_t> t, local_memory_t scr,
     const typename SB_Handle::event_t& dependencies) {
-  using expression_tree_t = AssignReduction<operator_t, lhs_t, rhs_t>;
-  auto _N = t.get_size();
-  auto localSize = t.local_num_thread_;
-  // IF THERE ARE ENOUGH ELEMENTS, EACH BLOCK PROCESS TWO BLOCKS OF
-  // ELEMENTS THEREFORE, 2*GLOBALSIZE ELEMENTS ARE PROCESSED IN A STEP
-  // MOREOVER, A LOOP ALLOWS TO REPEAT THE PROCESS UNTIL
-  // ALL THE ELEMENTS ARE PROCESSED
-  auto nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
-  auto lhs = t.lhs_;
-  auto rhs = t.rhs_;
-  typename SB_Handle::event_t event;
-  // Two accessors to local memory
-  auto sharedSize = ((nWG < localSize) ? localSize : nWG);
-  auto opShMem1 = lhs_t(scr, 1, sharedSize);
-  auto opShMem2 = lhs_t(scr + sharedSize, 1, sharedSize);
-
-  bool frst = true;
-  bool even = false;
-  do {
-    auto globalSize = nWG * localSize;
-    if (frst) {
-      // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
-      auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
-                                         localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, dependencies));
-    } else {
-      // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
-      auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
-          ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
-          (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          q_, localTree, localSize, globalSize, sharedSize, dependencies));
-    }
-    _N = nWG;
-    nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
-    frst = false;
-    even = !even;
-  } while (_N > 1);
-  return event;
+  using index_t = typename AssignReduction<operator_t, lhs_t, rhs_t>::index_t;
+  const index_t localSize = t.local_num_thread_;
+  const index_t nWG =
+      std::max<index_t>(1, (t.global_num_thread_ + localSize - 1) / localSize);
+  auto partials = lhs_t(scr, 1, nWG);
+
+  return {launch_single_pass_reduction<operator_t>(
+      t.lhs_, t.rhs_, partials, localSize, nWG, dependencies)};
 }
 
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
           int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
-          int VectorSize, int BatchType, bool UseJointMatrix>
+          int VectorSize, int BatchType, bool UseJointMatrix,
+          typename epilogue_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
          TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
          GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
-         UseJointMatrix>
+         UseJointMatrix, epilogue_t>
         gemm_tree,
     const typename SB_Handle::event_t& dependencies) {
   using gemm_t = Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
                       tile_type, TransA, TransB, SymmA, SymmB, element_t,
                       is_beta_zero, GemmMemoryType, GemmAlgorithm,
-                      GemmVectorization, VectorSize, BatchType, UseJointMatrix>;
+                      GemmVectorization, VectorSize, BatchType, UseJointMatrix,
+                      epilogue_t>;
   auto rng = gemm_tree.get_nd_range(SB_Handle::get_num_compute_units());
-  return {execute_tree<
+  return {launch<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      q_, gemm_tree, rng.get_local_range()[0], rng.get_global_range()[0],
+      gemm_tree, rng.get_local_range()[0], rng.get_global_range()[0],
       gemm_t::local_memory_size, dependencies)};
 }
 
@@ -305,97 +509,200 @@ inline typename SB_Handle::event_t SB_Handle::execute(
         gemm_wrapper,
     const typename SB_Handle::event_t& dependencies) {
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  using gemm_partial_t =
+      GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
+                  tile_type, TransA, TransB,
+                  static_cast<int>(gemm_split_k_t::none), is_beta_zero,
+                  element_t, GemmMemoryType>;
 
   const index_t rows = gemm_wrapper.m_;
   const index_t cols = gemm_wrapper.n_;
-  const index_t ldc = gemm_wrapper.ldc_;
-
-  /* Depth of the cube buffer */
-  const index_t depth = GemmPartial<
-      input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
-      TransB, false, is_beta_zero, element_t,
-      GemmMemoryType>::get_ideal_cube_depth(SB_Handle::get_num_compute_units(),
-                                            rows, cols, gemm_wrapper.k_);
+  const index_t depth = gemm_wrapper.k_;
+
+  /* Number of slices K is split into */
+  index_t split = gemm_partial_t::get_split_k_factor(
+      SB_Handle::get_num_compute_units(), rows, cols, depth);
+
+  /* The slices are added to C with atomics unless the result must be
+   * deterministic */
+  constexpr bool has_atomics =
+      std::is_same_v<element_t, typename output_t::value_t> &&
+      (std::is_same_v<element_t, float> || std::is_same_v<element_t, double>);
+  const bool use_atomics =
+      has_atomics && !gemmDeterministic_ &&
+      (!std::is_same_v<element_t, double> ||
+       q_.get_device().has(sycl::aspect::atomic64));
+  if (!use_atomics) {
+    /* The workspace holds a copy of C per slice, it is bounded to 64MiB */
+    constexpr index_t max_workspace_size =
+        (index_t(1) << 26) / sizeof(element_t);
+    split = std::min(split,
+                     std::max(index_t(1), max_workspace_size / (rows * cols)));
+  }
 
   /* In some cases, use the tsgemm kernel as a normal gemm operation */
-  if (depth == 1 || gemm_wrapper.k_ <= 2048) {
-    GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
-                TransA, TransB, true, is_beta_zero, element_t, GemmMemoryType>
-        gemm_partial(gemm_wrapper.a_, gemm_wrapper.b_, gemm_wrapper.c_,
-                     gemm_wrapper.alpha_, gemm_wrapper.beta_, 1);
-    auto events = execute(gemm_partial, dependencies);
+  if (split == 1 || depth <= 2048) {
+    gemm_partial_t gemm_partial(
+        gemm_wrapper.a_, gemm_wrapper.b_, gemm_wrapper.c_, gemm_wrapper.alpha_,
+        gemm_wrapper.beta_, 1, gemm_wrapper.c_, gemm_wrapper.c_);
+    return execute(gemm_partial, dependencies);
+  }
 
-    return events;
+  /* Else split K */
+  if constexpr (has_atomics) {
+    if (use_atomics) {
+      /* First scale C by beta, then each slice adds alpha * A * B to it */
+      event_t events = dependencies;
+      if (is_beta_zero) {
+        auto zeroOp = make_op<UnaryOp, AdditionIdentity>(gemm_wrapper.c_);
+        auto assignOp = make_op<Assign>(gemm_wrapper.c_, zeroOp);
+        events = execute(assignOp, dependencies);
+      } else if (gemm_wrapper.beta_ != element_t{1}) {
+        auto scalOp = make_op<ScalarOp, ProductOperator>(gemm_wrapper.beta_,
+                                                         gemm_wrapper.c_);
+        auto assignOp = make_op<Assign>(gemm_wrapper.c_, scalOp);
+        events = execute(assignOp, dependencies);
+      }
+      GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize,
+                  tile_type, TransA, TransB,
+                  static_cast<int>(gemm_split_k_t::atomic), true, element_t,
+                  GemmMemoryType>
+          gemm_partial(gemm_wrapper.a_, gemm_wrapper.b_, gemm_wrapper.c_,
+                       gemm_wrapper.alpha_, gemm_wrapper.beta_, split,
+                       gemm_wrapper.c_, gemm_wrapper.c_);
+      append_events(events, execute(gemm_partial, events));
+      return events;
+    }
   }
-  /* Else use the tall and skinny algorithm */
-  constexpr bool is_usm = std::is_pointer<typename input_t::container_t>::value;
 
-  /* First step: partial gemm */
-  /* Create the cube buffer that will hold the output of the partial gemm */
-  auto cube_buffer = acquire_temp_mem < is_usm ? helper::AllocType::usm
-                                               : helper::AllocType::buffer,
-       element_t > (rows * cols * depth);
-
-  /* Create a first matrix view used for the partial gemm */
-  auto cube_gemm =
-      make_matrix_view<col_major>(cube_buffer, rows, cols * depth, rows);
-  /* Execute the partial gemm operation */
-  /* Note: we set is_beta_zero to true regardless of the value of beta
-   * because this option is meant for use with a simple Gemm only */
+  /* The slices store their contribution to a workspace, the last slice of
+   * each tile sums them into C */
+  constexpr bool is_usm = std::is_pointer<typename input_t::container_t>::value;
+  auto workspace_buffer = acquire_temp_mem < is_usm ? helper::AllocType::usm
+                                                    : helper::AllocType::buffer,
+       element_t > (rows * cols * split);
+  auto workspace =
+      make_matrix_view<col_major>(workspace_buffer, rows, cols * split, rows);
+  const index_t num_tiles_mn = gemm_partial_t::get_num_tiles_mn(rows, cols);
+  typename SB_Handle::event_t zeroed;
+  auto countersMem = acquire_counters(num_tiles_mn, zeroed);
+  auto counters = make_vector_view(countersMem, 1, num_tiles_mn);
   GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
-              TransA, TransB, false, true, element_t, GemmMemoryType>
-      gemm_partial(gemm_wrapper.a_, gemm_wrapper.b_, cube_gemm,
-                   gemm_wrapper.alpha_, gemm_wrapper.beta_, depth);
-  auto events = execute(gemm_partial, dependencies);
-
-  /* Create a second view used for the reduction */
-  auto cube_reduction =
-      make_matrix_view<col_major>(cube_buffer, rows * cols, depth, rows * cols);
-  using CubeType = decltype(cube_reduction);
-  constexpr auto reductions_per_thread = 64;
-  constexpr int work_group_size = tile_type::wg_rows * tile_type::wg_cols;
-  using params_t =
-      blas::ReductionParams<index_t, element_t, ClSize, work_group_size,
-                            reductions_per_thread,
-                            static_cast<int>(reduction_dim_t::outer)>;
-  /* Second step: reduction */
-  /* Best case: we can reduce directly in C */
-  if (is_beta_zero && ldc == rows) {
-    Reduction<blas::AddOperator, params_t, CubeType, output_t> reduction(
-        cube_reduction, gemm_wrapper.c_);
-    events = concatenate_vectors(events, execute(reduction, events));
-  }
-  /* Otherwise we reduce to a temporary buffer */
-  else {
-    /* Create a temporary buffer to hold alpha * A * B */
-    auto temp_buffer = acquire_temp_mem < is_usm ? helper::AllocType::usm
-                                                 : helper::AllocType::buffer,
-         element_t > (rows * cols);
-    auto temp = make_matrix_view<col_major>(temp_buffer, rows, cols, rows);
-
-    /* Execute the reduction */
-    Reduction<blas::AddOperator, params_t, CubeType, output_t> reduction(
-        cube_reduction, temp);
-    events = concatenate_vectors(events, execute(reduction, events));
-
-    /* If beta is zero, simply do a 2D copy from the temp buffer to C */
-    if (is_beta_zero) {
-      auto assignOp = make_op<Assign>(gemm_wrapper.c_, temp);
-      events = concatenate_vectors(events, execute(assignOp, events));
-    }
-    /* Else add temp and beta * C and then assign to C */
-    else {
-      auto scalOp = make_op<ScalarOp, ProductOperator>(gemm_wrapper.beta_,
-                                                       gemm_wrapper.c_);
-      auto addOp = make_op<BinaryOp, AddOperator>(temp, scalOp);
-      auto assignOp = make_op<Assign>(gemm_wrapper.c_, addOp);
-      events = concatenate_vectors(events, execute(assignOp, events));
-    }
+              TransA, TransB, static_cast<int>(gemm_split_k_t::fixup),
+              is_beta_zero, element_t, GemmMemoryType, decltype(workspace),
+              decltype(counters)>
+      gemm_partial(gemm_wrapper.a_, gemm_wrapper.b_, gemm_wrapper.c_,
+                   gemm_wrapper.alpha_, gemm_wrapper.beta_, split, workspace,
+                   counters);
+  auto events =
+      execute(gemm_partial, concatenate_vectors(dependencies, zeroed));
+  release_temp_mem(events, workspace_buffer);
+  release_temp_mem(events, countersMem);
 
-    release_temp_mem(events, temp_buffer);
-  }
+  return events;
+}
 
-  release_temp_mem(events, cube_buffer);
+/* Stream-K Gemm */
+template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+          bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
+          int GemmMemoryType, int GemmVectorization, int VectorSize,
+          int BatchType>
+inline typename SB_Handle::event_t SB_Handle::execute(
+    Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
+         TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
+         static_cast<int>(gemm_algorithm_t::stream_k), GemmVectorization,
+         VectorSize, BatchType>
+        gemm_wrapper,
+    const typename SB_Handle::event_t& dependencies) {
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  static_assert(!SymmA && !SymmB, "Stream-K doesn't support symm");
+  using gemm_sizes_t = GemmStreamK<input_t, output_t, ClSize, tile_type,
+                                   TransA, TransB, element_t, is_beta_zero>;
+
+  const index_t rows = gemm_wrapper.m_;
+  const index_t cols = gemm_wrapper.n_;
+  const index_t num_wg = gemm_sizes_t::get_num_work_groups(
+      SB_Handle::get_num_compute_units(), rows, cols, gemm_wrapper.k_);
+  const index_t num_tiles = gemm_sizes_t::get_num_tiles(rows, cols);
+  constexpr index_t partial_tile_size = gemm_sizes_t::partial_tile_size;
+
+  /* Two partial tiles per work group, its first and last ones */
+  constexpr bool is_usm = std::is_pointer<typename input_t::container_t>::value;
+  auto workspace_buffer = acquire_temp_mem < is_usm ? helper::AllocType::usm
+                                                    : helper::AllocType::buffer,
+       element_t > (2 * num_wg * partial_tile_size);
+  auto workspace = make_matrix_view<col_major>(
+      workspace_buffer, partial_tile_size, 2 * num_wg, partial_tile_size);
+  typename SB_Handle::event_t zeroed;
+  auto countersMem = acquire_counters(num_tiles, zeroed);
+  auto counters = make_vector_view(countersMem, 1, num_tiles);
+
+  using gemm_t =
+      GemmStreamK<input_t, output_t, ClSize, tile_type, TransA, TransB,
+                  element_t, is_beta_zero, decltype(workspace),
+                  decltype(counters)>;
+  gemm_t gemm(gemm_wrapper.a_, gemm_wrapper.b_, gemm_wrapper.c_,
+              gemm_wrapper.alpha_, gemm_wrapper.beta_, num_wg, workspace,
+              counters);
+  auto rng = gemm.get_nd_range();
+  event_t events = {launch<using_local_memory::enabled>(
+      gemm, rng.get_local_range()[0], rng.get_global_range()[0],
+      gemm_t::local_memory_size, concatenate_vectors(dependencies, zeroed))};
+  release_temp_mem(events, workspace_buffer);
+  release_temp_mem(events, countersMem);
+
+  return events;
+}
+
+/* CPU Gemm */
+template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
+          bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
+          bool SymmA, bool SymmB, typename element_t, bool is_beta_zero,
+          int GemmMemoryType, int GemmVectorization, int VectorSize,
+          int BatchType>
+inline typename SB_Handle::event_t SB_Handle::execute(
+    Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
+         TransB, SymmA, SymmB, element_t, is_beta_zero, GemmMemoryType,
+         static_cast<int>(gemm_algorithm_t::cpu), GemmVectorization,
+         VectorSize, BatchType>
+        gemm_wrapper,
+    const typename SB_Handle::event_t& dependencies) {
+  using index_t = typename std::make_signed<typename input_t::index_t>::type;
+  static_assert(!SymmA && !SymmB, "The CPU Gemm doesn't support symm");
+  static_assert(
+      BatchType == static_cast<int>(gemm_batch_type_t::strided),
+      "The CPU Gemm only supports strided batches");
+  using gemm_sizes_t = GemmCpu<input_t, output_t, tile_type, TransA, TransB,
+                               element_t, is_beta_zero>;
+
+  index_t block_m;
+  index_t block_n;
+  const index_t num_wg = gemm_sizes_t::get_blocking(
+      SB_Handle::get_num_compute_units(), gemm_wrapper.m_, gemm_wrapper.n_,
+      gemm_wrapper.batch_size_, block_m, block_n);
+  constexpr index_t workspace_size = gemm_sizes_t::workspace_size_per_wg;
+
+  /* The packed panels of A and B of each work group */
+  constexpr bool is_usm = std::is_pointer<typename input_t::container_t>::value;
+  auto workspace_buffer = acquire_temp_mem < is_usm ? helper::AllocType::usm
+                                                    : helper::AllocType::buffer,
+       element_t > (num_wg * workspace_size);
+  auto workspace = make_matrix_view<col_major>(workspace_buffer, workspace_size,
+                                               num_wg, workspace_size);
+
+  using gemm_t = GemmCpu<input_t, output_t, tile_type, TransA, TransB,
+                         element_t, is_beta_zero, decltype(workspace)>;
+  gemm_t gemm(gemm_wrapper.a_, gemm_wrapper.b_, gemm_wrapper.c_,
+              gemm_wrapper.alpha_, gemm_wrapper.beta_,
+              gemm_wrapper.batch_size_, gemm_wrapper.stridea_,
+              gemm_wrapper.strideb_, gemm_wrapper.stridec_, block_m, block_n,
+              num_wg, workspace);
+  auto rng = gemm.get_nd_range();
+  event_t events = {launch<using_local_memory::disabled>(
+      gemm, rng.get_local_range()[0], rng.get_global_range()[0], 0,
+      dependencies)};
+  release_temp_mem(events, workspace_buffer);
 
   return events;
 }
@@ -403,18 +710,20 @@ inline typename SB_Handle::event_t SB_Handle::execute(
 /* GemmPartial */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-          bool IsFinal, bool IsBetaZero, typename element_t, int GemmMemoryType>
+          int SplitK, bool IsBetaZero, typename element_t, int GemmMemoryType,
+          typename workspace_t, typename counter_t>
 inline typename SB_Handle::event_t SB_Handle::execute(
     GemmPartial<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
-                TransA, TransB, IsFinal, IsBetaZero, element_t, GemmMemoryType>
+                TransA, TransB, SplitK, IsBetaZero, element_t, GemmMemoryType,
+                workspace_t, counter_t>
         gemm_partial,
     const typename SB_Handle::event_t& dependencies) {
   auto gemm_partial_range =
       gemm_partial.get_nd_range(SB_Handle::get_num_compute_units());
-  return {execute_tree<
+  return {launch<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
              using_local_memory::enabled, using_local_memory::disabled>::type>(
-      q_, gemm_partial, gemm_partial_range.get_local_range()[0],
+      gemm_partial, gemm_partial_range.get_local_range()[0],
       gemm_partial_range.get_global_range()[0], gemm_partial.local_memory_size,
       dependencies)};
 }
@@ -427,8 +736,8 @@ inline typename SB_Handle::event_t SB_Handle::execute(
     const typename SB_Handle::event_t& dependencies) {
   auto step_range = reduction.get_nd_range(SB_Handle::get_num_compute_units());
 
-  return {execute_tree<using_local_memory::enabled>(
-      q_, reduction, step_range.get_local_range()[0],
+  return {launch<using_local_memory::enabled>(
+      reduction, step_range.get_local_range()[0],
       step_range.get_global_range()[0], params_t::get_local_memory_size(),
       dependencies)};
 }
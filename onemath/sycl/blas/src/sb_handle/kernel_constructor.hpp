@@ -194,7 +194,9 @@ static ONEMATH_SYCL_BLAS_INLINE sycl::event execute_tree(
   sycl::event ev;
   try {
     auto cg1 = [=](sycl::handler &h) mutable {
-      h.depends_on(dependencies);
+      if (!dependencies.empty()) {
+        h.depends_on(dependencies);
+      }
       t.bind(h);
       auto scratch = LocalMemory<value_t, using_local_memory>(shMem, h);
 
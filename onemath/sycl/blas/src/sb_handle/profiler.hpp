@@ -0,0 +1,203 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_PROFILER_HPP
+#define ONEMATH_SYCL_BLAS_PROFILER_HPP
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <typeinfo>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+#include "sb_handle/profiler.h"
+
+namespace blas {
+namespace internal {
+
+template <typename expression_tree_t, typename = void>
+struct has_type_string : std::false_type {};
+
+template <typename expression_tree_t>
+struct has_type_string<
+    expression_tree_t,
+    std::void_t<decltype(expression_tree_t::get_type_string())>>
+    : std::true_type {};
+
+/*!
+ * @brief Name of the kernel running an expression tree. The Gemm kernels
+ * describe their configuration with get_type_string(), the other trees are
+ * named after their (demangled) type, which contains the nested operations and
+ * the parameters of the tree such as the Reduction params.
+ */
+template <typename expression_tree_t>
+inline std::string get_kernel_name() {
+  if constexpr (has_type_string<expression_tree_t>::value) {
+    return expression_tree_t::get_type_string();
+  } else {
+    const char* name = typeid(expression_tree_t).name();
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+      std::string result(demangled);
+      std::free(demangled);
+      return result;
+    }
+#endif
+    return name;
+  }
+}
+
+}  // namespace internal
+
+template <typename expression_tree_t>
+void Kernel_Profiler::record(const expression_tree_t&,
+                             const sycl::event& event, size_t local_size,
+                             size_t global_size, size_t local_memory_size) {
+  Pending_Record rec{&internal::get_kernel_name<expression_tree_t>,
+                     global_size, local_size, local_memory_size, event};
+  std::lock_guard<std::mutex> lock(records_mutex_);
+  records_.push_back(std::move(rec));
+}
+
+inline std::vector<Kernel_Record> Kernel_Profiler::get_records() const {
+  std::vector<Pending_Record> pending;
+  {
+    std::lock_guard<std::mutex> lock(records_mutex_);
+    pending = records_;
+  }
+  // The names are demangled here rather than on every submission
+  std::vector<Kernel_Record> records;
+  records.reserve(pending.size());
+  for (const auto& rec : pending) {
+    records.push_back({rec.get_name(), rec.global_size, rec.local_size,
+                       rec.local_memory_size, rec.event});
+  }
+  return records;
+}
+
+inline void Kernel_Profiler::clear() {
+  std::lock_guard<std::mutex> lock(records_mutex_);
+  records_.clear();
+}
+
+inline Kernel_Profiler::Timestamps Kernel_Profiler::get_timestamps(
+    sycl::event event) {
+  try {
+    event.wait();
+    const uint64_t start =
+        event.get_profiling_info<sycl::info::event_profiling::command_start>();
+    const uint64_t end =
+        event.get_profiling_info<sycl::info::event_profiling::command_end>();
+    return {true, start, end};
+  } catch (const sycl::exception&) {
+    // The submission failed or the queue does not support profiling
+    return {false, 0, 0};
+  }
+}
+
+inline std::string Kernel_Profiler::escape(const std::string& str) {
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+          result += buf;
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result;
+}
+
+inline void Kernel_Profiler::dump_json(std::ostream& os) const {
+  const auto records = get_records();
+  os << "[";
+  bool first = true;
+  for (const auto& rec : records) {
+    const auto ts = get_timestamps(rec.event);
+    os << (first ? "\n" : ",\n") << "  {\"name\": \"" << escape(rec.name)
+       << "\", \"global_size\": " << rec.global_size
+       << ", \"local_size\": " << rec.local_size
+       << ", \"local_memory_size\": " << rec.local_memory_size;
+    if (ts.valid) {
+      os << ", \"start_ns\": " << ts.start << ", \"end_ns\": " << ts.end
+         << ", \"duration_ns\": " << (ts.end - ts.start);
+    }
+    os << "}";
+    first = false;
+  }
+  os << "\n]\n";
+}
+
+inline void Kernel_Profiler::dump_chrome_trace(std::ostream& os) const {
+  const auto records = get_records();
+  std::vector<Timestamps> timestamps;
+  timestamps.reserve(records.size());
+  uint64_t origin = UINT64_MAX;
+  for (const auto& rec : records) {
+    timestamps.push_back(get_timestamps(rec.event));
+    if (timestamps.back().valid) {
+      origin = std::min(origin, timestamps.back().start);
+    }
+  }
+  // Complete events ("ph": "X") with timestamps in microseconds, relative to
+  // the first kernel
+  os << "{\"traceEvents\": [";
+  bool first = true;
+  for (size_t i = 0; i < records.size(); i++) {
+    if (!timestamps[i].valid) {
+      continue;
+    }
+    os << (first ? "\n" : ",\n") << "  {\"name\": \""
+       << escape(records[i].name)
+       << "\", \"cat\": \"kernel\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0"
+       << ", \"ts\": " << (timestamps[i].start - origin) * 1e-3
+       << ", \"dur\": " << (timestamps[i].end - timestamps[i].start) * 1e-3
+       << ", \"args\": {\"global_size\": " << records[i].global_size
+       << ", \"local_size\": " << records[i].local_size
+       << ", \"local_memory_size\": " << records[i].local_memory_size << "}}";
+    first = false;
+  }
+  os << "\n], \"displayTimeUnit\": \"ns\"}\n";
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_PROFILER_HPP
@@ -0,0 +1,144 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_SCALAR_RESULT_HPP
+#define ONEMATH_SYCL_BLAS_SCALAR_RESULT_HPP
+
+#include "sb_handle/scalar_result.h"
+
+namespace blas {
+
+namespace internal {
+inline bool is_complete(const std::vector<sycl::event>& events) {
+  for (const auto& ev : events) {
+    if (ev.get_info<sycl::info::event::command_execution_status>() !=
+        sycl::info::event_command_status::complete) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace internal
+
+template <typename value_t>
+inline bool Scalar_Result<value_t>::is_ready() const {
+  return internal::is_complete(events_);
+}
+
+inline Scalar_Result_Lease::~Scalar_Result_Lease() {
+  pool->release(index, events);
+}
+
+template <typename container_t>
+inline Scalar_Result<typename Scalar_Result_Slot<container_t>::value_t>
+Scalar_Result_Slot<container_t>::make_result(sycl::queue q,
+                                             const event_t& dependencies) {
+  const event_t copy_event = {
+      helper::copy_to_host(q, device, host, 1, dependencies)};
+  // The slot can be reused once the value has been copied and read
+  lease->events = copy_event;
+  return Scalar_Result<value_t>(host, copy_event, lease);
+}
+
+inline Scalar_Result_Pool::~Scalar_Result_Pool() {
+  // The leases keep the pool alive, so only the copies of released slots can
+  // still be running
+  q_.wait();
+  for (void* slab : host_slabs_) sycl::free(slab, q_);
+#ifdef SB_ENABLE_USM
+  for (void* slab : usm_slabs_) {
+    if (slab != nullptr) sycl::free(slab, q_);
+  }
+#endif
+}
+
+inline size_t Scalar_Result_Pool::get_num_slots() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_slots_;
+}
+
+inline size_t Scalar_Result_Pool::acquire_index() {
+  for (auto it = free_slots_.begin(); it != free_slots_.end(); ++it) {
+    if (in_order_ || internal::is_complete(it->second)) {
+      const size_t index = it->first;
+      *it = std::move(free_slots_.back());
+      free_slots_.pop_back();
+      return index;
+    }
+  }
+  if (num_slots_ % slots_per_slab == 0) {
+    host_slabs_.push_back(
+        sycl::malloc_host(slots_per_slab * slot_size, q_.get_context()));
+#ifdef SB_ENABLE_USM
+    usm_slabs_.push_back(nullptr);
+#endif
+  }
+  buffers_.emplace_back();
+  return num_slots_++;
+}
+
+inline void Scalar_Result_Pool::release(size_t index, const event_t& events) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  free_slots_.emplace_back(index, events);
+}
+
+template <helper::AllocType alloc, typename value_t>
+Scalar_Result_Slot<typename helper::AllocHelper<value_t, alloc>::type>
+Scalar_Result_Pool::acquire() {
+  static_assert(
+      sizeof(value_t) <= slot_size && slot_size % sizeof(value_t) == 0,
+      "Unsupported scalar result type");
+  using container_t = typename helper::AllocHelper<value_t, alloc>::type;
+  std::lock_guard<std::mutex> lock(mutex_);
+  const size_t index = acquire_index();
+  value_t* host = static_cast<value_t*>(get_host_ptr(index));
+  // The lease is created last (and not with make_shared, which would destroy
+  // a temporary lease), as destroying it releases the slot
+  if constexpr (alloc == helper::AllocType::buffer) {
+    auto& buff = buffers_[index];
+    if (!buff) {
+      buff.emplace(sycl::range<1>(slot_size));
+    }
+    return {container_t{buff->template reinterpret<value_t>(
+                sycl::range<1>(slot_size / sizeof(value_t)))},
+            host,
+            std::shared_ptr<Scalar_Result_Lease>(
+                new Scalar_Result_Lease{shared_from_this(), index, {}})};
+  } else {
+#ifdef SB_ENABLE_USM
+    void*& slab = usm_slabs_[index / slots_per_slab];
+    if (slab == nullptr) {
+      slab = sycl::malloc_device(slots_per_slab * slot_size, q_);
+    }
+    container_t device = reinterpret_cast<value_t*>(
+        static_cast<int8_t*>(slab) + (index % slots_per_slab) * slot_size);
+    return {device, host,
+            std::shared_ptr<Scalar_Result_Lease>(
+                new Scalar_Result_Lease{shared_from_this(), index, {}})};
+#endif
+  }
+}
+
+}  // namespace blas
+
+#endif  // ONEMATH_SYCL_BLAS_SCALAR_RESULT_HPP
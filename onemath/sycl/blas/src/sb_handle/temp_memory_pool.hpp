@@ -4,116 +4,223 @@
 #include "helper.h"
 
 namespace blas {
+
+inline size_t Temp_Mem_Pool::size_class(size_t byte_size) {
+  size_t cls = 0;
+  while (cls < num_size_classes && class_byte_size(cls) < byte_size) {
+    cls++;
+  }
+  return cls;
+}
+
+inline void Temp_Mem_Pool::trim(size_t max_cached_bytes) {
+  trim_buffers(max_cached_bytes);
+#ifdef SB_ENABLE_USM
+  trim_usm(max_cached_bytes);
+#endif
+}
+
+inline size_t Temp_Mem_Pool::num_cached_buffers() {
+  size_t count = 0;
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (const auto& free_list : shard.buffers) count += free_list.size();
+  }
+  return count;
+}
+
 template <typename value_t>
 typename helper::AllocHelper<value_t, helper::AllocType::buffer>::type
 Temp_Mem_Pool::acquire_buff_mem(size_t size) {
-  const size_t pad = sizeof(double) / sizeof(value_t);
-  // Adjust the requested size in order to reinterpret for double's
-  size += (pad - size % pad);
-  const size_t byteSize = size * sizeof(value_t);
-  temp_buffer_map_mutex_.lock();  // lock
-  auto found = temp_buffer_map_.lower_bound(byteSize);
-  if (found != temp_buffer_map_.end()) {
-    sycl::buffer<temp_buffer_map_t::mapped_type::value_type, 1> buff =
-        found->second;
-    temp_buffer_map_tot_byte_size_ -= found->first;
-    temp_buffer_map_.erase(found);
-    temp_buffer_map_mutex_.unlock();  // unlock
-    return blas::BufferIterator<value_t>{buff.reinterpret<value_t>(
-        sycl::range<1>(buff.byte_size() / sizeof(value_t)))};
-  } else {
-    temp_buffer_map_mutex_.unlock();  // unlock
+  const size_t cls = size_class(size * sizeof(value_t));
+  // The buffers are cached as bytes, reinterpreting them requires the size
+  // class to be a multiple of the element size
+  if (cls == num_size_classes || class_byte_size(cls) % sizeof(value_t) != 0) {
+    return make_sycl_iterator_buffer<value_t>(size);
+  }
+  const size_t byteSize = class_byte_size(cls);
+  const size_t num_elems = byteSize / sizeof(value_t);
+  // Look in the shard of the thread first, then in the others
+  const size_t first_shard = get_shard_index();
+  for (size_t i = 0; i < num_shards; i++) {
+    shard_t& shard = shards_[(first_shard + i) % num_shards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& free_list = shard.buffers[cls];
+    if (!free_list.empty()) {
+      buffer_t buff = free_list.back();
+      free_list.pop_back();
+      temp_buffer_tot_byte_size_ -= byteSize;
+      return blas::BufferIterator<value_t>{
+          buff.template reinterpret<value_t>(sycl::range<1>(num_elems))};
+    }
+  }
 #ifdef VERBOSE
-    std::cout << "Create a temporary buffer of " << byteSize << " bytes."
-              << std::endl;
+  std::cout << "Create a temporary buffer of " << byteSize << " bytes."
+            << std::endl;
 #endif
-    return make_sycl_iterator_buffer<value_t>(size);
+  return make_sycl_iterator_buffer<value_t>(num_elems);
+}
+
+inline void Temp_Mem_Pool::trim_buffers(size_t max_cached_bytes) {
+  // Destroying a buffer waits for the kernels using it, so the evicted buffers
+  // are destroyed once the locks are released
+  std::vector<buffer_t> evicted;
+  for (size_t cls = num_size_classes;
+       cls-- > 0 && temp_buffer_tot_byte_size_ > max_cached_bytes;) {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto& free_list = shard.buffers[cls];
+      while (!free_list.empty() &&
+             temp_buffer_tot_byte_size_ > max_cached_bytes) {
+        evicted.push_back(std::move(free_list.back()));
+        free_list.pop_back();
+        temp_buffer_tot_byte_size_ -= class_byte_size(cls);
+      }
+    }
   }
 }
 
 template <typename container_t>
-void Temp_Mem_Pool::release_buff_mem_(const container_t& mem) {
+typename Temp_Mem_Pool::event_t Temp_Mem_Pool::release_buff_mem(
+    const typename Temp_Mem_Pool::event_t&, const container_t& mem) {
   const size_t byteSize = mem.get_buffer().byte_size();
+  const size_t cls = size_class(byteSize);
+  // Buffers that do not match a size class were not allocated by the pool
+  if (cls == num_size_classes || class_byte_size(cls) != byteSize) {
+    return {};
+  }
   auto rebuff =
-      mem.get_buffer()
-          .template reinterpret<temp_buffer_map_t::mapped_type::value_type>(
-              sycl::range<1>(
-                  byteSize /
-                  sizeof(temp_buffer_map_t::mapped_type::value_type)));
-  temp_buffer_map_mutex_.lock();  // lock
-  if (temp_buffer_map_tot_byte_size_ + byteSize <= max_size_temp_mem_) {
-    temp_buffer_map_tot_byte_size_ += byteSize;
-    temp_buffer_map_.emplace(byteSize, rebuff);
-  }
-  temp_buffer_map_mutex_.unlock();  // unlock
+      mem.get_buffer().template reinterpret<buffer_t::value_type>(
+          sycl::range<1>(byteSize / sizeof(buffer_t::value_type)));
+  {
+    shard_t& shard = shards_[get_shard_index()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.buffers[cls].push_back(rebuff);
+  }
+  if ((temp_buffer_tot_byte_size_ += byteSize) > high_water_mark_) {
+    trim_buffers(high_water_mark_);
+  }
+  return {};
 }
 
-template <typename container_t>
-typename Temp_Mem_Pool::event_t Temp_Mem_Pool::release_buff_mem(
-    const typename Temp_Mem_Pool::event_t& dependencies,
-    const container_t& mem) {
-  return {q_.submit([&](sycl::handler& cgh) {
-    cgh.depends_on(dependencies);
-    cgh.host_task([&, mem]() { release_buff_mem_(mem); });
-  })};
+#ifdef SB_ENABLE_USM
+inline bool Temp_Mem_Pool::is_complete(const event_t& dependencies) {
+  for (const auto& ev : dependencies) {
+    if (ev.get_info<sycl::info::event::command_execution_status>() !=
+        sycl::info::event_command_status::complete) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline size_t Temp_Mem_Pool::num_cached_usm() {
+  size_t count = 0;
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (const auto& free_list : shard.usm) count += free_list.size();
+  }
+  return count;
 }
 
-#ifdef SB_ENABLE_USM
 template <typename value_t>
 typename helper::AllocHelper<value_t, helper::AllocType::usm>::type
 Temp_Mem_Pool::acquire_usm_mem(size_t size) {
-  const size_t byteSize = size * sizeof(value_t);
-  temp_usm_map_mutex_.lock();  // lock
-  auto found = temp_usm_map_.lower_bound(byteSize);
-  if (found != temp_usm_map_.end()) {
-    temp_usm_map_tot_byte_size_ -= found->first;
-    value_t* tmp = reinterpret_cast<value_t*>(found->second);
-    temp_usm_map_.erase(found);
-    temp_usm_map_mutex_.unlock();  // unlock
-    return tmp;
-  } else {
-    temp_usm_map_mutex_.unlock();  // unlock
+  const size_t cls = size_class(size * sizeof(value_t));
+  if (cls == num_size_classes) {
+    // Too large to be cached, freed on release
+    return sycl::malloc_device<value_t>(size, q_);
+  }
+  const size_t byteSize = class_byte_size(cls);
+  // Look in the shard of the thread first, then in the others
+  const size_t first_shard = get_shard_index();
+  for (size_t i = 0; i < num_shards; i++) {
+    shard_t& shard = shards_[(first_shard + i) % num_shards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& free_list = shard.usm[cls];
+    for (auto it = free_list.begin(); it != free_list.end(); ++it) {
+      if (is_ready(it->dependencies)) {
+        void* ptr = it->ptr;
+        *it = std::move(free_list.back());
+        free_list.pop_back();
+        temp_usm_tot_byte_size_ -= byteSize;
+        return reinterpret_cast<value_t*>(ptr);
+      }
+    }
+  }
 #ifdef VERBOSE
-    std::cout << "Create a temporary USM allocation of " << byteSize
-              << " bytes." << std::endl;
+  std::cout << "Create a temporary USM allocation of " << byteSize
+            << " bytes." << std::endl;
 #endif
-    value_t* tmp = sycl::malloc_device<value_t>(size, q_);
-    temp_usm_map_mutex_.lock();  // lock
-    temp_usm_size_map_.emplace(
-        reinterpret_cast<temp_usm_size_map_t::key_type>(tmp), byteSize);
-    temp_usm_map_mutex_.unlock();  // unlock
-    return tmp;
+  void* ptr = sycl::aligned_alloc_device(usm_alignment, byteSize, q_);
+  {
+    std::unique_lock<std::shared_mutex> lock(temp_usm_size_map_mutex_);
+    temp_usm_size_map_.emplace(ptr, cls);
   }
+  return reinterpret_cast<value_t*>(ptr);
 }
 
-template <typename container_t>
-void Temp_Mem_Pool::release_usm_mem_(const container_t& mem) {
-  temp_usm_map_mutex_.lock();  // lock
-  auto found = temp_usm_size_map_.find(
-      reinterpret_cast<temp_usm_size_map_t::key_type>(mem));
-  const size_t byteSize = found->second;
-  if (temp_usm_map_tot_byte_size_ + byteSize > max_size_temp_mem_) {
-    temp_usm_size_map_.erase(found);
-    temp_usm_map_mutex_.unlock();  // unlock
-    sycl::free(mem, q_);
-  } else {
-    temp_usm_map_tot_byte_size_ += byteSize;
-    temp_usm_map_.emplace(byteSize,
-                          reinterpret_cast<temp_usm_map_t::mapped_type>(mem));
-    temp_usm_map_mutex_.unlock();  // unlock
+inline void Temp_Mem_Pool::trim_usm(size_t max_cached_bytes) {
+  std::vector<void*> evicted;
+  for (size_t cls = num_size_classes;
+       cls-- > 0 && temp_usm_tot_byte_size_ > max_cached_bytes;) {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto& free_list = shard.usm[cls];
+      // Blocks still used by a kernel cannot be freed yet, even on an
+      // in-order queue
+      for (size_t i = 0; i < free_list.size() &&
+                         temp_usm_tot_byte_size_ > max_cached_bytes;) {
+        if (is_complete(free_list[i].dependencies)) {
+          evicted.push_back(free_list[i].ptr);
+          free_list[i] = std::move(free_list.back());
+          free_list.pop_back();
+          temp_usm_tot_byte_size_ -= class_byte_size(cls);
+        } else {
+          i++;
+        }
+      }
+    }
+  }
+  if (!evicted.empty()) {
+    std::unique_lock<std::shared_mutex> lock(temp_usm_size_map_mutex_);
+    for (void* ptr : evicted) temp_usm_size_map_.erase(ptr);
   }
+  for (void* ptr : evicted) sycl::free(ptr, q_);
 }
 
 template <typename container_t>
 typename Temp_Mem_Pool::event_t Temp_Mem_Pool::release_usm_mem(
     const typename Temp_Mem_Pool::event_t& dependencies,
     const container_t& mem) {
-  return {q_.submit([&](sycl::handler& cgh) {
-    cgh.depends_on(dependencies);
-    cgh.host_task([&, mem]() { release_usm_mem_(mem); });
-  })};
-}
+  void* ptr = static_cast<void*>(mem);
+  size_t cls = num_size_classes;
+  {
+    std::shared_lock<std::shared_mutex> lock(temp_usm_size_map_mutex_);
+    auto found = temp_usm_size_map_.find(ptr);
+    if (found != temp_usm_size_map_.end()) {
+      cls = found->second;
+    }
+  }
+  if (cls == num_size_classes) {
+    // Not cached, freed once the kernels using it are complete
+    sycl::context context = q_.get_context();
+    return {q_.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+      cgh.host_task([=]() { sycl::free(ptr, context); });
+    })};
+  }
+  {
+    shard_t& shard = shards_[get_shard_index()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.usm[cls].push_back({ptr, dependencies});
+  }
+  if ((temp_usm_tot_byte_size_ += class_byte_size(cls)) > high_water_mark_) {
+    trim_usm(high_water_mark_);
+  }
+  return {};
 }
 #endif  // SB_ENABLE_USM
+}  // namespace blas
 #endif  // __ADAPTIVECPP__
 #endif
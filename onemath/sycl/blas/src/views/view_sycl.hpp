@@ -82,7 +82,7 @@ struct VectorView<
   // number of threads are launched.
   static ONEMATH_SYCL_BLAS_INLINE index_t calculate_input_data_size(
       container_t &data, index_t, increment_t stride, index_t size) noexcept {
-    increment_t const positive_stride = stride < 0 ? -stride : stride;
+    index_t const positive_stride = stride < 0 ? -stride : stride;
     index_t const calc_size = round_up_ratio(data.size(), positive_stride);
     return std::min(size, calc_size);
   }
@@ -144,14 +144,22 @@ struct VectorView<
   template <bool use_as_ptr = false>
   ONEMATH_SYCL_BLAS_INLINE typename std::enable_if<!use_as_ptr, scalar_t &>::type eval(
       index_t i) {
-    return (stride_ == 1) ? *(ptr_ + i) : *(ptr_ + i * stride_);
+    if constexpr (is_unit_stride<increment_t>::value) {
+      return *(ptr_ + i);
+    } else {
+      return (stride_ == 1) ? *(ptr_ + i) : *(ptr_ + i * stride_);
+    }
   }
 
   template <bool use_as_ptr = false>
   ONEMATH_SYCL_BLAS_INLINE typename std::enable_if<
       !use_as_ptr, scalar_t&>::type
   eval(index_t i) const {
-    return (stride_ == 1) ? *(ptr_ + i) : *(ptr_ + i * stride_);
+    if constexpr (is_unit_stride<increment_t>::value) {
+      return *(ptr_ + i);
+    } else {
+      return (stride_ == 1) ? *(ptr_ + i) : *(ptr_ + i * stride_);
+    }
   }
 
   ONEMATH_SYCL_BLAS_INLINE scalar_t &eval(sycl::nd_item<1> ndItem) {
@@ -174,6 +182,32 @@ struct VectorView<
     return *(ptr_ + indx);
   }
 
+  /*!
+   * @brief See VectorView.
+   */
+  template <int packet_size>
+  ONEMATH_SYCL_BLAS_INLINE sycl::vec<scalar_t, packet_size> eval_packet(
+      index_t i) const {
+    using address_t = sycl::access::address_space;
+    sycl::vec<scalar_t, packet_size> packet{};
+    packet.template load<address_t::global_space>(
+        0, sycl::multi_ptr<const scalar_t, address_t::global_space>(
+               get_pointer() + i));
+    return packet;
+  }
+
+  /*!
+   * @brief See VectorView.
+   */
+  template <int packet_size>
+  ONEMATH_SYCL_BLAS_INLINE void store_packet(
+      index_t i, const sycl::vec<scalar_t, packet_size> &packet) {
+    using address_t = sycl::access::address_space;
+    packet.template store<address_t::global_space>(
+        0, sycl::multi_ptr<scalar_t, address_t::global_space>(get_pointer() +
+                                                              i));
+  }
+
   ONEMATH_SYCL_BLAS_INLINE void bind(sycl::handler &h) { h.require(data_); }
   ONEMATH_SYCL_BLAS_INLINE void adjust_access_displacement() {
     ptr_ = data_.get_pointer() + disp_;
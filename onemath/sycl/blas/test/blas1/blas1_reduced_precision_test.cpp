@@ -0,0 +1,69 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#ifdef BLAS_ENABLE_HALF
+// The squares and products of |x| ~ 1000 overflow half, the reductions must
+// compute them in float
+class ReducedPrecision : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!q_.get_device().has(sycl::aspect::fp16)) {
+      GTEST_SKIP() << "The device doesn't support half";
+    }
+    x_.resize(n_);
+    for (int i = 0; i < n_; ++i) {
+      x_[i] = sycl::half(i % 2 ? 1000.f : -1000.f);
+    }
+  }
+
+  sycl::queue q_;
+  const int n_ = 64;
+  std::vector<sycl::half> x_;
+};
+
+TEST_F(ReducedPrecision, Nrm2Half) {
+  blas::SB_Handle sb_handle(q_);
+  auto d_x = blas_test::make_device_copy(q_, x_);
+  auto d_rs = blas_test::make_device_copy(q_, std::vector<sycl::half>{0});
+  sb_handle.wait(blas::_nrm2(sb_handle, n_, d_x, 1, d_rs));
+  const float result = blas_test::copy_to_host(q_, d_rs, 1)[0];
+  EXPECT_NEAR(result, 8000.f, 8.f);
+}
+
+TEST_F(ReducedPrecision, DotHalf) {
+  blas::SB_Handle sb_handle(q_);
+  // The products are 1e6 and -999000, their sum is 32 * 1000
+  std::vector<sycl::half> y(n_);
+  for (int i = 0; i < n_; ++i) {
+    y[i] = sycl::half(i % 2 ? 1000.f : 999.f);
+  }
+  auto d_x = blas_test::make_device_copy(q_, x_);
+  auto d_y = blas_test::make_device_copy(q_, y);
+  auto d_rs = blas_test::make_device_copy(q_, std::vector<sycl::half>{0});
+  sb_handle.wait(blas::_dot(sb_handle, n_, d_x, 1, d_y, 1, d_rs));
+  const float result = blas_test::copy_to_host(q_, d_rs, 1)[0];
+  EXPECT_NEAR(result, 32000.f, 32.f);
+}
+#endif  // BLAS_ENABLE_HALF
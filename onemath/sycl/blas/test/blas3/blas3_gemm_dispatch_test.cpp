@@ -0,0 +1,70 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+// A single product deep in K, with fewer 32x32 tiles than compute units, runs
+// with Stream-K, on CPU devices as well
+TEST(Blas3_Gemm_Dispatch, SkinnyLargeKUsesStreamK) {
+  EXPECT_TRUE(blas::use_stream_k(16, 64, 64, 4096, 1));
+  EXPECT_TRUE(blas::use_stream_k(56, 96, 128, 1024, 1));
+}
+
+// Square products fill the cores with their blocks of C, so they keep the CPU
+// Gemm, as do the shallow and the batched products
+TEST(Blas3_Gemm_Dispatch, OtherShapesUseCpuGemm) {
+  EXPECT_FALSE(blas::use_stream_k(16, 1024, 1024, 1024, 1));
+  EXPECT_FALSE(blas::use_stream_k(16, 64, 64, 128, 1));
+  EXPECT_FALSE(blas::use_stream_k(16, 64, 64, 4096, 4));
+}
+
+// Stream-K results match the reference on whichever device runs the test
+TEST(Blas3_Gemm_Dispatch, SkinnyLargeKResult) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int m = 40, n = 24, k = 2048;
+  std::vector<float> a(m * k), b(k * n), c(m * n, 1.f);
+  for (int i = 0; i < m * k; ++i) {
+    a[i] = static_cast<float>(i % 7 - 3) / 4.f;
+  }
+  for (int i = 0; i < k * n; ++i) {
+    b[i] = static_cast<float>(i % 5 - 2) / 2.f;
+  }
+  auto d_a = blas_test::make_device_copy(q, a);
+  auto d_b = blas_test::make_device_copy(q, b);
+  auto d_c = blas_test::make_device_copy(q, c);
+
+  blas::_gemm(sb_handle, 'n', 'n', m, n, k, 1.f, d_a, m, d_b, k, 1.f, d_c, m);
+  sb_handle.wait();
+
+  auto result = blas_test::copy_to_host(q, d_c, m * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      double sum = c[i + j * m];
+      for (int l = 0; l < k; ++l) {
+        sum += static_cast<double>(a[i + l * m]) * b[l + j * k];
+      }
+      EXPECT_NEAR(result[i + j * m], sum, 1e-2);
+    }
+  }
+}
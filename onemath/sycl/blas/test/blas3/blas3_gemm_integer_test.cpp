@@ -0,0 +1,62 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+// alpha does not divide beta, C is scaled by beta before the kernels add
+// alpha * A * B to it
+TEST(Blas3_Gemm, IntegerBetaNotMultipleOfAlpha) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int m = 33, n = 17, k = 45;
+  const int32_t alpha = 2, beta = 1;
+  std::vector<int8_t> a(m * k), b(k * n);
+  std::vector<int32_t> c(m * n);
+  for (int i = 0; i < m * k; ++i) {
+    a[i] = static_cast<int8_t>(i % 7 - 3);
+  }
+  for (int i = 0; i < k * n; ++i) {
+    b[i] = static_cast<int8_t>(i % 5 - 2);
+  }
+  for (int i = 0; i < m * n; ++i) {
+    c[i] = i % 11 - 5;
+  }
+  auto d_a = blas_test::make_device_copy(q, a);
+  auto d_b = blas_test::make_device_copy(q, b);
+  auto d_c = blas_test::make_device_copy(q, c);
+
+  blas::_gemm(sb_handle, 'n', 'n', m, n, k, alpha, d_a, m, d_b, k, beta, d_c,
+              m);
+  sb_handle.wait();
+
+  auto result = blas_test::copy_to_host(q, d_c, m * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      int32_t sum = 0;
+      for (int l = 0; l < k; ++l) {
+        sum += int32_t{a[i + l * m]} * int32_t{b[l + j * k]};
+      }
+      EXPECT_EQ(result[i + j * m], alpha * sum + beta * c[i + j * m]);
+    }
+  }
+}
@@ -0,0 +1,100 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+#include <limits>
+
+// B = alpha * A * B with A lower triangular, large enough for the recursion
+// to run GEMMs between the leaves
+TEST(Blas3_Trmm, LeftLowerMatchesReference) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int m = 100, n = 37;
+  const float alpha = 1.5f;
+  std::vector<float> a(m * m), b(m * n);
+  for (int i = 0; i < m * m; ++i) {
+    a[i] = static_cast<float>(i % 7 - 3) / 8.f;
+  }
+  for (int i = 0; i < m * n; ++i) {
+    b[i] = static_cast<float>(i % 5 - 2) / 2.f;
+  }
+  auto d_a = blas_test::make_device_copy(q, a);
+  auto d_b = blas_test::make_device_copy(q, b);
+
+  blas::_trmm(sb_handle, 'l', 'l', 'n', 'n', m, n, alpha, d_a, m, d_b, m);
+  sb_handle.wait();
+
+  auto result = blas_test::copy_to_host(q, d_b, m * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      double sum = 0;
+      for (int l = 0; l <= i; ++l) {
+        sum += static_cast<double>(a[i + l * m]) * b[l + j * m];
+      }
+      EXPECT_NEAR(result[i + j * m], alpha * sum, 1e-3);
+    }
+  }
+}
+
+// With alpha = 0, B is zeroed without reading A, here full of NaN
+TEST(Blas3_Trmm, ZeroAlphaZeroesB) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int m = 40, n = 9, ldb = 48;
+  std::vector<float> a(m * m, std::numeric_limits<float>::quiet_NaN());
+  std::vector<float> b(ldb * n, 3.f);
+  auto d_a = blas_test::make_device_copy(q, a);
+  auto d_b = blas_test::make_device_copy(q, b);
+
+  blas::_trmm(sb_handle, 'r', 'u', 't', 'n', m, n, 0.f, d_a, n, d_b, ldb);
+  sb_handle.wait();
+
+  auto result = blas_test::copy_to_host(q, d_b, ldb * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < ldb; ++i) {
+      // The rows past m are not part of B
+      EXPECT_EQ(result[i + j * ldb], i < m ? 0.f : 3.f);
+    }
+  }
+}
+
+// The leaves never use more work items than the device allows
+TEST(Blas3_Trmm, LeafWorkGroupClampedToDevice) {
+  sycl::queue q;
+  auto d_a = blas_test::make_device_copy(q, std::vector<float>(32 * 32));
+  auto d_b = blas_test::make_device_copy(q, std::vector<float>(32 * 64));
+  auto view_a = blas::make_matrix_view<blas::col_major>(d_a, 32, 32, 32);
+  auto view_b = blas::make_matrix_view<blas::col_major>(d_b, 32, 64, 32);
+
+  auto full = blas::make_triangular_block_multiplier<true, false, false, false,
+                                                     false, 32>(
+      view_a, view_b, 1.f, 32, 64, 1024);
+  EXPECT_EQ(full.get_nd_range().get_local_range()[0], 256u);
+  auto clamped =
+      blas::make_triangular_block_multiplier<true, false, false, false, false,
+                                             32>(view_a, view_b, 1.f, 32, 64,
+                                                 64);
+  EXPECT_EQ(clamped.get_nd_range().get_local_range()[0], 64u);
+  EXPECT_EQ(clamped.get_nd_range().get_global_range()[0], 128u);
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#ifndef ONEMATH_SYCL_BLAS_TEST_HPP
+#define ONEMATH_SYCL_BLAS_TEST_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "onemath_sycl_blas.hpp"
+
+namespace blas_test {
+
+/**
+ * @brief Copies host data to a new buffer.
+ */
+template <typename scalar_t>
+inline blas::BufferIterator<scalar_t> make_device_copy(
+    sycl::queue& q, const std::vector<scalar_t>& host) {
+  auto device = blas::helper::allocate<blas::helper::AllocType::buffer,
+                                       scalar_t>(
+      static_cast<int>(host.size()), q);
+  blas::helper::copy_to_device(q, host.data(), device, host.size()).wait();
+  return device;
+}
+
+/**
+ * @brief Copies size elements of a buffer back to the host.
+ */
+template <typename scalar_t>
+inline std::vector<scalar_t> copy_to_host(sycl::queue& q,
+                                          blas::BufferIterator<scalar_t> device,
+                                          size_t size) {
+  std::vector<scalar_t> host(size);
+  blas::helper::copy_to_host(q, device, host.data(), size).wait();
+  return host;
+}
+
+/**
+ * @brief Reference inner product, accumulated in double.
+ */
+template <typename scalar_t>
+inline double reference_dot(const std::vector<scalar_t>& x,
+                            const std::vector<scalar_t>& y) {
+  double sum = 0;
+  for (size_t i = 0; i < x.size(); ++i) {
+    sum += static_cast<double>(x[i]) * static_cast<double>(y[i]);
+  }
+  return sum;
+}
+
+}  // namespace blas_test
+
+#endif  // ONEMATH_SYCL_BLAS_TEST_HPP
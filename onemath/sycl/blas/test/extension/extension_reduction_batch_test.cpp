@@ -0,0 +1,73 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+// Sliding windows: the batch vectors overlap, which is valid since they are
+// only read
+TEST(Extension_Reduction_Batch, OverlappingVectors) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int n = 64, stride = 3, batch_size = 20;
+  const int size = stride * (batch_size - 1) + n;
+  std::vector<float> x(size), y(size);
+  for (int i = 0; i < size; ++i) {
+    x[i] = static_cast<float>(i % 7) - 3.f;
+    y[i] = static_cast<float>(i % 5) - 2.f;
+  }
+  auto d_x = blas_test::make_device_copy(q, x);
+  auto d_y = blas_test::make_device_copy(q, y);
+  auto d_dot = blas_test::make_device_copy(q, std::vector<float>(batch_size));
+  auto d_asum = blas_test::make_device_copy(q, std::vector<float>(batch_size));
+
+  blas::_dot_batch(sb_handle, n, d_x, 1, stride, d_y, 1, stride, d_dot,
+                   batch_size);
+  blas::_asum_batch(sb_handle, n, d_x, 1, stride, d_asum, batch_size);
+  sb_handle.wait();
+
+  auto dot = blas_test::copy_to_host(q, d_dot, batch_size);
+  auto asum = blas_test::copy_to_host(q, d_asum, batch_size);
+  for (int b = 0; b < batch_size; ++b) {
+    const std::vector<float> x_b(x.begin() + b * stride,
+                                 x.begin() + b * stride + n);
+    const std::vector<float> y_b(y.begin() + b * stride,
+                                 y.begin() + b * stride + n);
+    double expected_asum = 0;
+    for (const float v : x_b) {
+      expected_asum += std::abs(v);
+    }
+    EXPECT_NEAR(dot[b], blas_test::reference_dot(x_b, y_b), 1e-3)
+        << "b = " << b;
+    EXPECT_NEAR(asum[b], expected_asum, 1e-3) << "b = " << b;
+  }
+}
+
+// A negative stride is still rejected
+TEST(Extension_Reduction_Batch, NegativeStrideThrows) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  auto d_x = blas_test::make_device_copy(q, std::vector<float>(16, 1.f));
+  auto d_rs = blas_test::make_device_copy(q, std::vector<float>(2));
+  EXPECT_THROW(blas::_asum_batch(sb_handle, 8, d_x, 1, -8, d_rs, 2),
+               std::invalid_argument);
+}
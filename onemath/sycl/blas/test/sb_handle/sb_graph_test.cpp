@@ -0,0 +1,124 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+// The recorded fill resets the result that _dot accumulates into, so every
+// replay gives the same result
+TEST(SB_Graph, DotReplayedTwice) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int n = 1027;
+  std::vector<float> x(n), y(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = static_cast<float>(i % 7) - 3.f;
+    y[i] = static_cast<float>(i % 5) - 2.f;
+  }
+  auto d_x = blas_test::make_device_copy(q, x);
+  auto d_y = blas_test::make_device_copy(q, y);
+  auto d_rs = blas_test::make_device_copy(q, std::vector<float>{42.f});
+
+  sb_handle.begin_recording();
+  sb_handle.fill(d_rs, 0.f, 1);
+  blas::_dot(sb_handle, n, d_x, 1, d_y, 1, d_rs);
+  auto graph = sb_handle.end_recording();
+
+  const double expected = blas_test::reference_dot(x, y);
+  for (int replay = 0; replay < 2; ++replay) {
+    graph->replay();
+    sb_handle.wait();
+    EXPECT_NEAR(blas_test::copy_to_host(q, d_rs, 1)[0], expected, 1e-3);
+  }
+}
+
+// The copies of the operators are recorded with the host data they read
+TEST(SB_Graph, TrsvReplayedTwice) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  const int n = 64;
+  // Unit lower triangular matrix with 1/n below the diagonal
+  std::vector<float> a(n * n, 0.f);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j + 1; i < n; ++i) {
+      a[i + j * n] = 1.f / n;
+    }
+  }
+  std::vector<float> b(n, 1.f);
+  auto d_a = blas_test::make_device_copy(q, a);
+  auto d_x = blas_test::make_device_copy(q, b);
+  auto d_b = blas_test::make_device_copy(q, b);
+
+  sb_handle.begin_recording();
+  blas::_copy(sb_handle, n, d_b, 1, d_x, 1);
+  blas::_trsv(sb_handle, 'l', 'n', 'u', n, d_a, n, d_x, 1);
+  auto graph = sb_handle.end_recording();
+
+  std::vector<float> expected(n);
+  for (int i = 0; i < n; ++i) {
+    double sum = b[i];
+    for (int j = 0; j < i; ++j) {
+      sum -= a[i + j * n] * expected[j];
+    }
+    expected[i] = static_cast<float>(sum);
+  }
+  for (int replay = 0; replay < 2; ++replay) {
+    graph->replay();
+    sb_handle.wait();
+    auto result = blas_test::copy_to_host(q, d_x, n);
+    for (int i = 0; i < n; ++i) {
+      EXPECT_NEAR(result[i], expected[i], 1e-4) << "i = " << i;
+    }
+  }
+}
+
+// Devices without graph support record the list of launches
+TEST(SB_Graph, CommandGraphFollowsDeviceAspect) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  auto d_x = blas_test::make_device_copy(q, std::vector<float>(16, 1.f));
+  sb_handle.begin_recording();
+  blas::_scal(sb_handle, 16, 2.f, d_x, 1);
+  auto graph = sb_handle.end_recording();
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+  const bool expected = q.get_device().has(sycl::aspect::ext_oneapi_graph);
+#else
+  const bool expected = false;
+#endif
+  EXPECT_EQ(graph->uses_command_graph(), expected);
+  EXPECT_EQ(graph->get_num_launches() == 0, expected);
+  graph->replay();
+  sb_handle.wait();
+  EXPECT_EQ(blas_test::copy_to_host(q, d_x, 16)[0], 2.f);
+}
+
+// The events returned while recording must not be waited on
+TEST(SB_Graph, HostSynchronizationThrows) {
+  sycl::queue q;
+  blas::SB_Handle sb_handle(q);
+  auto d_x = blas_test::make_device_copy(q, std::vector<float>(16, 1.f));
+  sb_handle.begin_recording();
+  EXPECT_THROW(blas::_dot_async(sb_handle, 16, d_x, 1, d_x, 1),
+               std::runtime_error);
+  EXPECT_THROW(sb_handle.wait(), std::runtime_error);
+  sb_handle.end_recording();
+}